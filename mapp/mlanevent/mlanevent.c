@@ -37,6 +37,9 @@ Change log:
 #include <time.h>
 #include <sys/time.h>
 #include <getopt.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
 
 #include <sys/socket.h>
 #include <linux/netlink.h>
@@ -199,12 +202,16 @@ static void print_mac(t_u8 *raw)
 static void print_usage(void)
 {
 	printf("\n");
-	printf("Usage : mlanevent.exe [-v] [-h]\n");
+	printf("Usage : mlanevent.exe [-v] [-h] [-i <dev>] [-r <dev>]\n");
 	printf("    -v               : Print version information\n");
 	printf("    -h               : Print help information\n");
 	printf("    -i               : Specify device number from 0 to %d\n",
 	       MAX_NO_OF_DEVICES - 1);
 	printf("                       0xff for all devices\n");
+	printf("    -r               : Read events in batches from the driver\n");
+	printf("                       event ring of device 0 to %d\n",
+	       MAX_NO_OF_DEVICES - 1);
+	printf("                       (needs driver param evt_ring)\n");
 	printf("\n");
 }
 
@@ -2419,6 +2426,91 @@ static int read_event(int *sk_fd, int no_of_sk, evt_buf *recv_buf, int timeout,
 	return ret;
 }
 
+/**
+ *  @brief Read events in batches from /proc/mwlan/adapterX/event_ring
+ *
+ *  @param dev      Device number
+ *  @return         Number of events read or MLAN_EVENT_FAILURE
+ */
+static int read_event_ring(int dev)
+{
+	char filename[64];
+	struct pollfd pfd;
+	evt_ring_rec *rec = NULL;
+	event_header *event = NULL;
+	char if_name[IFNAMSIZ + 1];
+	t_u8 *buf = NULL;
+	int num_events = 0, num_lost = 0;
+	int fd, len, off, rec_len;
+
+	snprintf(filename, sizeof(filename), "/proc/mwlan/adapter%d/event_ring",
+		 dev);
+	fd = open(filename, O_RDONLY | O_NONBLOCK);
+	if (fd < 0) {
+		printf("ERR:Could not open %s\n", filename);
+		return MLAN_EVENT_FAILURE;
+	}
+	buf = malloc(EVT_RING_READ_SIZE);
+	if (!buf) {
+		printf("ERR: Fail to allocate event ring buffer\n");
+		close(fd);
+		return MLAN_EVENT_FAILURE;
+	}
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	while (!terminate_flag) {
+		if (poll(&pfd, 1, UAP_RECV_WAIT_DEFAULT * 1000) <= 0)
+			continue;
+		if (pfd.revents & (POLLERR | POLLHUP)) {
+			printf("ERR:Event ring is not available\n");
+			break;
+		}
+		len = read(fd, buf, EVT_RING_READ_SIZE);
+		if (len < 0) {
+			if (errno == EAGAIN || errno == EINTR)
+				continue;
+			printf("ERR:Event ring read failed!\n");
+			break;
+		}
+		if (len == 0)
+			break;
+		/* One read returns a batch of whole records */
+		for (off = 0; off + (int)sizeof(evt_ring_rec) <= len;
+		     off += rec_len) {
+			rec = (evt_ring_rec *)(buf + off);
+			rec_len = (sizeof(evt_ring_rec) + rec->len +
+				   EVT_RING_REC_ALIGN - 1) &
+				  ~(EVT_RING_REC_ALIGN - 1);
+			if (off + rec_len > len || rec->len < IFNAMSIZ)
+				break;
+			if (rec->lost) {
+				printf("WARN: %u events lost before seq %u\n",
+				       rec->lost, rec->seq);
+				num_lost += rec->lost;
+			}
+			num_events++;
+			printf("\n");
+			printf("============================================\n");
+			printf("Received event seq %u\n", rec->seq);
+			printf("============================================\n");
+			memset(if_name, 0, IFNAMSIZ + 1);
+			memcpy(if_name, (t_u8 *)(rec + 1), IFNAMSIZ);
+			printf("EVENT for interface %s\n", if_name);
+			event = (event_header *)((t_u8 *)(rec + 1) + IFNAMSIZ);
+#if DEBUG
+			hexdump(rec, sizeof(evt_ring_rec) + rec->len, ' ');
+#endif
+			print_event(event, rec->len - IFNAMSIZ, if_name);
+		}
+		fflush(stdout);
+	}
+	printf("Events lost        : %d\n", num_lost);
+	free(buf);
+	close(fd);
+	return num_events;
+}
+
 /* Command line options */
 static const struct option long_opts[] = {{"help", no_argument, NULL, 'h'},
 					  {"version", no_argument, NULL, 'v'},
@@ -2496,9 +2588,10 @@ int main(int argc, char *argv[])
 	char if_name[IFNAMSIZ + 1];
 	t_u32 event_id = 0;
 	int i = 0, no_of_sk = 0, dev_index = -1;
+	int ring_dev = -1;
 
 	/* Check command line options */
-	while ((opt = getopt_long(argc, argv, "hvti:", long_opts, NULL)) > 0) {
+	while ((opt = getopt_long(argc, argv, "hvti:r:", long_opts, NULL)) > 0) {
 		switch (opt) {
 		case 'h':
 			print_usage();
@@ -2519,6 +2612,14 @@ int main(int argc, char *argv[])
 				argv += optind;
 			}
 			break;
+		case 'r':
+			if ((IS_HEX_OR_DIGIT(optarg) == MLAN_EVENT_FAILURE) ||
+			    (A2HEXDECIMAL(optarg) >= MAX_NO_OF_DEVICES)) {
+				print_usage();
+				return 1;
+			}
+			ring_dev = A2HEXDECIMAL(optarg);
+			break;
 		default:
 			print_usage();
 			return 1;
@@ -2530,6 +2631,16 @@ int main(int argc, char *argv[])
 		print_usage();
 		return 1;
 	}
+	if (ring_dev >= 0) {
+		signal(SIGTERM, sig_handler);
+		signal(SIGINT, sig_handler);
+		signal(SIGALRM, sig_handler);
+		num_events = read_event_ring(ring_dev);
+		if (num_events == MLAN_EVENT_FAILURE)
+			return 1;
+		printf("Total events       : %u\n", num_events);
+		return 0;
+	}
 	evt_recv_buf = malloc(sizeof(evt_buf) * MAX_NO_OF_DEVICES);
 	if (!evt_recv_buf) {
 		printf("ERR: Fail to allocate evt_recv_buf\n");
@@ -184,6 +184,21 @@ typedef PACK_START struct _evt_buf {
 	t_u8 buffer[NL_MAX_PAYLOAD];
 } PACK_END evt_buf;
 
+/** Event ring record header, followed by interface name and event */
+typedef PACK_START struct _evt_ring_rec {
+	/** Length of interface name and event */
+	t_u16 len;
+	/** Events dropped by the driver just before this one */
+	t_u16 lost;
+	/** Event sequence number */
+	t_u32 seq;
+} PACK_END evt_ring_rec;
+
+/** Event ring records are padded to this alignment */
+#define EVT_RING_REC_ALIGN 4
+/** Event ring read buffer size */
+#define EVT_RING_READ_SIZE (64 * 1024)
+
 /** Event header */
 typedef PACK_START struct _event_header {
 	/** Event ID */
@@ -38,7 +38,11 @@ Change log:
 #include <linux/netlink.h>
 #include <linux/if.h>
 #include <sys/stat.h>
+#include <sys/un.h>
 #include <net/ethernet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
 
 #include "mlanutl.h"
 
@@ -122,6 +126,8 @@ static int process_drvdbg(int argc, char *argv[]);
 #endif
 static int process_datarate(int argc, char *argv[]);
 static int process_getlog(int argc, char *argv[]);
+static int process_statstlv(int argc, char *argv[]);
+static int process_cmdlist(int argc, char *argv[]);
 static int process_get_txpwrlimit(int argc, char *argv[]);
 #ifdef STA_SUPPORT
 static int process_get_signal(int argc, char *argv[]);
@@ -353,6 +359,8 @@ struct command_node command_list[] = {
 #endif
 	{"getdatarate", process_datarate},
 	{"getlog", process_getlog},
+	{"statstlv", process_statstlv},
+	{"cmdlist", process_cmdlist},
 	{"get_txpwrlimit", process_get_txpwrlimit},
 #ifdef STA_SUPPORT
 	{"getsignal", process_get_signal},
@@ -572,13 +580,20 @@ struct command_node command_list[] = {
 
 static char *usage[] = {
 	"Usage: ", "   mlanutl -v  (version)",
-	"   mlanutl <ifname> <cmd> [...]", "   where",
+	"   mlanutl <ifname> <cmd> [...]",
+	"   mlanutl --batch [--json] [--listen <socket path>]",
+	"   mlanutl --trace <trace file>",
+	"   mlanutl --monring <mon_ring file> <pcap file> [seconds]",
+	"   mlanutl --csiring <csi_ring file> <out file> [seconds [batch]]",
+	"   where",
 	"   ifname : wireless network interface name, such as mlanX or uapX",
 	"   cmd :", "         version", "         verext", "         hostcmd",
 #ifdef DEBUG_LEVEL1
 	"         drvdbg",
 #endif
-	"         getdatarate", "         getlog", "         get_txpwrlimit",
+	"         getdatarate", "         getlog", "         statstlv",
+	"         cmdlist",
+	"         get_txpwrlimit",
 #ifdef STA_SUPPORT
 	"         getsignal",
 #endif
@@ -2239,6 +2254,180 @@ static int process_getlog(int argc, char *argv[])
 	return MLAN_STATUS_SUCCESS;
 }
 
+/**
+ *  @brief Get signal, stats and data rate in one binary TLV query
+ *  @param argc   Number of arguments
+ *  @param argv   A pointer to arguments array
+ *  @return     MLAN_STATUS_SUCCESS--success, otherwise--fail
+ */
+static int process_statstlv(int argc, char *argv[])
+{
+	t_u8 *buffer = NULL;
+	struct eth_priv_cmd *cmd = NULL;
+	struct eth_priv_stats_tlv *tlv = NULL;
+	struct eth_priv_signal *signal = NULL;
+	struct eth_priv_get_log *stats = NULL;
+	struct eth_priv_data_rate *datarate = NULL;
+	struct ifreq ifr;
+	t_u32 mask = 0;
+	int pos = 0;
+
+	if (argc > 4) {
+		printf("ERR:Invalid number of arguments\n");
+		printf("Syntax: ./mlanutl mlanX statstlv [mask]\n");
+		return MLAN_STATUS_FAILURE;
+	}
+	if (argc == 4)
+		mask = (t_u32)strtoul(argv[3], NULL, 0);
+
+	/* Initialize buffer */
+	buffer = (t_u8 *)malloc(BUFFER_LENGTH);
+	if (!buffer) {
+		printf("ERR:Cannot allocate buffer for command!\n");
+		return MLAN_STATUS_FAILURE;
+	}
+
+	/* The TLV mask is binary, so it is placed after the command name */
+	prepare_buffer(buffer, argv[2], 0, NULL);
+	memcpy(buffer + strlen(CMD_NXP) + strlen(argv[2]), &mask,
+	       sizeof(mask));
+
+	cmd = (struct eth_priv_cmd *)malloc(sizeof(struct eth_priv_cmd));
+	if (!cmd) {
+		printf("ERR:Cannot allocate buffer for command!\n");
+		free(buffer);
+		return MLAN_STATUS_FAILURE;
+	}
+
+	/* Fill up buffer */
+#ifdef USERSPACE_32BIT_OVER_KERNEL_64BIT
+	memset(cmd, 0, sizeof(struct eth_priv_cmd));
+	memcpy(&cmd->buf, &buffer, sizeof(buffer));
+#else
+	cmd->buf = buffer;
+#endif
+	cmd->used_len = 0;
+	cmd->total_len = BUFFER_LENGTH;
+
+	/* Perform IOCTL */
+	memset(&ifr, 0, sizeof(struct ifreq));
+	strncpy(ifr.ifr_ifrn.ifrn_name, dev_name, strlen(dev_name));
+	ifr.ifr_ifru.ifru_data = (void *)cmd;
+
+	if (ioctl(sockfd, MLAN_ETH_PRIV, &ifr)) {
+		perror("mlanutl");
+		fprintf(stderr, "mlanutl: statstlv fail\n");
+		if (cmd)
+			free(cmd);
+		if (buffer)
+			free(buffer);
+		return MLAN_STATUS_FAILURE;
+	}
+
+	/* Process result */
+	while (pos + (int)sizeof(*tlv) <= cmd->used_len) {
+		tlv = (struct eth_priv_stats_tlv *)(buffer + pos);
+		if (pos + (int)sizeof(*tlv) + tlv->len > cmd->used_len)
+			break;
+		switch (tlv->type) {
+		case STATS_TLV_SIGNAL:
+			signal = (struct eth_priv_signal *)tlv->value;
+			printf("signal: rssi %d/%d data_rssi %d/%d snr %d/%d nf %d/%d\n",
+			       signal->bcn_rssi_last, signal->bcn_rssi_avg,
+			       signal->data_rssi_last, signal->data_rssi_avg,
+			       signal->bcn_snr_last, signal->bcn_snr_avg,
+			       signal->bcn_nf_last, signal->bcn_nf_avg);
+			break;
+		case STATS_TLV_GETLOG:
+			stats = (struct eth_priv_get_log *)tlv->value;
+			printf("getlog: tx %u failed %u retry %u ack_failure %u "
+			       "fcs_error %u bcn_rcv %u bcn_miss %u\n",
+			       stats->tx_frame, stats->failed, stats->retry,
+			       stats->ack_failure, stats->fcs_error,
+			       stats->bcn_rcv_cnt, stats->bcn_miss_cnt);
+			break;
+		case STATS_TLV_DATARATE:
+			datarate = (struct eth_priv_data_rate *)tlv->value;
+			printf("datarate: tx %u rx %u tx_mcs %u rx_mcs %u\n",
+			       datarate->tx_data_rate, datarate->rx_data_rate,
+			       datarate->tx_mcs_index, datarate->rx_mcs_index);
+			break;
+		default:
+			printf("TLV %d: %d bytes\n", tlv->type, tlv->len);
+			break;
+		}
+		pos += sizeof(*tlv) + tlv->len;
+	}
+
+	if (buffer)
+		free(buffer);
+	if (cmd)
+		free(cmd);
+
+	return MLAN_STATUS_SUCCESS;
+}
+
+/**
+ *  @brief List the private commands supported by the driver
+ *  @param argc   Number of arguments
+ *  @param argv   A pointer to arguments array
+ *  @return     MLAN_STATUS_SUCCESS--success, otherwise--fail
+ */
+static int process_cmdlist(int argc, char *argv[])
+{
+	t_u8 *buffer = NULL;
+	struct eth_priv_cmd *cmd = NULL;
+	struct ifreq ifr;
+
+	/* Initialize buffer */
+	buffer = (t_u8 *)malloc(BUFFER_LENGTH);
+	if (!buffer) {
+		printf("ERR:Cannot allocate buffer for command!\n");
+		return MLAN_STATUS_FAILURE;
+	}
+
+	prepare_buffer(buffer, argv[2], 0, NULL);
+
+	cmd = (struct eth_priv_cmd *)malloc(sizeof(struct eth_priv_cmd));
+	if (!cmd) {
+		printf("ERR:Cannot allocate buffer for command!\n");
+		free(buffer);
+		return MLAN_STATUS_FAILURE;
+	}
+
+	/* Fill up buffer */
+#ifdef USERSPACE_32BIT_OVER_KERNEL_64BIT
+	memset(cmd, 0, sizeof(struct eth_priv_cmd));
+	memcpy(&cmd->buf, &buffer, sizeof(buffer));
+#else
+	cmd->buf = buffer;
+#endif
+	cmd->used_len = 0;
+	cmd->total_len = BUFFER_LENGTH;
+
+	/* Perform IOCTL */
+	memset(&ifr, 0, sizeof(struct ifreq));
+	strncpy(ifr.ifr_ifrn.ifrn_name, dev_name, strlen(dev_name));
+	ifr.ifr_ifru.ifru_data = (void *)cmd;
+
+	if (ioctl(sockfd, MLAN_ETH_PRIV, &ifr)) {
+		perror("mlanutl");
+		fprintf(stderr, "mlanutl: cmdlist fail\n");
+		free(cmd);
+		free(buffer);
+		return MLAN_STATUS_FAILURE;
+	}
+
+	/* One command per line: name [get] [set min-max] */
+	buffer[BUFFER_LENGTH - 1] = '\0';
+	printf("%s", buffer);
+
+	free(buffer);
+	free(cmd);
+
+	return MLAN_STATUS_SUCCESS;
+}
+
 #ifdef STA_SUPPORT
 /**
  *  @brief Get signal
@@ -24818,6 +25007,559 @@ done:
 			Global Functions
 ********************************************************/
 
+/** Maximum number of arguments in a batch command line */
+#define BATCH_MAX_ARGS 64
+/** Maximum length of a batch command line */
+#define BATCH_LINE_LEN 2048
+
+/**
+ *  @brief Split a batch command line into arguments
+ *
+ *  @param line     Command line, split in place
+ *  @param args     Argument array, args[0] is set by the caller
+ *  @return         Number of arguments including args[0]
+ */
+static int batch_split_line(char *line, char *args[])
+{
+	int num = 1;
+	char *pos = line;
+
+	while (*pos && num < BATCH_MAX_ARGS - 1) {
+		while (isspace((unsigned char)*pos))
+			pos++;
+		if (!*pos || *pos == '#')
+			break;
+		if (*pos == '"') {
+			args[num++] = ++pos;
+			while (*pos && *pos != '"')
+				pos++;
+		} else {
+			args[num++] = pos;
+			while (*pos && !isspace((unsigned char)*pos))
+				pos++;
+		}
+		if (*pos)
+			*pos++ = '\0';
+	}
+	args[num] = NULL;
+	return num;
+}
+
+/**
+ *  @brief Print buffer as the body of a JSON string
+ *
+ *  @param buf      Buffer
+ *  @param len      Buffer length
+ *  @return         N/A
+ */
+static void batch_json_escape(char *buf, int len)
+{
+	int i;
+	unsigned char c;
+
+	for (i = 0; i < len; i++) {
+		c = (unsigned char)buf[i];
+		if (c == '"' || c == '\\')
+			printf("\\%c", c);
+		else if (c == '\n')
+			printf("\\n");
+		else if (c == '\t')
+			printf("\\t");
+		else if (c < 0x20)
+			printf("\\u%04x", c);
+		else
+			putchar(c);
+	}
+}
+
+/**
+ *  @brief Run one batch command on the shared socket
+ *
+ *  @param argc     Number of arguments
+ *  @param argv     A pointer to arguments array
+ *  @return         MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int batch_run_command(int argc, char *argv[])
+{
+	int ret = MLAN_STATUS_SUCCESS;
+
+	if (argc < 3) {
+		fprintf(stderr, "Invalid number of parameters!\n");
+		return MLAN_STATUS_FAILURE;
+	}
+	memset(dev_name, 0, sizeof(dev_name));
+	strncpy(dev_name, argv[1], IFNAMSIZ - 1);
+
+	ret = process_command(argc, argv);
+	if (ret == MLAN_STATUS_NOTFOUND) {
+		ret = process_generic(argc, argv);
+		if (ret) {
+			fprintf(stderr, "Invalid command specified!\n");
+			ret = MLAN_STATUS_FAILURE;
+		}
+	}
+	return ret;
+}
+
+/**
+ *  @brief Print the fields of a JSON result line up to the ret field
+ *
+ *  @param seq      Command sequence number
+ *  @param num      Number of arguments
+ *  @param args     Command arguments
+ *  @param ret      Command return value
+ *  @return         N/A
+ */
+static void batch_json_head(int seq, int num, char *args[], int ret)
+{
+	printf("{\"seq\":%d,\"dev\":\"", seq);
+	batch_json_escape(args[1], strlen(args[1]));
+	printf("\",\"cmd\":\"");
+	if (num > 2)
+		batch_json_escape(args[2], strlen(args[2]));
+	printf("\",\"ret\":%d", ret);
+}
+
+/**
+ *  @brief Read commands line by line and run them one after another.
+ *         Text mode ends the output of each command with "OK" or
+ *         "ERR <ret>", JSON mode prints one object per command.
+ *
+ *  @param in       Input stream, one "<ifname> <cmd> [...]" per line
+ *  @param out_fd   Output descriptor
+ *  @param json     Print JSON lines if set
+ *  @return         MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+static int batch_process_stream(FILE *in, int out_fd, int json)
+{
+	char line[BATCH_LINE_LEN];
+	char *args[BATCH_MAX_ARGS];
+	char chunk[512];
+	FILE *capture = NULL;
+	int orig_fd = -1, out_dup = -1;
+	int num, len, ret, seq = 0;
+
+	fflush(stdout);
+	orig_fd = dup(STDOUT_FILENO);
+	out_dup = dup(out_fd);
+	if (orig_fd < 0 || out_dup < 0) {
+		fprintf(stderr, "mlanutl: Cannot set up batch output.\n");
+		if (orig_fd >= 0)
+			close(orig_fd);
+		if (out_dup >= 0)
+			close(out_dup);
+		return MLAN_STATUS_FAILURE;
+	}
+	dup2(out_dup, STDOUT_FILENO);
+
+	while (fgets(line, sizeof(line), in)) {
+		args[0] = "mlanutl";
+		num = batch_split_line(line, args);
+		if (num == 1)
+			continue;
+		seq++;
+		if (json) {
+			/* Command output is collected and sent as one line */
+			capture = tmpfile();
+			if (!capture) {
+				/* Its output would break the JSON stream */
+				char *reason = strerror(errno);
+
+				batch_json_head(seq, num, args, -1);
+				printf(",\"err\":\"");
+				batch_json_escape(reason, strlen(reason));
+				printf("\"}\n");
+				fflush(stdout);
+				continue;
+			}
+			dup2(fileno(capture), STDOUT_FILENO);
+		}
+		ret = batch_run_command(num, args);
+		fflush(stdout);
+		if (!json) {
+			printf(ret ? "ERR %d\n" : "OK\n", ret);
+			fflush(stdout);
+			continue;
+		}
+		dup2(out_dup, STDOUT_FILENO);
+		batch_json_head(seq, num, args, ret);
+		printf(",\"out\":\"");
+		lseek(fileno(capture), 0, SEEK_SET);
+		while ((len = read(fileno(capture), chunk, sizeof(chunk))) > 0)
+			batch_json_escape(chunk, len);
+		fclose(capture);
+		capture = NULL;
+		printf("\"}\n");
+		fflush(stdout);
+	}
+
+	dup2(orig_fd, STDOUT_FILENO);
+	close(orig_fd);
+	close(out_dup);
+	return MLAN_STATUS_SUCCESS;
+}
+
+/**
+ *  @brief Serve batch commands on a UNIX socket, one client at a time
+ *
+ *  @param path     Socket path
+ *  @param json     Print JSON lines if set
+ *  @return         MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+static int batch_listen(char *path, int json)
+{
+	struct sockaddr_un addr;
+	FILE *in = NULL;
+	mode_t old_mask;
+	int lfd, cfd, err;
+
+	lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (lfd < 0) {
+		fprintf(stderr, "mlanutl: Cannot open UNIX socket.\n");
+		return MLAN_STATUS_FAILURE;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+	unlink(addr.sun_path);
+	/* Clients run driver ioctls, keep the socket to its owner */
+	old_mask = umask(0177);
+	err = bind(lfd, (struct sockaddr *)&addr, sizeof(addr));
+	umask(old_mask);
+	if (err < 0 || chmod(addr.sun_path, 0600) < 0 || listen(lfd, 4) < 0) {
+		fprintf(stderr, "mlanutl: Cannot listen on %s: %s\n", path,
+			strerror(errno));
+		close(lfd);
+		return MLAN_STATUS_FAILURE;
+	}
+	/* A client going away must not stop the daemon */
+	signal(SIGPIPE, SIG_IGN);
+
+	while (1) {
+		cfd = accept(lfd, NULL, NULL);
+		if (cfd < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		in = fdopen(cfd, "r");
+		if (!in) {
+			close(cfd);
+			continue;
+		}
+		batch_process_stream(in, cfd, json);
+		fclose(in);
+	}
+	close(lfd);
+	unlink(addr.sun_path);
+	return MLAN_STATUS_FAILURE;
+}
+
+/**
+ *  @brief Batch mode: run many commands over one control socket
+ *
+ *  @param argc     Number of arguments
+ *  @param argv     A pointer to arguments array
+ *  @return         MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int process_batch(int argc, char *argv[])
+{
+	char *path = NULL;
+	int json = 0;
+	int i;
+
+	for (i = 2; i < argc; i++) {
+		if (!strcmp(argv[i], "--json")) {
+			json = 1;
+		} else if (!strcmp(argv[i], "--listen") && (i + 1 < argc)) {
+			path = argv[++i];
+		} else {
+			display_usage();
+			return MLAN_STATUS_FAILURE;
+		}
+	}
+	if (path)
+		return batch_listen(path, json);
+	return batch_process_stream(stdin, STDOUT_FILENO, json);
+}
+
+/** Trace event names, indexed by the driver mlan_trace_event id */
+static const char *trace_event_name[] = {
+	"-",	   "tx_enqueue", "rx_reorder", "sdio_rd",
+	"sdio_wr", "sdio_rd_mb", "sdio_wr_mb", "sdio_int",
+};
+
+/**
+ *  @brief Compare two trace records by time stamp
+ *
+ *  @param a        A pointer to trace record
+ *  @param b        A pointer to trace record
+ *  @return         Negative, zero or positive like strcmp
+ */
+static int trace_rec_cmp(const void *a, const void *b)
+{
+	const trace_rec *ra = (const trace_rec *)a;
+	const trace_rec *rb = (const trace_rec *)b;
+
+	if (ra->ts != rb->ts)
+		return (ra->ts < rb->ts) ? -1 : 1;
+	if (ra->cpu != rb->cpu)
+		return ra->cpu - rb->cpu;
+	return (ra->seq < rb->seq) ? -1 : (ra->seq > rb->seq);
+}
+
+/**
+ *  @brief Decode a binary dump of the driver trace ring, merging the
+ *  per-CPU records in time order
+ *
+ *  @param argc     Number of arguments
+ *  @param argv     A pointer to arguments array
+ *  @return         MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int process_trace(int argc, char *argv[])
+{
+	FILE *fp = NULL;
+	trace_rec *recs = NULL;
+	trace_rec *tmp = NULL;
+	size_t num = 0, max = 0;
+	size_t i;
+	t_u64 start;
+	const char *name;
+
+	if (argc != 3) {
+		display_usage();
+		return MLAN_STATUS_FAILURE;
+	}
+	fp = fopen(argv[2], "rb");
+	if (!fp) {
+		fprintf(stderr, "mlanutl: Cannot open file %s\n", argv[2]);
+		return MLAN_STATUS_FAILURE;
+	}
+	for (;;) {
+		if (num == max) {
+			max = max ? max * 2 : 1024;
+			tmp = realloc(recs, max * sizeof(trace_rec));
+			if (!tmp) {
+				fprintf(stderr, "mlanutl: Out of memory\n");
+				free(recs);
+				fclose(fp);
+				return MLAN_STATUS_FAILURE;
+			}
+			recs = tmp;
+		}
+		if (fread(&recs[num], sizeof(trace_rec), 1, fp) != 1)
+			break;
+		num++;
+	}
+	fclose(fp);
+
+	qsort(recs, num, sizeof(trace_rec), trace_rec_cmp);
+	start = num ? recs[0].ts : 0;
+	printf("%-14s %-4s %-10s %-12s %-10s %s\n", "time(us)", "cpu", "seq",
+	       "event", "arg0", "arg1");
+	for (i = 0; i < num; i++) {
+		if (recs[i].event < NELEMENTS(trace_event_name))
+			name = trace_event_name[recs[i].event];
+		else
+			name = "unknown";
+		printf("%-14.3f %-4u %-10u %-12s 0x%08x %u\n",
+		       (double)(recs[i].ts - start) / 1000, recs[i].cpu,
+		       recs[i].seq, name, recs[i].arg0, recs[i].arg1);
+	}
+	free(recs);
+	return MLAN_STATUS_SUCCESS;
+}
+
+/**
+ *  @brief Write a monitor ring record to a pcap file
+ *
+ *  @param fp       Output file
+ *  @param rec      A pointer to the ring record
+ *  @return         N/A
+ */
+static void monring_write_rec(FILE *fp, mmap_rec *rec)
+{
+	t_u32 pkt_hdr[4];
+
+	pkt_hdr[0] = rec->ts_sec;
+	pkt_hdr[1] = rec->ts_usec;
+	pkt_hdr[2] = rec->len;
+	pkt_hdr[3] = rec->len;
+	fwrite(pkt_hdr, sizeof(pkt_hdr), 1, fp);
+	fwrite(rec + 1, rec->len, 1, fp);
+}
+
+/**
+ *  @brief Write a CSI ring record, header and CSI report, to a file
+ *
+ *  @param fp       Output file
+ *  @param rec      A pointer to the ring record
+ *  @return         N/A
+ */
+static void csiring_write_rec(FILE *fp, mmap_rec *rec)
+{
+	fwrite(rec, sizeof(*rec) + rec->len, 1, fp);
+}
+
+/**
+ *  @brief Map a driver mmap ring and drain its records into a file
+ *  until the time limit or a signal, then report the record rate and
+ *  losses
+ *
+ *  @param ring_file    Ring proc file
+ *  @param fp           Output file
+ *  @param seconds      Time limit, 0: until interrupted
+ *  @param batch        Records the driver queues before waking us
+ *  @param write_rec    Record writer
+ *  @return             MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int mmap_ring_drain(char *ring_file, FILE *fp, int seconds,
+			   t_u32 batch,
+			   void (*write_rec)(FILE *fp, mmap_rec *rec))
+{
+	volatile mmap_ring_ctrl *ctrl;
+	t_u8 *data;
+	mmap_rec *rec;
+	struct pollfd pfd;
+	struct timeval start, now;
+	long page = sysconf(_SC_PAGESIZE);
+	size_t map_len;
+	t_u32 size, rp, off, next_seq = 0;
+	unsigned long long packets = 0, lost = 0;
+	double secs;
+	int fd;
+	int ret = MLAN_STATUS_SUCCESS;
+
+	fd = open(ring_file, O_RDWR);
+	if (fd < 0) {
+		fprintf(stderr, "mlanutl: Cannot open %s: %s\n", ring_file,
+			strerror(errno));
+		return MLAN_STATUS_FAILURE;
+	}
+	ctrl = mmap(NULL, page, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (ctrl == MAP_FAILED) {
+		fprintf(stderr, "mlanutl: Cannot map %s\n", ring_file);
+		close(fd);
+		return MLAN_STATUS_FAILURE;
+	}
+	size = ctrl->size;
+	munmap((void *)ctrl, page);
+	map_len = page + size;
+	ctrl = mmap(NULL, map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (ctrl == MAP_FAILED) {
+		fprintf(stderr, "mlanutl: Cannot map %s\n", ring_file);
+		close(fd);
+		return MLAN_STATUS_FAILURE;
+	}
+	data = (t_u8 *)ctrl + page;
+	ctrl->wake_batch = batch;
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	gettimeofday(&start, NULL);
+	for (;;) {
+		gettimeofday(&now, NULL);
+		if (seconds && now.tv_sec - start.tv_sec >= seconds)
+			break;
+		/* The timeout picks up records short of a wake batch */
+		if (poll(&pfd, 1, 100) < 0) {
+			if (errno != EINTR)
+				ret = MLAN_STATUS_FAILURE;
+			break;
+		}
+		rp = ctrl->rp;
+		while (rp != ctrl->wp) {
+			/* Pairs with the driver barrier before it writes wp */
+			__sync_synchronize();
+			off = rp & (size - 1);
+			rec = (mmap_rec *)(data + off);
+			if (rec->flags & MMAP_REC_PAD) {
+				rp += size - off;
+				continue;
+			}
+			write_rec(fp, rec);
+			lost += rec->seq - next_seq;
+			next_seq = rec->seq + 1;
+			packets++;
+			rp += (sizeof(*rec) + rec->len + MMAP_REC_ALIGN - 1) &
+			      ~(MMAP_REC_ALIGN - 1);
+		}
+		/* Done with the records before handing the space back */
+		__sync_synchronize();
+		ctrl->rp = rp;
+	}
+
+	gettimeofday(&now, NULL);
+	secs = (now.tv_sec - start.tv_sec) +
+	       (double)(now.tv_usec - start.tv_usec) / 1000000;
+	printf("records: %llu (%.0f/s)\n", packets,
+	       secs > 0 ? packets / secs : 0);
+	printf("lost: %llu, driver dropped: %u\n", lost, ctrl->dropped);
+	munmap((void *)ctrl, map_len);
+	close(fd);
+	return ret;
+}
+
+/**
+ *  @brief Drain the driver monitor ring into a pcap file with radiotap
+ *  link type
+ *
+ *  @param argc     Number of arguments
+ *  @param argv     A pointer to arguments array
+ *  @return         MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int process_monring(int argc, char *argv[])
+{
+	/* pcap file header: magic, version 2.4, snaplen, radiotap link type */
+	t_u32 pcap_hdr[6] = {0xa1b2c3d4, 0x00040002, 0, 0, 65535, 127};
+	FILE *fp;
+	int ret;
+
+	if (argc != 4 && argc != 5) {
+		display_usage();
+		return MLAN_STATUS_FAILURE;
+	}
+	fp = fopen(argv[3], "wb");
+	if (!fp) {
+		fprintf(stderr, "mlanutl: Cannot open file %s\n", argv[3]);
+		return MLAN_STATUS_FAILURE;
+	}
+	fwrite(pcap_hdr, sizeof(pcap_hdr), 1, fp);
+	ret = mmap_ring_drain(argv[2], fp, (argc == 5) ? atoi(argv[4]) : 0, 1,
+			      monring_write_rec);
+	fclose(fp);
+	return ret;
+}
+
+/**
+ *  @brief Drain the driver CSI ring into a file of ring records, each a
+ *  16 byte header (len, flags, seq, ts_sec, ts_usec) and the CSI report
+ *
+ *  @param argc     Number of arguments
+ *  @param argv     A pointer to arguments array
+ *  @return         MLAN_STATUS_SUCCESS for success, otherwise failure
+ */
+static int process_csiring(int argc, char *argv[])
+{
+	FILE *fp;
+	int ret;
+
+	if (argc < 4 || argc > 6) {
+		display_usage();
+		return MLAN_STATUS_FAILURE;
+	}
+	fp = fopen(argv[3], "wb");
+	if (!fp) {
+		fprintf(stderr, "mlanutl: Cannot open file %s\n", argv[3]);
+		return MLAN_STATUS_FAILURE;
+	}
+	ret = mmap_ring_drain(argv[2], fp, (argc >= 5) ? atoi(argv[4]) : 0,
+			      (argc == 6) ? atoi(argv[5]) : 16,
+			      csiring_write_rec);
+	fclose(fp);
+	return ret;
+}
+
 /**
  *  @brief Entry function for mlanutl
  *  @param argc     Number of arguments
@@ -24832,6 +25574,22 @@ int main(int argc, char *argv[])
 		fprintf(stdout, "NXP mlanutl version %s\n", MLANUTL_VER);
 		exit(0);
 	}
+	if ((argc >= 2) && (strcmp(argv[1], "--batch") == 0)) {
+		sockfd = socket(AF_INET, SOCK_STREAM, 0);
+		if (sockfd < 0) {
+			fprintf(stderr, "mlanutl: Cannot open socket.\n");
+			exit(1);
+		}
+		ret = process_batch(argc, argv);
+		close(sockfd);
+		return ret ? 1 : 0;
+	}
+	if ((argc >= 2) && (strcmp(argv[1], "--trace") == 0))
+		return process_trace(argc, argv) ? 1 : 0;
+	if ((argc >= 2) && (strcmp(argv[1], "--monring") == 0))
+		return process_monring(argc, argv) ? 1 : 0;
+	if ((argc >= 2) && (strcmp(argv[1], "--csiring") == 0))
+		return process_csiring(argc, argv) ? 1 : 0;
 	if (argc < 3) {
 		fprintf(stderr, "Invalid number of parameters!\n");
 		display_usage();
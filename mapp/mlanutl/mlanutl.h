@@ -226,6 +226,42 @@ struct eth_priv_data_rate {
 	t_u32 rx_rate_format;
 };
 
+/** statstlv TLV types */
+#define STATS_TLV_SIGNAL 1
+#define STATS_TLV_GETLOG 2
+#define STATS_TLV_DATARATE 3
+
+/** data structure for statstlv response TLV */
+struct eth_priv_stats_tlv {
+	/** TLV type, STATS_TLV_* */
+	t_u16 type;
+	/** Length of value */
+	t_u16 len;
+	/** Value */
+	t_u8 value[];
+} __ATTRIB_PACK__;
+
+/** data structure for statstlv signal TLV */
+struct eth_priv_signal {
+	/** Selector */
+	t_u16 selector;
+	/** RSSI of last/average beacon and data */
+	t_s16 bcn_rssi_last;
+	t_s16 bcn_rssi_avg;
+	t_s16 data_rssi_last;
+	t_s16 data_rssi_avg;
+	/** SNR of last/average beacon and data */
+	t_s16 bcn_snr_last;
+	t_s16 bcn_snr_avg;
+	t_s16 data_snr_last;
+	t_s16 data_snr_avg;
+	/** NF of last/average beacon and data */
+	t_s16 bcn_nf_last;
+	t_s16 bcn_nf_avg;
+	t_s16 data_nf_last;
+	t_s16 data_nf_avg;
+};
+
 /** data structure for cmd getlog */
 struct eth_priv_get_log {
 	/** Multicast transmitted frame count */
@@ -3585,4 +3621,56 @@ typedef struct _host_RobustCoexLteStats_t {
 	unsigned char ResponseType;
 } __ATTRIB_PACK__ host_RobustCoexLteStats_t;
 
+/** Driver trace ring record, read from /proc/mwlan/<adapter>/trace */
+typedef struct _trace_rec {
+	/** Local clock in ns */
+	t_u64 ts;
+	/** Per-CPU sequence number */
+	t_u32 seq;
+	/** Event id */
+	t_u16 event;
+	/** CPU the event was recorded on */
+	t_u16 cpu;
+	/** Event argument 0 */
+	t_u32 arg0;
+	/** Event argument 1 */
+	t_u32 arg1;
+} trace_rec;
+
+/** Driver mmap ring control page, mapped from /proc/mwlan/<adapter>/mon_ring
+ *  or csi_ring */
+typedef struct _mmap_ring_ctrl {
+	/** Size of the record area following the control page */
+	t_u32 size;
+	/** Write offset, advanced by the driver */
+	t_u32 wp;
+	/** Read offset, advanced by the reader */
+	t_u32 rp;
+	/** Records stored */
+	t_u32 packets;
+	/** Records dropped on a full ring */
+	t_u32 dropped;
+	/** Records to queue before the driver wakes the reader */
+	t_u32 wake_batch;
+} mmap_ring_ctrl;
+
+/** Driver mmap ring record header, followed by the payload */
+typedef struct _mmap_rec {
+	/** Length of the payload */
+	t_u16 len;
+	/** Record flags */
+	t_u16 flags;
+	/** Sequence number, dropped records leave a gap */
+	t_u32 seq;
+	/** Receive time, seconds */
+	t_u32 ts_sec;
+	/** Receive time, microseconds */
+	t_u32 ts_usec;
+} mmap_rec;
+
+/** Padding record, the next record starts at the ring head */
+#define MMAP_REC_PAD MBIT(0)
+/** Driver mmap ring record alignment */
+#define MMAP_REC_ALIGN 16
+
 #endif /* _MLANUTL_H_ */
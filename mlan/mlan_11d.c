@@ -757,6 +757,7 @@ t_void wlan_11d_priv_init(mlan_private *pmpriv)
 
 	/* Start in disabled mode */
 	state->enable_11d = DISABLE_11D;
+	wlan_cfp_index_invalidate(pmpriv->adapter);
 	if (!pmpriv->adapter->init_para.cfg_11d)
 		state->user_enable_11d = DEFAULT_11D_STATE;
 	else
@@ -785,6 +786,7 @@ t_void wlan_11d_init(mlan_adapter *pmadapter)
 	       sizeof(parsed_region_chan_11d_t));
 	memset(pmadapter, &(pmadapter->universal_channel), 0,
 	       sizeof(region_chan_t));
+	wlan_cfp_index_invalidate(pmadapter);
 #endif
 	memset(pmadapter, &(pmadapter->domain_reg), 0,
 	       sizeof(wlan_802_11d_domain_reg_t));
@@ -1169,6 +1171,7 @@ mlan_status wlan_11d_set_universaltable(mlan_private *pmpriv, t_u8 band)
 		pmadapter->universal_channel[i].band = BAND_A;
 		i++;
 	}
+	wlan_cfp_index_invalidate(pmadapter);
 
 	LEAVE();
 	return MLAN_STATUS_SUCCESS;
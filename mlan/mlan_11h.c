@@ -1525,47 +1525,27 @@ static const char *DFS_TS_REPR_STRINGS[] = {"", "NOP_start", "CAC_completed"};
 #endif
 
 /**
- *  @brief Search for a dfs timestamp in the list with desired channel.
+ *  @brief Get the dfs timestamp of a channel.
  *
- *  Assumes there will only be one timestamp per channel in the list.
+ *  There is one timestamp entry per channel in the table.
  *
  *  @param pmadapter  Pointer to mlan_adapter
  *  @param channel    Channel number
  *
- *  @return           Pointer to timestamp if found, or MNULL
+ *  @return           Pointer to timestamp if in use, or MNULL
  */
 static wlan_dfs_timestamp_t *
 wlan_11h_find_dfs_timestamp(mlan_adapter *pmadapter, t_u8 channel)
 {
-	wlan_dfs_timestamp_t *pts = MNULL, *pts_found = MNULL;
+	wlan_dfs_timestamp_t *pts = &pmadapter->state_dfs.dfs_ts[channel];
 
-	ENTER();
-	pts = (wlan_dfs_timestamp_t *)util_peek_list(
-		pmadapter->pmoal_handle, &pmadapter->state_dfs.dfs_ts_head,
-		MNULL, MNULL);
-
-	while (pts && pts != (wlan_dfs_timestamp_t *)&pmadapter->state_dfs
-				      .dfs_ts_head) {
-		PRINTM(MINFO,
-		       "dfs_timestamp(@ %p) - chan=%d, repr=%d(%s),"
-		       " time(sec.usec)=%lu.%06lu\n",
-		       pts, pts->channel, pts->represents,
-		       DFS_TS_REPR_STRINGS[pts->represents], pts->ts_sec,
-		       pts->ts_usec);
-
-		if (pts->channel == channel) {
-			pts_found = pts;
-			break;
-		}
-		pts = pts->pnext;
-	}
-
-	LEAVE();
-	return pts_found;
+	if (pts->represents == DFS_TS_REPR_NOT_IN_USE)
+		return MNULL;
+	return pts;
 }
 
 /**
- *  @brief Removes dfs timestamp from list.
+ *  @brief Removes dfs timestamp from the table.
  *
  *  @param pmadapter  Pointer to mlan_adapter
  *  @param pdfs_ts    Pointer to dfs_timestamp to remove
@@ -1574,63 +1554,48 @@ static t_void wlan_11h_remove_dfs_timestamp(mlan_adapter *pmadapter,
 					    wlan_dfs_timestamp_t *pdfs_ts)
 {
 	ENTER();
-	/* dequeue and delete timestamp */
-	util_unlink_list(pmadapter->pmoal_handle,
-			 &pmadapter->state_dfs.dfs_ts_head,
-			 (pmlan_linked_list)pdfs_ts, MNULL, MNULL);
-	pmadapter->callbacks.moal_mfree(pmadapter->pmoal_handle,
-					(t_u8 *)pdfs_ts);
+	if (pdfs_ts->represents == DFS_TS_REPR_NOP_START &&
+	    pmadapter->state_dfs.dfs_nop_count)
+		pmadapter->state_dfs.dfs_nop_count--;
+	memset(pmadapter, (t_u8 *)pdfs_ts, 0, sizeof(wlan_dfs_timestamp_t));
 	LEAVE();
 }
 
 /**
- *  @brief Add a dfs timestamp to the list
+ *  @brief Add a dfs timestamp to the table
  *
- *  Assumes there will only be one timestamp per channel in the list,
- *  and that timestamp modes (represents) are mutually exclusive.
+ *  Timestamp modes (represents) are mutually exclusive; a new timestamp
+ *  replaces the one already kept for the channel.
  *
  *  @param pmadapter  Pointer to mlan_adapter
  *  @param repr       Timestamp 'represents' value (see _dfs_timestamp_repr_e)
  *  @param channel    Channel number
  *
- *  @return           Pointer to timestamp if found, or MNULL
+ *  @return           MLAN_STATUS_SUCCESS
  */
 static mlan_status wlan_11h_add_dfs_timestamp(mlan_adapter *pmadapter,
 					      t_u8 repr, t_u8 channel)
 {
-	wlan_dfs_timestamp_t *pdfs_ts = MNULL;
+	wlan_dfs_device_state_t *pstate_dfs = &pmadapter->state_dfs;
+	wlan_dfs_timestamp_t *pdfs_ts = &pstate_dfs->dfs_ts[channel];
 	mlan_status ret = MLAN_STATUS_SUCCESS;
 
 	ENTER();
-	pdfs_ts = wlan_11h_find_dfs_timestamp(pmadapter, channel);
-
-	if (!pdfs_ts) {
-		/* need to allocate new timestamp */
-		ret = pmadapter->callbacks.moal_malloc(
-			pmadapter->pmoal_handle, sizeof(wlan_dfs_timestamp_t),
-			MLAN_MEM_DEF, (t_u8 **)&pdfs_ts);
-		if ((ret != MLAN_STATUS_SUCCESS) || !pdfs_ts) {
-			PRINTM(MERROR, "%s(): Could not allocate dfs_ts\n",
-			       __func__);
-			LEAVE();
-			return MLAN_STATUS_FAILURE;
-		}
-
-		memset(pmadapter, (t_u8 *)pdfs_ts, 0,
-		       sizeof(wlan_dfs_timestamp_t));
-
-		util_enqueue_list_tail(pmadapter->pmoal_handle,
-				       &pmadapter->state_dfs.dfs_ts_head,
-				       (pmlan_linked_list)pdfs_ts, MNULL,
-				       MNULL);
-		pdfs_ts->channel = channel;
-	}
-	/* (else, use existing timestamp for channel; see assumptions above) */
+	if (pdfs_ts->represents == DFS_TS_REPR_NOP_START &&
+	    pstate_dfs->dfs_nop_count)
+		pstate_dfs->dfs_nop_count--;
 
 	/* update params */
+	pdfs_ts->channel = channel;
 	pmadapter->callbacks.moal_get_system_time(
 		pmadapter->pmoal_handle, &pdfs_ts->ts_sec, &pdfs_ts->ts_usec);
 	pdfs_ts->represents = repr;
+	if (repr == DFS_TS_REPR_NOP_START) {
+		if (!pstate_dfs->dfs_nop_count ||
+		    pdfs_ts->ts_sec < pstate_dfs->dfs_nop_oldest_sec)
+			pstate_dfs->dfs_nop_oldest_sec = pdfs_ts->ts_sec;
+		pstate_dfs->dfs_nop_count++;
+	}
 
 	PRINTM(MCMD_D,
 	       "11h: add/update dfs_timestamp - chan=%d, repr=%d(%s),"
@@ -1643,6 +1608,78 @@ static mlan_status wlan_11h_add_dfs_timestamp(mlan_adapter *pmadapter,
 	return ret;
 }
 
+/**
+ *  @brief Get the NOP (Non-Occupancy Period) in seconds
+ *
+ *  @param pmadapter  Pointer to mlan_adapter
+ *
+ *  @return           NOP in seconds
+ */
+static t_u32 wlan_11h_get_nop_period(mlan_adapter *pmadapter)
+{
+#ifdef DFS_TESTING_SUPPORT
+	if (pmadapter->dfs_test_params.user_nop_period_sec) {
+		PRINTM(MCMD_D, "dfs_testing - user NOP period=%d (sec)\n",
+		       pmadapter->dfs_test_params.user_nop_period_sec);
+		return pmadapter->dfs_test_params.user_nop_period_sec;
+	}
+#endif
+	return WLAN_11H_NON_OCCUPANCY_PERIOD;
+}
+
+/**
+ *  @brief Expire the NOP timestamps whose period has passed
+ *
+ *  The table is only walked once the oldest NOP start time is due, so
+ *  channel queries in between cost one comparison.
+ *
+ *  @param pmadapter  Pointer to mlan_adapter
+ *
+ *  @return           N/A
+ */
+static t_void wlan_11h_expire_nop(mlan_adapter *pmadapter)
+{
+	wlan_dfs_device_state_t *pstate_dfs = &pmadapter->state_dfs;
+	wlan_dfs_timestamp_t *pdfs_ts;
+	mlan_private *priv;
+	t_u32 now_sec, now_usec, period;
+	t_u32 oldest_sec = 0;
+	t_u16 nop_count = 0;
+	int i;
+
+	if (!pstate_dfs->dfs_nop_count)
+		return;
+	pmadapter->callbacks.moal_get_system_time(pmadapter->pmoal_handle,
+						  &now_sec, &now_usec);
+	period = wlan_11h_get_nop_period(pmadapter);
+	if ((now_sec - pstate_dfs->dfs_nop_oldest_sec) <= period)
+		return;
+
+	ENTER();
+	priv = wlan_get_priv(pmadapter, MLAN_BSS_ROLE_ANY);
+	for (i = 0; i < DFS_TS_CHAN_NUM; i++) {
+		pdfs_ts = &pstate_dfs->dfs_ts[i];
+		if (pdfs_ts->represents != DFS_TS_REPR_NOP_START)
+			continue;
+		if ((now_sec - pdfs_ts->ts_sec) <= period) {
+			if (!nop_count || pdfs_ts->ts_sec < oldest_sec)
+				oldest_sec = pdfs_ts->ts_sec;
+			nop_count++;
+			continue;
+		}
+		/* entry is expired, remove it */
+		PRINTM(MCMD_D, "11h: NOP expired on channel %d\n",
+		       pdfs_ts->channel);
+		wlan_11h_remove_dfs_timestamp(pmadapter, pdfs_ts);
+		if (priv)
+			wlan_set_chan_dfs_state(priv, BAND_A, (t_u8)i,
+						DFS_USABLE);
+	}
+	pstate_dfs->dfs_nop_count = nop_count;
+	pstate_dfs->dfs_nop_oldest_sec = oldest_sec;
+	LEAVE();
+}
+
 /********************************************************
 			Global functions
 ********************************************************/
@@ -1917,7 +1954,9 @@ t_void wlan_11h_init(mlan_adapter *adapter)
 	pstate_dfs->dfs_radar_found = MFALSE;
 	pstate_dfs->dfs_check_channel = 0;
 	pstate_dfs->dfs_report_time_sec = 0;
-	util_init_list((pmlan_linked_list)&pstate_dfs->dfs_ts_head);
+	memset(adapter, pstate_dfs->dfs_ts, 0, sizeof(pstate_dfs->dfs_ts));
+	pstate_dfs->dfs_nop_count = 0;
+	pstate_dfs->dfs_nop_oldest_sec = 0;
 
 	/* Initialize RDH struct */
 	pstate_rdh->stage = RDH_OFF;
@@ -1961,27 +2000,24 @@ t_void wlan_11h_cleanup(mlan_adapter *adapter)
 	wlan_dfs_device_state_t *pstate_dfs = &adapter->state_dfs;
 	wlan_dfs_timestamp_t *pdfs_ts;
 	mlan_private *priv = MNULL;
+	int i;
 
 	ENTER();
 
-	/* cleanup dfs_timestamp list */
-	pdfs_ts = (wlan_dfs_timestamp_t *)util_peek_list(
-		adapter->pmoal_handle, &pstate_dfs->dfs_ts_head, MNULL, MNULL);
-	while (pdfs_ts) {
-		util_unlink_list(adapter->pmoal_handle,
-				 &pstate_dfs->dfs_ts_head,
-				 (pmlan_linked_list)pdfs_ts, MNULL, MNULL);
-		priv = wlan_get_priv(adapter, MLAN_BSS_ROLE_ANY);
+	/* cleanup dfs_timestamp table */
+	priv = wlan_get_priv(adapter, MLAN_BSS_ROLE_ANY);
+	for (i = 0; i < DFS_TS_CHAN_NUM; i++) {
+		pdfs_ts = &pstate_dfs->dfs_ts[i];
+		if (pdfs_ts->represents == DFS_TS_REPR_NOT_IN_USE)
+			continue;
 		if (priv)
 			wlan_set_chan_dfs_state(priv, BAND_A, pdfs_ts->channel,
 						DFS_USABLE);
-		adapter->callbacks.moal_mfree(adapter->pmoal_handle,
-					      (t_u8 *)pdfs_ts);
-
-		pdfs_ts = (wlan_dfs_timestamp_t *)util_peek_list(
-			adapter->pmoal_handle, &pstate_dfs->dfs_ts_head, MNULL,
-			MNULL);
+		memset(adapter, (t_u8 *)pdfs_ts, 0,
+		       sizeof(wlan_dfs_timestamp_t));
 	}
+	pstate_dfs->dfs_nop_count = 0;
+	pstate_dfs->dfs_nop_oldest_sec = 0;
 
 	LEAVE();
 }
@@ -3128,6 +3164,70 @@ mlan_status wlan_11h_ioctl_chan_dfs_state(pmlan_adapter pmadapter,
 	return ret;
 }
 
+/**
+ *  @brief 802.11h DFS state of all DFS channels
+ *
+ *  @param pmadapter    Pointer to mlan_adapter
+ *  @param pioctl_req   Pointer to mlan_ioctl_req
+ *
+ *  @return MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+mlan_status wlan_11h_ioctl_chan_dfs_state_map(pmlan_adapter pmadapter,
+					      pmlan_ioctl_req pioctl_req)
+{
+	pmlan_private priv = pmadapter->priv[pioctl_req->bss_index];
+	mlan_ds_11h_dfs_state_map *map = MNULL;
+	mlan_ds_11h_chan_dfs_state *pstate = MNULL;
+	region_chan_t *chn_tbl = MNULL;
+	chan_freq_power_t *pcfp = MNULL;
+	int i;
+
+	ENTER();
+
+	if (pioctl_req->action != MLAN_ACT_GET) {
+		pioctl_req->status_code = MLAN_ERROR_IOCTL_INVALID;
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
+	}
+	map = &((mlan_ds_11h_cfg *)pioctl_req->pbuf)->param.dfs_state_map;
+	map->num_chan = 0;
+
+	/* Drop expired NOPs so their channels report the new state */
+	wlan_11h_expire_nop(pmadapter);
+
+	/*get the channel table first*/
+	for (i = 0; i < MAX_REGION_CHANNEL_NUM; i++) {
+		if (pmadapter->region_channel[i].band == BAND_A) {
+			chn_tbl = &pmadapter->region_channel[i];
+			break;
+		}
+	}
+	if (!chn_tbl || !chn_tbl->pcfp)
+		goto done;
+
+	for (i = 0; i < chn_tbl->num_cfp &&
+		    map->num_chan < MAX_DFS_STATE_MAP_CHAN;
+	     i++) {
+		pcfp = &chn_tbl->pcfp[i];
+		if (!pcfp->passive_scan_or_radar_detect)
+			continue;
+		/* Same exception as wlan_11h_radar_detect_required() */
+		if (priv->media_connected == MTRUE &&
+		    priv->curr_bss_params.bss_descriptor.channel ==
+			    pcfp->channel)
+			continue;
+		pstate = &map->chan[map->num_chan++];
+		pstate->channel = (t_u8)pcfp->channel;
+		pstate->dfs_required = MTRUE;
+		pstate->dfs_state = pcfp->dynamic.dfs_state;
+	}
+	PRINTM(MCMND, "11h: DFS state map of %d channels\n", map->num_chan);
+
+done:
+	LEAVE();
+	return MLAN_STATUS_SUCCESS;
+}
+
 /**
  *  @brief 802.11h DFS chan report
  *
@@ -3172,45 +3272,15 @@ mlan_status wlan_11h_ioctl_dfs_chan_report(mlan_private *priv,
 t_bool wlan_11h_is_channel_under_nop(mlan_adapter *pmadapter, t_u8 channel)
 {
 	wlan_dfs_timestamp_t *pdfs_ts = MNULL;
-	t_u32 now_sec, now_usec;
 	t_bool ret = MFALSE;
-	mlan_private *priv;
 	ENTER();
+	wlan_11h_expire_nop(pmadapter);
 	pdfs_ts = wlan_11h_find_dfs_timestamp(pmadapter, channel);
 
-	if (pdfs_ts && (pdfs_ts->channel == channel) &&
-	    (pdfs_ts->represents == DFS_TS_REPR_NOP_START)) {
-		/* found NOP_start timestamp entry on channel */
-		pmadapter->callbacks.moal_get_system_time(
-			pmadapter->pmoal_handle, &now_sec, &now_usec);
-#ifdef DFS_TESTING_SUPPORT
-		if (pmadapter->dfs_test_params.user_nop_period_sec) {
-			PRINTM(MCMD_D,
-			       "dfs_testing - user NOP period=%d (sec)\n",
-			       pmadapter->dfs_test_params.user_nop_period_sec);
-			if ((now_sec - pdfs_ts->ts_sec) <=
-			    pmadapter->dfs_test_params.user_nop_period_sec) {
-				ret = MTRUE;
-			}
-		} else
-#endif
-		{
-			if ((now_sec - pdfs_ts->ts_sec) <=
-			    WLAN_11H_NON_OCCUPANCY_PERIOD)
-				ret = MTRUE;
-		}
-
-		/* if entry is expired, remove it */
-		if (!ret) {
-			wlan_11h_remove_dfs_timestamp(pmadapter, pdfs_ts);
-			priv = wlan_get_priv(pmadapter, MLAN_BSS_ROLE_ANY);
-			if (priv)
-				wlan_set_chan_dfs_state(priv, BAND_A, channel,
-							DFS_USABLE);
-		} else
-			PRINTM(MMSG,
-			       "11h: channel %d is under NOP - can't use.\n",
-			       channel);
+	if (pdfs_ts && (pdfs_ts->represents == DFS_TS_REPR_NOP_START)) {
+		ret = MTRUE;
+		PRINTM(MMSG, "11h: channel %d is under NOP - can't use.\n",
+		       channel);
 	}
 
 	LEAVE();
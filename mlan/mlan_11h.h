@@ -157,6 +157,8 @@ extern mlan_status wlan_11h_ioctl_chan_switch_count(pmlan_adapter pmadapter,
 						    pmlan_ioctl_req pioctl_req);
 
 /** get/set channel dfs state */
+mlan_status wlan_11h_ioctl_chan_dfs_state_map(pmlan_adapter pmadapter,
+					      pmlan_ioctl_req pioctl_req);
 mlan_status wlan_11h_ioctl_chan_dfs_state(pmlan_adapter pmadapter,
 					  pmlan_ioctl_req pioctl_req);
 
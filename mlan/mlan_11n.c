@@ -2997,7 +2997,10 @@ int wlan_get_rxreorder_tbl(mlan_private *priv, rx_reorder_tbl *buf)
 
 		ptbl->amsdu = rx_reorder_tbl_ptr->amsdu;
 		for (i = 0; i < rx_reorder_tbl_ptr->win_size; ++i) {
-			if (rx_reorder_tbl_ptr->rx_reorder_ptr[i])
+			if (wlan_11n_reorder_slot_used(
+				    rx_reorder_tbl_ptr,
+				    wlan_11n_reorder_slot(rx_reorder_tbl_ptr,
+							  i)))
 				ptbl->buffer[i] = MTRUE;
 			else
 				ptbl->buffer[i] = MFALSE;
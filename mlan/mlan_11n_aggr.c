@@ -302,8 +302,7 @@ mlan_status wlan_11n_deaggregate_pkt(mlan_private *priv, pmlan_buffer pmbuf)
 		daggr_mbuf->bss_index = pmbuf->bss_index;
 		daggr_mbuf->buf_type = pmbuf->buf_type;
 		daggr_mbuf->data_len = pkt_len;
-		daggr_mbuf->in_ts_sec = pmbuf->in_ts_sec;
-		daggr_mbuf->in_ts_usec = pmbuf->in_ts_usec;
+		daggr_mbuf->in_ts_nsec = pmbuf->in_ts_nsec;
 		daggr_mbuf->pparent = pmbuf;
 		daggr_mbuf->priority = pmbuf->priority;
 		memcpy_ext(pmadapter,
@@ -434,8 +433,7 @@ int wlan_11n_aggregate_pkt(mlan_private *priv, raListTbl *pra_list,
 		pmbuf_aggr->priority = pmbuf_src->priority;
 		pmbuf_aggr->pbuf = data;
 		pmbuf_aggr->data_offset = 0;
-		pmbuf_aggr->in_ts_sec = pmbuf_src->in_ts_sec;
-		pmbuf_aggr->in_ts_usec = pmbuf_src->in_ts_usec;
+		pmbuf_aggr->in_ts_nsec = pmbuf_src->in_ts_nsec;
 		if (pmbuf_src->flags & MLAN_BUF_FLAG_TDLS)
 			pmbuf_aggr->flags |= MLAN_BUF_FLAG_TDLS;
 		if (pmbuf_src->flags & MLAN_BUF_FLAG_TCP_ACK)
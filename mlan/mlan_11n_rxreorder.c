@@ -124,7 +124,53 @@ static mlan_status wlan_11n_dispatch_pkt(t_void *priv, t_void *payload,
 }
 
 /**
- *  @brief This function restarts the reordering timeout timer
+ *  @brief This function returns the current time in milliseconds
+ *
+ *  @param pmadapter        A pointer to mlan_adapter
+ *
+ *  @return                 Time in ms, wraps around
+ */
+static t_u32 wlan_11n_rxreorder_now_ms(pmlan_adapter pmadapter)
+{
+	t_u32 sec = 0, usec = 0;
+
+	pmadapter->callbacks.moal_get_system_time(pmadapter->pmoal_handle,
+						  &sec, &usec);
+	return sec * 1000 + usec / 1000;
+}
+
+/**
+ *  @brief This function arms the adapter reorder timer if the given
+ *         deadline is earlier than the one it is armed for.
+ *         Caller must hold prxreorder_lock.
+ *
+ *  @param pmadapter        A pointer to mlan_adapter
+ *  @param expiry           Deadline in ms
+ *  @param now              Current time in ms
+ *
+ *  @return                 N/A
+ */
+static void wlan_11n_rxreorder_timer_arm(pmlan_adapter pmadapter,
+					 t_u32 expiry, t_u32 now)
+{
+	t_s32 timeout = (t_s32)(expiry - now);
+
+	if (pmadapter->rxreorder_timer_is_set &&
+	    (t_s32)(expiry - pmadapter->rxreorder_timer_expiry) >= 0)
+		return;
+	if (timeout <= 0)
+		timeout = 1;
+	pmadapter->rxreorder_timer_expiry = expiry;
+	pmadapter->rxreorder_timer_is_set = MTRUE;
+	pmadapter->callbacks.moal_start_timer(pmadapter->pmoal_handle,
+					      pmadapter->prxreorder_timer,
+					      MFALSE, (t_u32)timeout);
+}
+
+/**
+ *  @brief This function restarts the reordering timeout of a table.
+ *         Only the table deadline is updated; the shared adapter timer
+ *         is re-armed only when the new deadline is the earliest one.
  *
  *  @param pmadapter        A pointer to mlan_adapter
  *  @param rx_reor_tbl_ptr  A pointer to structure RxReorderTbl
@@ -135,6 +181,7 @@ static void mlan_11n_rxreorder_timer_restart(pmlan_adapter pmadapter,
 					     RxReorderTbl *rx_reor_tbl_ptr)
 {
 	t_u16 min_flush_time = 0;
+	t_u32 now;
 	ENTER();
 
 	if (rx_reor_tbl_ptr->win_size >= 32)
@@ -142,19 +189,130 @@ static void mlan_11n_rxreorder_timer_restart(pmlan_adapter pmadapter,
 	else
 		min_flush_time = MIN_FLUSH_TIMER_MS;
 
-	if (rx_reor_tbl_ptr->timer_context.timer_is_set)
-		pmadapter->callbacks.moal_stop_timer(
-			pmadapter->pmoal_handle,
-			rx_reor_tbl_ptr->timer_context.timer);
-
-	pmadapter->callbacks.moal_start_timer(
-		pmadapter->pmoal_handle, rx_reor_tbl_ptr->timer_context.timer,
-		MFALSE, (rx_reor_tbl_ptr->win_size * min_flush_time));
-
+	now = wlan_11n_rxreorder_now_ms(pmadapter);
+	pmadapter->callbacks.moal_spin_lock(pmadapter->pmoal_handle,
+					    pmadapter->prxreorder_lock);
+	rx_reor_tbl_ptr->timer_context.expiry =
+		now + rx_reor_tbl_ptr->win_size * min_flush_time;
 	rx_reor_tbl_ptr->timer_context.timer_is_set = MTRUE;
+	wlan_11n_rxreorder_timer_arm(
+		pmadapter, rx_reor_tbl_ptr->timer_context.expiry, now);
+	pmadapter->callbacks.moal_spin_unlock(pmadapter->pmoal_handle,
+					      pmadapter->prxreorder_lock);
 	LEAVE();
 }
 
+/**
+ *  @brief This function detaches the packets of the first count slots of
+ *         the reorder window and advances the window by count slots.
+ *         Caller must hold rx_pkt_lock.
+ *
+ *  @param rx_reor_tbl_ptr  A pointer to structure RxReorderTbl
+ *  @param count            Number of slots, at most win_size
+ *
+ *  @return                 List of detached packets linked through pnext
+ */
+static pmlan_buffer wlan_11n_reorder_take(RxReorderTbl *rx_reor_tbl_ptr,
+					  int count)
+{
+	pmlan_buffer head = MNULL, tail = MNULL, pmbuf;
+	int slot = rx_reor_tbl_ptr->win_base;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		/* Skip empty bitmap words at once */
+		if (!(slot & 31) && (count - i) >= 32 &&
+		    (rx_reor_tbl_ptr->win_size - slot) >= 32 &&
+		    !rx_reor_tbl_ptr->rx_reorder_bitmap[slot >> 5]) {
+			i += 31;
+			slot += 32;
+			if (slot >= rx_reor_tbl_ptr->win_size)
+				slot = 0;
+			continue;
+		}
+		if (wlan_11n_reorder_slot_used(rx_reor_tbl_ptr, slot)) {
+			pmbuf = (pmlan_buffer)
+					rx_reor_tbl_ptr->rx_reorder_ptr[slot];
+			rx_reor_tbl_ptr->rx_reorder_ptr[slot] = MNULL;
+			rx_reor_tbl_ptr->rx_reorder_bitmap[slot >> 5] &=
+				~MBIT(slot & 31);
+			/* Nothing to hand up for packets dropped in FW */
+			if (pmbuf != (pmlan_buffer)RX_PKT_DROPPED_IN_FW) {
+				pmbuf->pnext = MNULL;
+				if (tail)
+					tail->pnext = pmbuf;
+				else
+					head = pmbuf;
+				tail = pmbuf;
+			}
+		}
+		if (++slot >= rx_reor_tbl_ptr->win_size)
+			slot = 0;
+	}
+	rx_reor_tbl_ptr->win_base = slot;
+	return head;
+}
+
+/**
+ *  @brief This function hands a list of in-order packets to the upper
+ *         layer
+ *
+ *  @param priv             A pointer to mlan_private
+ *  @param pmbuf            List of packets linked through pnext
+ *  @param rx_reor_tbl_ptr  A pointer to structure RxReorderTbl
+ *
+ *  @return                 N/A
+ */
+static void wlan_11n_dispatch_pkt_list(t_void *priv, pmlan_buffer pmbuf,
+				       RxReorderTbl *rx_reor_tbl_ptr)
+{
+	pmlan_buffer pnext;
+
+	while (pmbuf) {
+		pnext = pmbuf->pnext;
+		pmbuf->pnext = MNULL;
+		wlan_11n_dispatch_pkt(priv, pmbuf, rx_reor_tbl_ptr);
+		pmbuf = pnext;
+	}
+}
+
+/**
+ *  @brief This function returns the number of consecutive filled slots
+ *         from start_win, searching the occupancy bitmap word by word.
+ *         Caller must hold rx_pkt_lock.
+ *
+ *  @param rx_reor_tbl_ptr  A pointer to structure RxReorderTbl
+ *
+ *  @return                 Length of the in-order run
+ */
+static int wlan_11n_reorder_run_len(RxReorderTbl *rx_reor_tbl_ptr)
+{
+	int win_size = rx_reor_tbl_ptr->win_size;
+	int slot = rx_reor_tbl_ptr->win_base;
+	int len = 0, bits;
+	t_u32 word;
+
+	while (len < win_size) {
+		/* Bits of this word that belong to the ring */
+		bits = 32 - (slot & 31);
+		if (bits > win_size - slot)
+			bits = win_size - slot;
+		word = rx_reor_tbl_ptr->rx_reorder_bitmap[slot >> 5] >>
+		       (slot & 31);
+		if (bits < 32)
+			word |= ~(MBIT(bits) - 1);
+		if (word != 0xffffffff) {
+			len += util_ffz32(word);
+			return MIN(len, win_size);
+		}
+		len += bits;
+		slot += bits;
+		if (slot >= win_size)
+			slot = 0;
+	}
+	return win_size;
+}
+
 /**
  *  @brief This function dispatches all the packets in the buffer.
  *         There could be holes in the buffer.
@@ -168,9 +326,9 @@ static void mlan_11n_rxreorder_timer_restart(pmlan_adapter pmadapter,
 static mlan_status wlan_11n_dispatch_pkt_until_start_win(
 	t_void *priv, RxReorderTbl *rx_reor_tbl_ptr, int start_win)
 {
-	int no_pkt_to_send, i, xchg;
+	int no_pkt_to_send;
 	mlan_status ret = MLAN_STATUS_SUCCESS;
-	void *rx_tmp_ptr = MNULL;
+	pmlan_buffer pmbuf_list;
 	mlan_private *pmpriv = (mlan_private *)priv;
 
 	ENTER();
@@ -180,38 +338,15 @@ static mlan_status wlan_11n_dispatch_pkt_until_start_win(
 				     rx_reor_tbl_ptr->win_size) :
 				 rx_reor_tbl_ptr->win_size;
 
-	for (i = 0; i < no_pkt_to_send; ++i) {
-		pmpriv->adapter->callbacks.moal_spin_lock(
-			pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
-		rx_tmp_ptr = MNULL;
-		if (rx_reor_tbl_ptr->rx_reorder_ptr[i]) {
-			rx_tmp_ptr = rx_reor_tbl_ptr->rx_reorder_ptr[i];
-			rx_reor_tbl_ptr->rx_reorder_ptr[i] = MNULL;
-		}
-		pmpriv->adapter->callbacks.moal_spin_unlock(
-			pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
-		if (rx_tmp_ptr)
-			wlan_11n_dispatch_pkt(priv, rx_tmp_ptr,
-					      rx_reor_tbl_ptr);
-	}
-
 	pmpriv->adapter->callbacks.moal_spin_lock(pmpriv->adapter->pmoal_handle,
 						  pmpriv->rx_pkt_lock);
-	/*
-	 * We don't have a circular buffer, hence use rotation to simulate
-	 * circular buffer
-	 */
-	xchg = rx_reor_tbl_ptr->win_size - no_pkt_to_send;
-	for (i = 0; i < xchg; ++i) {
-		rx_reor_tbl_ptr->rx_reorder_ptr[i] =
-			rx_reor_tbl_ptr->rx_reorder_ptr[no_pkt_to_send + i];
-		rx_reor_tbl_ptr->rx_reorder_ptr[no_pkt_to_send + i] = MNULL;
-	}
-
+	pmbuf_list = wlan_11n_reorder_take(rx_reor_tbl_ptr, no_pkt_to_send);
 	rx_reor_tbl_ptr->start_win = start_win;
 	pmpriv->adapter->callbacks.moal_spin_unlock(
 		pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
 
+	wlan_11n_dispatch_pkt_list(priv, pmbuf_list, rx_reor_tbl_ptr);
+
 	LEAVE();
 	return ret;
 }
@@ -248,49 +383,27 @@ static t_void wlan_11n_display_tbl_ptr(pmlan_adapter pmadapter,
 static mlan_status wlan_11n_scan_and_dispatch(t_void *priv,
 					      RxReorderTbl *rx_reor_tbl_ptr)
 {
-	int i, j, xchg;
+	int run;
 	mlan_status ret = MLAN_STATUS_SUCCESS;
-	void *rx_tmp_ptr = MNULL;
+	pmlan_buffer pmbuf_list = MNULL;
 	mlan_private *pmpriv = (mlan_private *)priv;
 
 	ENTER();
 
-	for (i = 0; i < rx_reor_tbl_ptr->win_size; ++i) {
-		pmpriv->adapter->callbacks.moal_spin_lock(
-			pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
-		if (!rx_reor_tbl_ptr->rx_reorder_ptr[i]) {
-			pmpriv->adapter->callbacks.moal_spin_unlock(
-				pmpriv->adapter->pmoal_handle,
-				pmpriv->rx_pkt_lock);
-			break;
-		}
-		rx_tmp_ptr = rx_reor_tbl_ptr->rx_reorder_ptr[i];
-		rx_reor_tbl_ptr->rx_reorder_ptr[i] = MNULL;
-		pmpriv->adapter->callbacks.moal_spin_unlock(
-			pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
-		wlan_11n_dispatch_pkt(priv, rx_tmp_ptr, rx_reor_tbl_ptr);
-	}
-
 	pmpriv->adapter->callbacks.moal_spin_lock(pmpriv->adapter->pmoal_handle,
 						  pmpriv->rx_pkt_lock);
-	/*
-	 * We don't have a circular buffer, hence use rotation to simulate
-	 * circular buffer
-	 */
-	if (i > 0) {
-		xchg = rx_reor_tbl_ptr->win_size - i;
-		for (j = 0; j < xchg; ++j) {
-			rx_reor_tbl_ptr->rx_reorder_ptr[j] =
-				rx_reor_tbl_ptr->rx_reorder_ptr[i + j];
-			rx_reor_tbl_ptr->rx_reorder_ptr[i + j] = MNULL;
-		}
+	run = wlan_11n_reorder_run_len(rx_reor_tbl_ptr);
+	if (run > 0) {
+		pmbuf_list = wlan_11n_reorder_take(rx_reor_tbl_ptr, run);
+		rx_reor_tbl_ptr->start_win =
+			(rx_reor_tbl_ptr->start_win + run) &
+			(MAX_TID_VALUE - 1);
 	}
-
-	rx_reor_tbl_ptr->start_win =
-		(rx_reor_tbl_ptr->start_win + i) & (MAX_TID_VALUE - 1);
-
 	pmpriv->adapter->callbacks.moal_spin_unlock(
 		pmpriv->adapter->pmoal_handle, pmpriv->rx_pkt_lock);
+
+	/* Hand the whole in-order run up in one pass */
+	wlan_11n_dispatch_pkt_list(priv, pmbuf_list, rx_reor_tbl_ptr);
 	LEAVE();
 	return ret;
 }
@@ -322,24 +435,13 @@ static t_void wlan_11n_delete_rxreorder_tbl_entry(mlan_private *priv,
 		(rx_reor_tbl_ptr->start_win + rx_reor_tbl_ptr->win_size) &
 			(MAX_TID_VALUE - 1));
 
-	if (rx_reor_tbl_ptr->timer_context.timer) {
-		if (rx_reor_tbl_ptr->timer_context.timer_is_set) {
-			priv->adapter->callbacks.moal_stop_timer(
-				pmadapter->pmoal_handle,
-				rx_reor_tbl_ptr->timer_context.timer);
-			rx_reor_tbl_ptr->timer_context.timer_is_set = MFALSE;
-		}
-		priv->adapter->callbacks.moal_free_timer(
-			pmadapter->pmoal_handle,
-			rx_reor_tbl_ptr->timer_context.timer);
-		rx_reor_tbl_ptr->timer_context.timer = MNULL;
-	}
-
 	PRINTM(MDAT_D, "Delete rx_reor_tbl_ptr: %p\n", rx_reor_tbl_ptr);
+	/* Once unlinked the adapter reorder timer no longer sees the entry */
 	util_unlink_list(pmadapter->pmoal_handle, &priv->rx_reorder_tbl_ptr,
 			 (pmlan_linked_list)rx_reor_tbl_ptr,
 			 pmadapter->callbacks.moal_spin_lock,
 			 pmadapter->callbacks.moal_spin_unlock);
+	rx_reor_tbl_ptr->timer_context.timer_is_set = MFALSE;
 
 	pmadapter->callbacks.moal_mfree(
 		pmadapter->pmoal_handle,
@@ -364,7 +466,9 @@ static int wlan_11n_find_last_seqnum(RxReorderTbl *rx_reorder_tbl_ptr)
 
 	ENTER();
 	for (i = (rx_reorder_tbl_ptr->win_size - 1); i >= 0; --i) {
-		if (rx_reorder_tbl_ptr->rx_reorder_ptr[i]) {
+		if (wlan_11n_reorder_slot_used(
+			    rx_reorder_tbl_ptr,
+			    wlan_11n_reorder_slot(rx_reorder_tbl_ptr, i))) {
 			LEAVE();
 			return i;
 		}
@@ -402,22 +506,72 @@ static t_void wlan_start_flush_data(mlan_private *priv,
 }
 
 /**
- *  @brief This function set the flag to flushes data
+ *  @brief This function handles the adapter reorder timer. It sets the
+ *         flush flag on every table whose deadline has passed and
+ *         re-arms the timer for the earliest remaining deadline.
  *
- *  @param context      Reorder context pointer
+ *  @param context      A pointer to mlan_adapter
  *
  *  @return             N/A
  */
-static t_void wlan_flush_data(t_void *context)
+t_void wlan_11n_rxreorder_timeout_func(t_void *context)
 {
-	reorder_tmr_cnxt_t *reorder_cnxt = (reorder_tmr_cnxt_t *)context;
+	pmlan_adapter pmadapter = (pmlan_adapter)context;
+	pmlan_callbacks pcb = &pmadapter->callbacks;
+	mlan_private *priv = MNULL;
+	mlan_private *flush_priv = MNULL;
+	RxReorderTbl *rx_reor_tbl_ptr;
+	t_u32 now, next = 0;
+	t_u8 pending = MFALSE;
+	int i;
+
 	ENTER();
-	/* Set the flag to flush data */
-	reorder_cnxt->priv->adapter->flush_data = MTRUE;
-	reorder_cnxt->ptr->flush_data = MTRUE;
-	reorder_cnxt->timer_is_set = MFALSE;
-	wlan_recv_event(reorder_cnxt->priv, MLAN_EVENT_ID_DRV_DEFER_RX_WORK,
-			MNULL);
+
+	now = wlan_11n_rxreorder_now_ms(pmadapter);
+	pcb->moal_spin_lock(pmadapter->pmoal_handle,
+			    pmadapter->prxreorder_lock);
+	pmadapter->rxreorder_timer_is_set = MFALSE;
+	for (i = 0; i < pmadapter->priv_num; i++) {
+		priv = pmadapter->priv[i];
+		if (!priv)
+			continue;
+		pcb->moal_spin_lock(pmadapter->pmoal_handle,
+				    priv->rx_reorder_tbl_ptr.plock);
+		rx_reor_tbl_ptr = (RxReorderTbl *)util_peek_list(
+			pmadapter->pmoal_handle, &priv->rx_reorder_tbl_ptr,
+			MNULL, MNULL);
+		while (rx_reor_tbl_ptr &&
+		       rx_reor_tbl_ptr !=
+			       (RxReorderTbl *)&priv->rx_reorder_tbl_ptr) {
+			reorder_tmr_cnxt_t *cnxt =
+				&rx_reor_tbl_ptr->timer_context;
+			if (cnxt->timer_is_set) {
+				if ((t_s32)(cnxt->expiry - now) <= 0) {
+					/* Set the flag to flush data */
+					rx_reor_tbl_ptr->flush_data = MTRUE;
+					cnxt->timer_is_set = MFALSE;
+					flush_priv = priv;
+				} else if (!pending ||
+					   (t_s32)(cnxt->expiry - next) < 0) {
+					next = cnxt->expiry;
+					pending = MTRUE;
+				}
+			}
+			rx_reor_tbl_ptr = rx_reor_tbl_ptr->pnext;
+		}
+		pcb->moal_spin_unlock(pmadapter->pmoal_handle,
+				      priv->rx_reorder_tbl_ptr.plock);
+	}
+	if (pending)
+		wlan_11n_rxreorder_timer_arm(pmadapter, next, now);
+	pcb->moal_spin_unlock(pmadapter->pmoal_handle,
+			      pmadapter->prxreorder_lock);
+
+	if (flush_priv) {
+		pmadapter->flush_data = MTRUE;
+		wlan_recv_event(flush_priv, MLAN_EVENT_ID_DRV_DEFER_RX_WORK,
+				MNULL);
+	}
 	LEAVE();
 }
 
@@ -468,8 +622,11 @@ static t_void wlan_11n_create_rxreorder_tbl(mlan_private *priv, t_u8 *ta,
 	}
 
 	util_init_list((pmlan_linked_list)new_node);
+	/* Packet ring followed by its occupancy bitmap */
 	if (pmadapter->callbacks.moal_malloc(
-		    pmadapter->pmoal_handle, sizeof(pmlan_buffer) * win_size,
+		    pmadapter->pmoal_handle,
+		    sizeof(pmlan_buffer) * win_size +
+			    sizeof(t_u32) * RX_REORDER_BITMAP_WORDS(win_size),
 		    MLAN_MEM_DEF, (t_u8 **)&new_node->rx_reorder_ptr)) {
 		PRINTM(MERROR, "Rx reorder table memory allocation"
 			       "failed\n");
@@ -484,10 +641,6 @@ static t_void wlan_11n_create_rxreorder_tbl(mlan_private *priv, t_u8 *ta,
 	new_node->timer_context.ptr = new_node;
 	new_node->timer_context.priv = priv;
 	new_node->timer_context.timer_is_set = MFALSE;
-	pmadapter->callbacks.moal_init_timer(pmadapter->pmoal_handle,
-					     &new_node->timer_context.timer,
-					     wlan_flush_data,
-					     &new_node->timer_context);
 	util_enqueue_list_tail(pmadapter->pmoal_handle,
 			       &priv->rx_reorder_tbl_ptr,
 			       (pmlan_linked_list)new_node,
@@ -520,6 +673,11 @@ static t_void wlan_11n_create_rxreorder_tbl(mlan_private *priv, t_u8 *ta,
 	new_node->ba_status = BA_STREAM_SETUP_INPROGRESS;
 	for (i = 0; i < win_size; ++i)
 		new_node->rx_reorder_ptr[i] = MNULL;
+	new_node->win_base = 0;
+	new_node->rx_reorder_bitmap =
+		(t_u32 *)(new_node->rx_reorder_ptr + win_size);
+	memset(pmadapter, new_node->rx_reorder_bitmap, 0,
+	       sizeof(t_u32) * RX_REORDER_BITMAP_WORDS(win_size));
 
 	mlan_block_rx_process(pmadapter, MFALSE);
 	LEAVE();
@@ -759,11 +917,13 @@ mlan_status mlan_11n_rxreorder_pkt(void *priv, t_u16 seq_num, t_u16 tid,
 {
 	RxReorderTbl *rx_reor_tbl_ptr;
 	int prev_start_win, start_win, end_win, win_size;
+	int slot;
 	mlan_status ret = MLAN_STATUS_SUCCESS;
 	pmlan_adapter pmadapter = ((mlan_private *)priv)->adapter;
 
 	ENTER();
 
+	MTRACE(pmadapter, MTRACE_RX_REORDER, tid, seq_num);
 	rx_reor_tbl_ptr =
 		wlan_11n_get_rxreorder_tbl((mlan_private *)priv, tid, ta);
 	if (!rx_reor_tbl_ptr || rx_reor_tbl_ptr->win_size <= 1) {
@@ -946,30 +1106,28 @@ mlan_status mlan_11n_rxreorder_pkt(void *priv, t_u16 seq_num, t_u16 tid,
 		       " end_win %d\n",
 		       seq_num, start_win, win_size, end_win);
 		if (pkt_type != PKT_TYPE_BAR) {
-			if (seq_num >= start_win) {
-				if (rx_reor_tbl_ptr->rx_reorder_ptr[seq_num -
-								    start_win]) {
-					PRINTM(MDAT_D, "Drop Duplicate Pkt\n");
-					ret = MLAN_STATUS_FAILURE;
-					goto done;
-				}
-				rx_reor_tbl_ptr
-					->rx_reorder_ptr[seq_num - start_win] =
-					payload;
-			} else { /* Wrap condition */
-				if (rx_reor_tbl_ptr
-					    ->rx_reorder_ptr[(seq_num +
-							      (MAX_TID_VALUE)) -
-							     start_win]) {
-					PRINTM(MDAT_D, "Drop Duplicate Pkt\n");
-					ret = MLAN_STATUS_FAILURE;
-					goto done;
-				}
-				rx_reor_tbl_ptr
-					->rx_reorder_ptr[(seq_num +
-							  (MAX_TID_VALUE)) -
-							 start_win] = payload;
+			if (seq_num >= start_win)
+				slot = seq_num - start_win;
+			else /* Wrap condition */
+				slot = (seq_num + (MAX_TID_VALUE)) - start_win;
+			slot = wlan_11n_reorder_slot(rx_reor_tbl_ptr, slot);
+			pmadapter->callbacks.moal_spin_lock(
+				pmadapter->pmoal_handle,
+				((mlan_private *)priv)->rx_pkt_lock);
+			if (wlan_11n_reorder_slot_used(rx_reor_tbl_ptr, slot)) {
+				pmadapter->callbacks.moal_spin_unlock(
+					pmadapter->pmoal_handle,
+					((mlan_private *)priv)->rx_pkt_lock);
+				PRINTM(MDAT_D, "Drop Duplicate Pkt\n");
+				ret = MLAN_STATUS_FAILURE;
+				goto done;
 			}
+			rx_reor_tbl_ptr->rx_reorder_ptr[slot] = payload;
+			rx_reor_tbl_ptr->rx_reorder_bitmap[slot >> 5] |=
+				MBIT(slot & 31);
+			pmadapter->callbacks.moal_spin_unlock(
+				pmadapter->pmoal_handle,
+				((mlan_private *)priv)->rx_pkt_lock);
 		}
 
 		wlan_11n_display_tbl_ptr(pmadapter, rx_reor_tbl_ptr);
@@ -77,6 +77,40 @@ Change log:
 /** Indicate packet has been dropped in FW */
 #define RX_PKT_DROPPED_IN_FW 0xffffffff
 
+/** Number of bitmap words for a reorder window */
+#define RX_REORDER_BITMAP_WORDS(win_size) (((win_size) + 31) >> 5)
+
+/**
+ *  @brief This function maps a window offset to a reorder ring slot
+ *
+ *  @param tbl      A pointer to RxReorderTbl
+ *  @param offset   Offset from start_win, 0 to win_size - 1
+ *
+ *  @return         Ring slot
+ */
+static INLINE int wlan_11n_reorder_slot(RxReorderTbl *tbl, int offset)
+{
+	int slot = tbl->win_base + offset;
+
+	if (slot >= tbl->win_size)
+		slot -= tbl->win_size;
+	return slot;
+}
+
+/**
+ *  @brief This function checks whether a reorder ring slot holds a packet
+ *
+ *  @param tbl      A pointer to RxReorderTbl
+ *  @param slot     Ring slot
+ *
+ *  @return         MTRUE or MFALSE
+ */
+static INLINE t_u8 wlan_11n_reorder_slot_used(RxReorderTbl *tbl, int slot)
+{
+	return (tbl->rx_reorder_bitmap[slot >> 5] & MBIT(slot & 31)) ? MTRUE :
+								       MFALSE;
+}
+
 mlan_status mlan_11n_rxreorder_pkt(void *priv, t_u16 seqNum, t_u16 tid,
 				   t_u8 *ta, t_u8 pkttype, void *payload);
 void mlan_11n_delete_bastream_tbl(mlan_private *priv, int tid,
@@ -97,6 +131,7 @@ RxReorderTbl *wlan_11n_get_rxreorder_tbl(mlan_private *priv, int tid, t_u8 *ta);
 void wlan_11n_rxba_sync_event(mlan_private *priv, t_u8 *event_buf, t_u16 len);
 void wlan_update_rxreorder_tbl(pmlan_adapter pmadapter, t_u8 flag);
 void wlan_flush_rxreorder_tbl(pmlan_adapter pmadapter);
+t_void wlan_11n_rxreorder_timeout_func(t_void *context);
 void wlan_coex_ampdu_rxwinsize(pmlan_adapter pmadapter);
 
 /** clean up reorder_tbl */
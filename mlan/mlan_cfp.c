@@ -1591,6 +1591,177 @@ t_u8 wlan_get_txpwr_of_chan_from_cfp(mlan_private *pmpriv, t_u8 channel)
 	return tx_power;
 }
 
+/**
+ *  @brief Get the CFP lookup index band class of a band
+ *
+ *  @param band         Band to look up, e.g. BAND_A, BAND_G or BAND_B
+ *
+ *  @return             CFP_INDEX_BAND_BG, CFP_INDEX_BAND_A or -1 if no region
+ * channel table can match the band
+ */
+static int wlan_cfp_band_class(t_u8 band)
+{
+	switch (band) {
+	case BAND_AN:
+	case BAND_A | BAND_AN:
+	case BAND_A | BAND_AN | BAND_AAC:
+	/* Fall Through */
+	case BAND_A: /* Matching BAND_A */
+		return CFP_INDEX_BAND_A;
+	case BAND_GN:
+	case BAND_B | BAND_G | BAND_GN:
+	case BAND_G | BAND_GN:
+	case BAND_GN | BAND_GAC:
+	case BAND_B | BAND_G | BAND_GN | BAND_GAC:
+	case BAND_G | BAND_GN | BAND_GAC:
+	case BAND_B | BAND_G:
+	/* Fall Through */
+	case BAND_B: /* Matching BAND_B/G */
+	/* Fall Through */
+	case BAND_G:
+	/* Fall Through */
+	case 0:
+		return CFP_INDEX_BAND_BG;
+	default:
+		return -1;
+	}
+}
+
+/**
+ *  @brief Get the CFP lookup index band class of a region channel table
+ *
+ *  @param rc           A pointer to region_chan_t structure
+ *
+ *  @return             CFP_INDEX_BAND_BG, CFP_INDEX_BAND_A or -1 if the table
+ * is not usable
+ */
+static int wlan_cfp_region_class(region_chan_t *rc)
+{
+	if (!rc->valid || !rc->pcfp)
+		return -1;
+	switch (rc->band) {
+	case BAND_A:
+		return CFP_INDEX_BAND_A;
+	case BAND_B:
+	case BAND_G:
+		return CFP_INDEX_BAND_BG;
+	default:
+		return -1;
+	}
+}
+
+/**
+ *  @brief Build the CFP lookup index of a set of region channel tables
+ *
+ *  The first table and entry carrying a channel win, the same as a
+ *  linear scan of the tables.
+ *
+ *  @param pmadapter            A pointer to mlan_adapter structure
+ *  @param region_channel       A pointer to region_chan_t structure
+ *  @param index                CFP index by band class and channel
+ *  @param first                First CFP by band class
+ *
+ *  @return                     N/A
+ */
+static void wlan_cfp_index_build(pmlan_adapter pmadapter,
+				 region_chan_t *region_channel,
+				 chan_freq_power_t *index[][CFP_INDEX_CHAN_NUM],
+				 chan_freq_power_t **first)
+{
+	region_chan_t *rc;
+	t_u16 channel;
+	int i, j, bc;
+
+	memset(pmadapter, index, 0,
+	       sizeof(chan_freq_power_t *) * CFP_INDEX_BAND_NUM *
+		       CFP_INDEX_CHAN_NUM);
+	memset(pmadapter, first, 0,
+	       sizeof(chan_freq_power_t *) * CFP_INDEX_BAND_NUM);
+	for (j = 0; j < MAX_REGION_CHANNEL_NUM; j++) {
+		rc = &region_channel[j];
+		bc = wlan_cfp_region_class(rc);
+		if (bc < 0)
+			continue;
+		if (!first[bc])
+			first[bc] = &rc->pcfp[0];
+		for (i = 0; i < rc->num_cfp; i++) {
+			channel = rc->pcfp[i].channel;
+			if (channel < CFP_INDEX_CHAN_NUM && !index[bc][channel])
+				index[bc][channel] = &rc->pcfp[i];
+		}
+	}
+}
+
+/**
+ *  @brief Rebuild the CFP lookup index if the region channel tables or the
+ *  11D state changed since it was last built
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+static void wlan_cfp_index_refresh(pmlan_adapter pmadapter)
+{
+	if (!pmadapter->cfp_index_dirty)
+		return;
+	wlan_cfp_index_build(pmadapter, pmadapter->region_channel,
+			     pmadapter->cfp_index, pmadapter->cfp_index_first);
+	wlan_cfp_index_build(pmadapter, pmadapter->universal_channel,
+			     pmadapter->cfp_index_un,
+			     pmadapter->cfp_index_un_first);
+	/* Any station(s) with 11D enabled */
+	pmadapter->cfp_index_11d =
+		(wlan_count_priv_cond(pmadapter, wlan_11d_is_enabled,
+				      wlan_is_station) > 0) ?
+			MTRUE :
+			MFALSE;
+	pmadapter->cfp_index_dirty = MFALSE;
+	PRINTM(MINFO, "CFP index rebuilt, 11D=%d\n", pmadapter->cfp_index_11d);
+}
+
+/**
+ *  @brief Look up a channel in the CFP index of a region channel table set
+ *
+ *  @param pmadapter            A pointer to mlan_adapter structure
+ *  @param band                 It can be BAND_A, BAND_G or BAND_B
+ *  @param channel              The channel to search for
+ *  @param region_channel       A pointer to region_chan_t structure
+ *  @param pcfp                 Pointer to return the chan_freq_power_t
+ *
+ *  @return                     MTRUE if the index answered the lookup,
+ * MFALSE if the tables have to be scanned
+ */
+static t_u8 wlan_cfp_index_lookup(pmlan_adapter pmadapter, t_u8 band,
+				  t_u16 channel, region_chan_t *region_channel,
+				  chan_freq_power_t **pcfp)
+{
+	chan_freq_power_t *(*index)[CFP_INDEX_CHAN_NUM];
+	chan_freq_power_t **first;
+	int bc;
+
+	if (region_channel == pmadapter->region_channel) {
+		index = pmadapter->cfp_index;
+		first = pmadapter->cfp_index_first;
+	} else if (region_channel == pmadapter->universal_channel) {
+		index = pmadapter->cfp_index_un;
+		first = pmadapter->cfp_index_un_first;
+	} else {
+		return MFALSE;
+	}
+	if (channel != FIRST_VALID_CHANNEL && channel >= CFP_INDEX_CHAN_NUM)
+		return MFALSE;
+
+	wlan_cfp_index_refresh(pmadapter);
+	bc = wlan_cfp_band_class(band);
+	if (bc < 0)
+		*pcfp = MNULL;
+	else if (channel == FIRST_VALID_CHANNEL)
+		*pcfp = first[bc];
+	else
+		*pcfp = index[bc][channel];
+	return MTRUE;
+}
+
 /**
  *  @brief Get the channel frequency power info for a specific channel
  *
@@ -1609,53 +1780,20 @@ wlan_get_cfp_by_band_and_channel(pmlan_adapter pmadapter, t_u8 band,
 {
 	region_chan_t *rc;
 	chan_freq_power_t *cfp = MNULL;
-	int i, j;
+	int i, j, bc;
 
 	ENTER();
 
-	for (j = 0; !cfp && (j < MAX_REGION_CHANNEL_NUM); j++) {
+	if (wlan_cfp_index_lookup(pmadapter, band, channel, region_channel,
+				  &cfp))
+		goto done;
+
+	bc = wlan_cfp_band_class(band);
+	for (j = 0; !cfp && (bc >= 0) && (j < MAX_REGION_CHANNEL_NUM); j++) {
 		rc = &region_channel[j];
 
-		if (!rc->valid || !rc->pcfp)
+		if (wlan_cfp_region_class(rc) != bc)
 			continue;
-		switch (rc->band) {
-		case BAND_A:
-			switch (band) {
-			case BAND_AN:
-			case BAND_A | BAND_AN:
-			case BAND_A | BAND_AN | BAND_AAC:
-			/* Fall Through */
-			case BAND_A: /* Matching BAND_A */
-				break;
-
-			default:
-				continue;
-			}
-			break;
-		case BAND_B:
-		case BAND_G:
-			switch (band) {
-			case BAND_GN:
-			case BAND_B | BAND_G | BAND_GN:
-			case BAND_G | BAND_GN:
-			case BAND_GN | BAND_GAC:
-			case BAND_B | BAND_G | BAND_GN | BAND_GAC:
-			case BAND_G | BAND_GN | BAND_GAC:
-			case BAND_B | BAND_G:
-			/* Fall Through */
-			case BAND_B: /* Matching BAND_B/G */
-			/* Fall Through */
-			case BAND_G:
-			/* Fall Through */
-			case 0:
-				break;
-			default:
-				continue;
-			}
-			break;
-		default:
-			continue;
-		}
 		if (channel == FIRST_VALID_CHANNEL)
 			cfp = &rc->pcfp[0];
 		else {
@@ -1668,6 +1806,7 @@ wlan_get_cfp_by_band_and_channel(pmlan_adapter pmadapter, t_u8 band,
 		}
 	}
 
+done:
 	if (!cfp && channel)
 		PRINTM(MCMND, "%s: can not find cfp by band %d & channel %d\n",
 		       __func__, band, channel);
@@ -1693,9 +1832,9 @@ chan_freq_power_t *wlan_find_cfp_by_band_and_channel(mlan_adapter *pmadapter,
 
 	ENTER();
 
+	wlan_cfp_index_refresh(pmadapter);
 	/* Any station(s) with 11D enabled */
-	if (wlan_count_priv_cond(pmadapter, wlan_11d_is_enabled,
-				 wlan_is_station) > 0)
+	if (pmadapter->cfp_index_11d)
 		cfp = wlan_get_cfp_by_band_and_channel(
 			pmadapter, band, channel, pmadapter->universal_channel);
 	else
@@ -1719,58 +1858,40 @@ chan_freq_power_t *wlan_find_cfp_by_band_and_freq(mlan_adapter *pmadapter,
 						  t_u8 band, t_u32 freq)
 {
 	chan_freq_power_t *cfp = MNULL;
+	region_chan_t *region_channel;
 	region_chan_t *rc;
-	int i, j;
+	t_u16 channel = 0;
+	int i, j, bc;
 
 	ENTER();
 
-	for (j = 0; !cfp && (j < MAX_REGION_CHANNEL_NUM); j++) {
-		rc = &pmadapter->region_channel[j];
+	wlan_cfp_index_refresh(pmadapter);
+	/* Any station(s) with 11D enabled */
+	if (pmadapter->cfp_index_11d)
+		region_channel = pmadapter->universal_channel;
+	else
+		region_channel = pmadapter->region_channel;
+
+	/* Try the channel the frequency maps to first */
+	if (freq == 2484)
+		channel = 14;
+	else if (freq >= 2412 && freq < 2484)
+		channel = (freq - 2407) / 5;
+	else if (freq > 5000 && freq < 5000 + 5 * CFP_INDEX_CHAN_NUM)
+		channel = (freq - 5000) / 5;
+	if (channel &&
+	    wlan_cfp_index_lookup(pmadapter, band, channel, region_channel,
+				  &cfp) &&
+	    cfp && cfp->freq == freq)
+		goto done;
+	cfp = MNULL;
 
-		/* Any station(s) with 11D enabled */
-		if (wlan_count_priv_cond(pmadapter, wlan_11d_is_enabled,
-					 wlan_is_station) > 0)
-			rc = &pmadapter->universal_channel[j];
+	bc = wlan_cfp_band_class(band);
+	for (j = 0; !cfp && (bc >= 0) && (j < MAX_REGION_CHANNEL_NUM); j++) {
+		rc = &region_channel[j];
 
-		if (!rc->valid || !rc->pcfp)
-			continue;
-		switch (rc->band) {
-		case BAND_A:
-			switch (band) {
-			case BAND_AN:
-			case BAND_A | BAND_AN:
-			case BAND_A | BAND_AN | BAND_AAC:
-			/* Fall Through */
-			case BAND_A: /* Matching BAND_A */
-				break;
-			default:
-				continue;
-			}
-			break;
-		case BAND_B:
-		case BAND_G:
-			switch (band) {
-			case BAND_GN:
-			case BAND_B | BAND_G | BAND_GN:
-			case BAND_G | BAND_GN:
-			case BAND_GN | BAND_GAC:
-			case BAND_B | BAND_G | BAND_GN | BAND_GAC:
-			case BAND_G | BAND_GN | BAND_GAC:
-			case BAND_B | BAND_G:
-			/* Fall Through */
-			case BAND_B:
-			/* Fall Through */
-			case BAND_G:
-			/* Fall Through */
-			case 0:
-				break;
-			default:
-				continue;
-			}
-			break;
-		default:
+		if (wlan_cfp_region_class(rc) != bc)
 			continue;
-		}
 		for (i = 0; i < rc->num_cfp; i++) {
 			if (rc->pcfp[i].freq == freq) {
 				cfp = &rc->pcfp[i];
@@ -1779,6 +1900,7 @@ chan_freq_power_t *wlan_find_cfp_by_band_and_freq(mlan_adapter *pmadapter,
 		}
 	}
 
+done:
 	if (!cfp && freq)
 		PRINTM(MERROR, "%s: cannot find cfp by band %d & freq %d\n",
 		       __func__, band, freq);
@@ -2350,6 +2472,7 @@ mlan_status wlan_set_regiontable(mlan_private *pmpriv, t_u8 region, t_u8 band)
 		   sizeof(pmadapter->region_channel), sizeof(region_chan_old));
 	memset(pmadapter, pmadapter->region_channel, 0,
 	       sizeof(pmadapter->region_channel));
+	wlan_cfp_index_invalidate(pmadapter);
 
 	if (band & (BAND_B | BAND_G | BAND_GN)) {
 		if (pmadapter->cfp_code_bg)
@@ -2421,6 +2544,7 @@ mlan_status wlan_set_regiontable(mlan_private *pmpriv, t_u8 region, t_u8 band)
 			wlan_cfp_copy_dynamic(pmadapter, cfp, cfp_no, MNULL, 0);
 		}
 	}
+	wlan_cfp_index_invalidate(pmadapter);
 	LEAVE();
 	return MLAN_STATUS_SUCCESS;
 }
@@ -2892,6 +3016,8 @@ void wlan_add_fw_cfp_tables(pmlan_private pmpriv, t_u8 *buf, t_u16 buf_left)
 		memset(pmadapter, pmadapter->region_channel, 0,
 		       sizeof(pmadapter->region_channel));
 		wlan_free_fw_cfp_tables(pmadapter);
+		/* The index points into region_channel, cleared above */
+		wlan_cfp_index_invalidate(pmadapter);
 	}
 	pmadapter->tx_power_table_bg_rows = FW_CFP_TABLE_MAX_ROWS_BG;
 	pmadapter->tx_power_table_bg_cols = FW_CFP_TABLE_MAX_COLS_BG;
@@ -3219,6 +3345,8 @@ void wlan_free_fw_cfp_tables(mlan_adapter *pmadapter)
 	pmadapter->cfp_otp_a = MNULL;
 	pmadapter->tx_power_table_a = MNULL;
 	pmadapter->tx_power_table_a_size = 0;
+	/* The CFP index may point into the freed OTP tables */
+	wlan_cfp_index_invalidate(pmadapter);
 	LEAVE();
 }
 
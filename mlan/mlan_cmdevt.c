@@ -798,6 +798,9 @@ static t_void wlan_clean_cmd_node(pmlan_adapter pmadapter,
 	pcmd_node->cmd_flag = 0;
 	pcmd_node->pioctl_buf = MNULL;
 	pcmd_node->pdata_buf = MNULL;
+	pcmd_node->queue_ts = 0;
+	pcmd_node->dnld_ts = 0;
+	pcmd_node->cache_key = 0;
 
 	if (pcmd_node->respbuf) {
 		pmadapter->ops.cmdrsp_complete(pmadapter, pcmd_node->respbuf,
@@ -1037,6 +1040,249 @@ static t_u16 wlan_get_cmd_timeout(t_u16 cmd_id)
 	return timeout;
 }
 
+/**
+ *  @brief This function records the round trip time of a command,
+ *         from download to the handling of its response
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param pcmd_node    A pointer to cmd_ctrl_node structure
+ *
+ *  @return             N/A
+ */
+static t_void wlan_update_cmd_rtt(mlan_adapter *pmadapter,
+				  cmd_ctrl_node *pcmd_node)
+{
+	t_u64 now = wlan_get_time_us(pmadapter);
+	t_u32 rtt;
+
+	if (!pcmd_node->dnld_ts || now < pcmd_node->dnld_ts)
+		return;
+	rtt = (t_u32)(now - pcmd_node->dnld_ts);
+	pmadapter->dbg.last_cmd_rtt[pmadapter->dbg.last_cmd_index] = rtt;
+	pmadapter->dbg.num_cmd_rtt++;
+	pmadapter->dbg.cmd_rtt_total += rtt;
+	if (rtt > pmadapter->dbg.cmd_rtt_max)
+		pmadapter->dbg.cmd_rtt_max = rtt;
+	PRINTM(MCMD_D, "CMD_RTT: 0x%x %u us\n", pcmd_node->cmd_no, rtt);
+}
+
+/** Read-only commands whose GET response may be cached */
+static const t_u16 cmd_cache_cmds[] = {
+	HostCmd_CMD_VERSION_EXT,      HostCmd_CMD_TXPWR_CFG,
+	HostCmd_CMD_TX_RATE_CFG,      HostCmd_CMD_802_11_TX_RATE_QUERY,
+	HostCmd_CMD_CHAN_REGION_CFG,
+};
+
+/** Commands that change the state behind the cached responses */
+static const t_u16 cmd_cache_flush_cmds[] = {
+	HostCmd_CMD_802_11_ASSOCIATE, HostCmd_CMD_802_11D_DOMAIN_INFO,
+#ifdef UAP_SUPPORT
+	HOST_CMD_APCMD_SYS_CONFIGURE, HOST_CMD_APCMD_BSS_START,
+	HOST_CMD_APCMD_BSS_STOP,
+#endif
+};
+
+/**
+ *  @brief This function checks if a command number is in a list
+ *
+ *  @param cmd_no       Command number
+ *  @param list         A pointer to the command list
+ *  @param num          Number of entries in the list
+ *
+ *  @return             MTRUE or MFALSE
+ */
+static t_u8 wlan_cmd_in_list(t_u16 cmd_no, const t_u16 *list, t_u32 num)
+{
+	t_u32 i;
+
+	for (i = 0; i < num; i++) {
+		if (list[i] == cmd_no)
+			return MTRUE;
+	}
+	return MFALSE;
+}
+
+/**
+ *  @brief This function drops all cached command responses
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+static t_void wlan_cmd_cache_flush(mlan_adapter *pmadapter)
+{
+	t_u32 i;
+
+	for (i = 0; i < CMD_CACHE_NUM; i++)
+		pmadapter->cmd_cache[i].cmd_no = 0;
+}
+
+/**
+ *  @brief This function marks a command that can be served from the
+ *         response cache, or that flushes the cache on its response
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param pcmd_node    A pointer to cmd_ctrl_node structure
+ *  @param cmd_no       Command number
+ *  @param cmd_action   Command action
+ *
+ *  @return             N/A
+ */
+static t_void wlan_cmd_cache_prepare(mlan_adapter *pmadapter,
+				     cmd_ctrl_node *pcmd_node, t_u16 cmd_no,
+				     t_u16 cmd_action)
+{
+	HostCmd_DS_COMMAND *pcmd;
+	t_u8 *body;
+	t_u16 size;
+	t_u32 key = 0x811c9dc5;
+	t_u32 i;
+
+	if (!pmadapter->cmd_cache_ttl)
+		return;
+	if (!wlan_cmd_in_list(cmd_no, cmd_cache_cmds,
+			      NELEMENTS(cmd_cache_cmds))) {
+		if (wlan_cmd_in_list(cmd_no, cmd_cache_flush_cmds,
+				     NELEMENTS(cmd_cache_flush_cmds)) &&
+		    cmd_action != HostCmd_ACT_GEN_GET)
+			pcmd_node->cmd_flag |= CMD_F_CACHE_FLUSH;
+		return;
+	}
+	if (cmd_action != HostCmd_ACT_GEN_GET) {
+		pcmd_node->cmd_flag |= CMD_F_CACHE_FLUSH;
+		return;
+	}
+	if (!pcmd_node->pioctl_buf)
+		return;
+	pcmd = (HostCmd_DS_COMMAND *)(pcmd_node->cmdbuf->pbuf +
+				      pcmd_node->cmdbuf->data_offset);
+	size = wlan_le16_to_cpu(pcmd->size);
+	if (size < S_DS_GEN)
+		return;
+	/* FNV-1a over the command body, the header carries no parameters */
+	body = (t_u8 *)pcmd + S_DS_GEN;
+	for (i = 0; i < (t_u32)(size - S_DS_GEN); i++) {
+		key ^= body[i];
+		key *= 0x01000193;
+	}
+	pcmd_node->cache_key = key;
+	pcmd_node->cmd_flag |= CMD_F_CACHE;
+}
+
+/**
+ *  @brief This function finds a valid cache entry for a command
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param pcmd_node    A pointer to cmd_ctrl_node structure
+ *  @param now          Current time in us
+ *
+ *  @return             A pointer to cmd_cache_entry or MNULL
+ */
+static cmd_cache_entry *wlan_cmd_cache_find(mlan_adapter *pmadapter,
+					    cmd_ctrl_node *pcmd_node, t_u64 now)
+{
+	cmd_cache_entry *entry;
+	t_u32 i;
+
+	for (i = 0; i < CMD_CACHE_NUM; i++) {
+		entry = &pmadapter->cmd_cache[i];
+		if (entry->cmd_no != pcmd_node->cmd_no ||
+		    entry->bss_index != pcmd_node->priv->bss_index ||
+		    entry->key != pcmd_node->cache_key)
+			continue;
+		if (now >= entry->expiry) {
+			entry->cmd_no = 0;
+			return MNULL;
+		}
+		return entry;
+	}
+	return MNULL;
+}
+
+/**
+ *  @brief This function saves the response of a cacheable command
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param pcmd_node    A pointer to cmd_ctrl_node structure
+ *  @param resp         A pointer to HostCmd_DS_COMMAND, header in host order
+ *
+ *  @return             N/A
+ */
+static t_void wlan_cmd_cache_store(mlan_adapter *pmadapter,
+				   cmd_ctrl_node *pcmd_node,
+				   HostCmd_DS_COMMAND *resp)
+{
+	t_u64 now = wlan_get_time_us(pmadapter);
+	cmd_cache_entry *entry;
+	cmd_cache_entry *oldest = MNULL;
+	t_u32 i;
+
+	if (resp->size > CMD_CACHE_RESP_SIZE)
+		return;
+	entry = wlan_cmd_cache_find(pmadapter, pcmd_node, now);
+	for (i = 0; !entry && i < CMD_CACHE_NUM; i++) {
+		if (!pmadapter->cmd_cache[i].cmd_no) {
+			entry = &pmadapter->cmd_cache[i];
+			break;
+		}
+		if (!oldest || pmadapter->cmd_cache[i].expiry < oldest->expiry)
+			oldest = &pmadapter->cmd_cache[i];
+	}
+	if (!entry)
+		entry = oldest;
+	entry->cmd_no = (t_u16)pcmd_node->cmd_no;
+	entry->bss_index = pcmd_node->priv->bss_index;
+	entry->key = pcmd_node->cache_key;
+	entry->expiry = now + (t_u64)pmadapter->cmd_cache_ttl * 1000;
+	entry->resp_len = resp->size;
+	memcpy_ext(pmadapter, entry->resp, resp, resp->size,
+		   CMD_CACHE_RESP_SIZE);
+}
+
+/**
+ *  @brief This function completes a cacheable command from the
+ *         response cache instead of sending it to firmware
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param pcmd_node    A pointer to cmd_ctrl_node structure
+ *
+ *  @return             MTRUE if the command was served, otherwise MFALSE
+ */
+static t_u8 wlan_cmd_cache_serve(mlan_adapter *pmadapter,
+				 cmd_ctrl_node *pcmd_node)
+{
+	mlan_private *pmpriv = pcmd_node->priv;
+	mlan_ioctl_req *pioctl_buf = (mlan_ioctl_req *)pcmd_node->pioctl_buf;
+	cmd_cache_entry *entry;
+	HostCmd_DS_COMMAND *resp;
+	mlan_status ret;
+
+	entry = wlan_cmd_cache_find(pmadapter, pcmd_node,
+				    wlan_get_time_us(pmadapter));
+	if (!entry) {
+		pmadapter->dbg.num_cmd_cache_miss++;
+		return MFALSE;
+	}
+	pmadapter->dbg.num_cmd_cache_hit++;
+	/* The handlers convert the body in place, so work on a copy */
+	resp = (HostCmd_DS_COMMAND *)(pcmd_node->cmdbuf->pbuf +
+				      pcmd_node->cmdbuf->data_offset);
+	memcpy_ext(pmadapter, resp, entry->resp, entry->resp_len,
+		   MRVDRV_SIZE_OF_CMD_BUFFER - pcmd_node->cmdbuf->data_offset);
+	PRINTM(MCMND, "CMD_CACHE: 0x%x served from cache\n",
+	       pcmd_node->cmd_no);
+	ret = pmpriv->ops.process_cmdresp(pmpriv, resp->command, resp,
+					  pioctl_buf);
+	if (pioctl_buf)
+		pioctl_buf->status_code = (ret == MLAN_STATUS_SUCCESS) ?
+						  MLAN_ERROR_NO_ERROR :
+						  MLAN_ERROR_CMD_RESP_FAIL;
+	wlan_request_cmd_lock(pmadapter);
+	wlan_insert_cmd_to_free_q(pmadapter, pcmd_node);
+	wlan_release_cmd_lock(pmadapter);
+	return MTRUE;
+}
+
 /**
  *  @brief This function downloads a command to firmware.
  *
@@ -1115,6 +1361,14 @@ static mlan_status wlan_dnld_cmd_to_fw(mlan_private *pmpriv,
 	pmadapter->callbacks.moal_get_system_time(pmadapter->pmoal_handle,
 						  &pmadapter->dnld_cmd_in_secs,
 						  &age_ts_usec);
+	pcmd_node->dnld_ts =
+		(t_u64)pmadapter->dnld_cmd_in_secs * 1000000 + age_ts_usec;
+	pmadapter->dbg.last_cmd_rtt[pmadapter->dbg.last_cmd_index] = 0;
+	if (pcmd_node->queue_ts && pcmd_node->dnld_ts > pcmd_node->queue_ts)
+		pmadapter->dbg.last_cmd_wait[pmadapter->dbg.last_cmd_index] =
+			(t_u32)(pcmd_node->dnld_ts - pcmd_node->queue_ts);
+	else
+		pmadapter->dbg.last_cmd_wait[pmadapter->dbg.last_cmd_index] = 0;
 
 	if (pcmd->command == HostCmd_CMD_HOST_CLOCK_CFG) {
 		HostCmd_DS_HOST_CLOCK_CFG *host_clock =
@@ -1251,6 +1505,7 @@ static mlan_status wlan_dnld_sleep_confirm_cmd(mlan_adapter *pmadapter)
 		pmadapter->dbg.num_cmd_sleep_cfm_host_to_card_failure++;
 		goto done;
 	} else {
+		wlan_ps_note_sleep(pmadapter);
 		if (GET_BSS_ROLE(pmpriv) == MLAN_BSS_ROLE_UAP)
 			pmadapter->ps_state = PS_STATE_SLEEP_CFM;
 #ifdef STA_SUPPORT
@@ -1522,6 +1777,20 @@ mlan_status wlan_process_event(pmlan_adapter pmadapter)
 	eventcause &= EVENT_ID_MASK;
 	pmadapter->event_cause = eventcause;
 
+	switch (eventcause) {
+	case EVENT_PORT_RELEASE:
+	case EVENT_LINK_LOST:
+	case EVENT_DEAUTHENTICATED:
+	case EVENT_DISASSOCIATED:
+	case EVENT_CHANNEL_SWITCH:
+	case EVENT_CHANNEL_SWITCH_ANN:
+	case EVENT_MICRO_AP_BSS_START:
+		wlan_cmd_cache_flush(pmadapter);
+		break;
+	default:
+		break;
+	}
+
 	if (pmbuf) {
 		pmbuf->bss_index = priv->bss_index;
 		memcpy_ext(pmadapter, pmbuf->pbuf + pmbuf->data_offset,
@@ -1693,6 +1962,8 @@ mlan_status wlan_prepare_cmd(mlan_private *pmpriv, t_u16 cmd_no,
 		ret = MLAN_STATUS_FAILURE;
 		goto done;
 	}
+	if (!(pcmd_node->cmd_flag & CMD_F_HOSTCMD))
+		wlan_cmd_cache_prepare(pmadapter, pcmd_node, cmd_no, cmd_action);
 
 	wlan_request_cmd_lock(pmadapter);
 	/* Send command */
@@ -1800,6 +2071,7 @@ t_void wlan_insert_cmd_to_pending_q(mlan_adapter *pmadapter,
 		}
 	}
 
+	pcmd_node->queue_ts = wlan_get_time_us(pmadapter);
 	if (add_tail) {
 		util_enqueue_list_tail(pmadapter->pmoal_handle,
 				       &pmadapter->cmd_pending_q,
@@ -1852,6 +2124,7 @@ mlan_status wlan_exec_next_cmd(mlan_adapter *pmadapter)
 		goto done;
 	}
 
+next_cmd:
 	wlan_request_cmd_lock(pmadapter);
 	/* Check if any command is pending */
 	pcmd_node = (cmd_ctrl_node *)util_peek_list(pmadapter->pmoal_handle,
@@ -1874,6 +2147,9 @@ mlan_status wlan_exec_next_cmd(mlan_adapter *pmadapter)
 				 &pmadapter->cmd_pending_q,
 				 (pmlan_linked_list)pcmd_node, MNULL, MNULL);
 		wlan_release_cmd_lock(pmadapter);
+		if ((pcmd_node->cmd_flag & CMD_F_CACHE) &&
+		    wlan_cmd_cache_serve(pmadapter, pcmd_node))
+			goto next_cmd;
 		ret = wlan_dnld_cmd_to_fw(priv, pcmd_node);
 		priv = wlan_get_priv(pmadapter, MLAN_BSS_ROLE_ANY);
 		/* Any command sent to the firmware when host is in sleep mode,
@@ -1954,6 +2230,7 @@ mlan_status wlan_process_cmdresp(mlan_adapter *pmadapter)
 		goto done;
 	}
 	pmadapter->dnld_cmd_in_secs = 0;
+	wlan_update_cmd_rtt(pmadapter, pmadapter->curr_cmd);
 	/* Now we got response from FW, cancel the command timer */
 	if (pmadapter->cmd_timer_is_set) {
 		/* Cancel command timeout timer */
@@ -2041,6 +2318,12 @@ mlan_status wlan_process_cmdresp(mlan_adapter *pmadapter)
 		    (cmdresp_no == HostCmd_CMD_802_11_HS_CFG_ENH))
 			ret = wlan_ret_802_11_hs_cfg(pmpriv, resp, pioctl_buf);
 	} else {
+		if (pmadapter->curr_cmd->cmd_flag & CMD_F_CACHE_FLUSH)
+			wlan_cmd_cache_flush(pmadapter);
+		else if ((pmadapter->curr_cmd->cmd_flag & CMD_F_CACHE) &&
+			 cmdresp_result == HostCmd_RESULT_OK)
+			wlan_cmd_cache_store(pmadapter, pmadapter->curr_cmd,
+					     resp);
 		/* handle response */
 		ret = pmpriv->ops.process_cmdresp(pmpriv, cmdresp_no, resp,
 						  pioctl_buf);
@@ -3138,6 +3421,193 @@ mlan_status wlan_ret_rx_mgmt_ind(pmlan_private pmpriv, HostCmd_DS_COMMAND *resp,
 	return MLAN_STATUS_SUCCESS;
 }
 
+/** Gap in us between frames that starts a new traffic burst */
+#define PS_BURST_GAP_US 2000
+
+/**
+ *  @brief This function returns the log2 histogram bucket of a value
+ *
+ *  @param val          Value to bucket
+ *
+ *  @return             0 for 0, n for [2^(n-1), 2^n), capped to the last
+ */
+static t_u8 wlan_ps_hist_bucket(t_u32 val)
+{
+	t_u8 n = 0;
+
+	while (val && n < PS_HIST_NUM - 1) {
+		val >>= 1;
+		n++;
+	}
+	return n;
+}
+
+/**
+ *  @brief This function stops the sleep confirm hold-off
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+static t_void wlan_ps_hold_stop(mlan_adapter *pmadapter)
+{
+	if (pmadapter->ps_hold_timer_is_set) {
+		pmadapter->callbacks.moal_stop_timer(pmadapter->pmoal_handle,
+						     pmadapter->pps_hold_timer);
+		pmadapter->ps_hold_timer_is_set = MFALSE;
+	}
+	pmadapter->ps_holding = MFALSE;
+}
+
+/**
+ *  @brief This function decides whether to hold off the sleep confirm
+ *
+ *  Traffic tends to come in bursts. When the gap between bursts is
+ *  shorter than ps_hold_max, staying awake until the next burst is
+ *  expected costs less than a sleep and wakeup round. Frames queued by
+ *  the host are not sent while a sleep request is pending, so queued
+ *  TX or commands always end the hold-off.
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             MTRUE if the sleep confirm is held off
+ */
+static t_u8 wlan_ps_hold(mlan_adapter *pmadapter)
+{
+	pmlan_callbacks pcb = &pmadapter->callbacks;
+	t_u64 now;
+	t_u64 until;
+	t_u32 window;
+
+	if (!pmadapter->ps_hold_max || !pmadapter->ps_burst_gap)
+		goto confirm;
+	if (wlan_is_cmd_pending(pmadapter) ||
+	    !wlan_bypass_tx_list_empty(pmadapter) ||
+	    !wlan_wmm_lists_empty(pmadapter))
+		goto confirm;
+	/* Give the next burst a quarter of the average gap as slack */
+	window = pmadapter->ps_burst_gap + pmadapter->ps_burst_gap / 4;
+	if (window > pmadapter->ps_hold_max * 1000)
+		goto confirm;
+	now = wlan_get_time_us(pmadapter);
+	until = pmadapter->ps_last_xfer + window;
+	if (now >= until)
+		goto confirm;
+	if (!pmadapter->ps_holding) {
+		pmadapter->ps_holding = MTRUE;
+		pmadapter->dbg.num_ps_hold++;
+	}
+	if (!pmadapter->ps_hold_timer_is_set) {
+		pcb->moal_start_timer(pmadapter->pmoal_handle,
+				      pmadapter->pps_hold_timer, MFALSE,
+				      (t_u32)(until - now) / 1000 + 1);
+		pmadapter->ps_hold_timer_is_set = MTRUE;
+	}
+	PRINTM(MINFO, "Hold Sleep Confirm for %u us\n", (t_u32)(until - now));
+	return MTRUE;
+confirm:
+	wlan_ps_hold_stop(pmadapter);
+	return MFALSE;
+}
+
+/**
+ *  @brief This timer function ends the sleep confirm hold-off
+ *
+ *  @param function_context   A pointer to function_context
+ *  @return                   N/A
+ */
+t_void wlan_ps_hold_timeout_func(t_void *function_context)
+{
+	pmlan_adapter pmadapter = (pmlan_adapter)function_context;
+
+	ENTER();
+	pmadapter->ps_hold_timer_is_set = MFALSE;
+	/* Let the main process recheck the sleep confirm */
+	if (pmadapter->ps_state == PS_STATE_PRE_SLEEP)
+		wlan_recv_event(wlan_get_priv(pmadapter, MLAN_BSS_ROLE_ANY),
+				MLAN_EVENT_ID_DRV_DEFER_HANDLING, MNULL);
+	LEAVE();
+}
+
+/**
+ *  @brief This function accounts a data transfer for power save: it
+ *  records the wake latency and tracks the gap between traffic bursts
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+t_void wlan_ps_note_xfer(mlan_adapter *pmadapter)
+{
+	t_u64 now;
+	t_u64 gap;
+
+	pmadapter->ps_xfer_seen = MTRUE;
+	if (!pmadapter->ps_wake_start && !pmadapter->ps_hold_max)
+		return;
+	now = wlan_get_time_us(pmadapter);
+	if (pmadapter->ps_wake_start) {
+		gap = MIN(now - pmadapter->ps_wake_start, 0xffffffff);
+		pmadapter->dbg.ps_wake_hist[wlan_ps_hist_bucket((t_u32)gap)]++;
+		pmadapter->ps_wake_start = 0;
+	}
+	if (!pmadapter->ps_hold_max)
+		return;
+	if (pmadapter->ps_holding) {
+		pmadapter->dbg.num_ps_hold_hit++;
+		pmadapter->ps_holding = MFALSE;
+	}
+	gap = now - pmadapter->ps_last_xfer;
+	/* Frames within a burst say nothing about the next burst */
+	if (pmadapter->ps_last_xfer && gap >= PS_BURST_GAP_US) {
+		gap = MIN(gap, (t_u64)pmadapter->ps_hold_max * 2000);
+		if (pmadapter->ps_burst_gap)
+			pmadapter->ps_burst_gap =
+				(pmadapter->ps_burst_gap * 3 + (t_u32)gap) / 4;
+		else
+			pmadapter->ps_burst_gap = (t_u32)gap;
+	}
+	pmadapter->ps_last_xfer = now;
+}
+
+/**
+ *  @brief This function accounts a sleep confirm for power save
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+t_void wlan_ps_note_sleep(mlan_adapter *pmadapter)
+{
+	if (!pmadapter->ps_xfer_seen)
+		pmadapter->dbg.num_ps_idle_wake++;
+	pmadapter->ps_sleep_start = wlan_get_time_us(pmadapter);
+	pmadapter->ps_wake_start = 0;
+	wlan_ps_hold_stop(pmadapter);
+}
+
+/**
+ *  @brief This function accounts a card wakeup for power save
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             N/A
+ */
+t_void wlan_ps_note_awake(mlan_adapter *pmadapter)
+{
+	t_u64 slept;
+
+	if (pmadapter->ps_sleep_start) {
+		slept = MIN(wlan_get_time_us(pmadapter) -
+				    pmadapter->ps_sleep_start,
+			    0xffffffff);
+		pmadapter->dbg.ps_sleep_hist[wlan_ps_hist_bucket(
+			(t_u32)slept / 1000)]++;
+		pmadapter->ps_sleep_start = 0;
+		pmadapter->ps_xfer_seen = MFALSE;
+	}
+}
+
 /**
  *  @brief This function checks conditions and prepares to
  *              send sleep confirm command to firmware if OK.
@@ -3153,7 +3623,8 @@ t_void wlan_check_ps_cond(mlan_adapter *pmadapter)
 	if (!pmadapter->cmd_sent && !pmadapter->curr_cmd &&
 	    !pmadapter->keep_wakeup && !wlan_is_tx_pending(pmadapter) &&
 	    !IS_CARD_RX_RCVD(pmadapter)) {
-		wlan_dnld_sleep_confirm_cmd(pmadapter);
+		if (!wlan_ps_hold(pmadapter))
+			wlan_dnld_sleep_confirm_cmd(pmadapter);
 	} else {
 		PRINTM(MCMND, "Delay Sleep Confirm (%s%s%s%s)\n",
 		       (pmadapter->cmd_sent) ? "D" : "",
@@ -3342,6 +3813,7 @@ void wlan_process_sleep_confirm_resp(pmlan_adapter pmadapter, t_u8 *pbuf,
 		PRINTM(MERROR, "Sleep confirm command failed\n");
 		pmadapter->pm_wakeup_card_req = MFALSE;
 		pmadapter->ps_state = PS_STATE_AWAKE;
+		wlan_ps_note_awake(pmadapter);
 		LEAVE();
 		return;
 	}
@@ -4696,50 +5168,42 @@ mlan_status wlan_ret_rx_pkt_coalesce_cfg(pmlan_private pmpriv,
 mlan_status wlan_process_csi_event(pmlan_private pmpriv)
 {
 	pmlan_adapter pmadapter = pmpriv->adapter;
-	mlan_status status;
 	t_u32 eventcause = pmadapter->event_cause;
-	t_u8 *evt_buf = MNULL;
 	pmlan_buffer pmbuf = pmadapter->pmlan_buffer_event;
-	pmlan_callbacks pcb = &pmadapter->callbacks;
 	pmlan_event pevent;
+	pcsi_record_ds csi_record = (pcsi_record_ds)(
+		pmbuf->pbuf + pmbuf->data_offset + sizeof(eventcause));
+	t_u32 csi_len;
 
 	ENTER();
 
-	/* Allocate memory for event buffer */
-	status = pcb->moal_malloc(pmadapter->pmoal_handle, MAX_EVENT_SIZE,
-				  MLAN_MEM_DEF, &evt_buf);
-	if ((status == MLAN_STATUS_SUCCESS) && evt_buf) {
-		t_u16 csi_sig;
-		pcsi_record_ds csi_record = (pcsi_record_ds)(
-			pmbuf->pbuf + pmbuf->data_offset + sizeof(eventcause));
-		/* Check CSI signature */
-		csi_sig = csi_record->CSI_Sign;
-		if (csi_sig != CSI_SIGNATURE) {
-			PRINTM(MERROR,
-			       "Wrong CSI signature 0x%04x. Should be 0x%04x",
-			       csi_sig, CSI_SIGNATURE);
-			status = MLAN_STATUS_FAILURE;
-		} else {
-			/* Send event to moal */
-			pevent = (pmlan_event)evt_buf;
-			pevent->bss_index = pmpriv->bss_index;
-			pevent->event_id = MLAN_EVENT_ID_CSI;
-			/* Event length is the CSI record length in byte */
-			pevent->event_len = csi_record->Len * 4;
-			if (pevent->event_len >
-			    pmbuf->data_len - sizeof(eventcause))
-				pevent->event_len =
-					pmbuf->data_len - sizeof(eventcause);
-			memcpy_ext(pmadapter, (t_u8 *)pevent->event_buf,
-				   csi_record, pevent->event_len,
-				   pevent->event_len);
-			wlan_recv_event(pmpriv, pevent->event_id, pevent);
-		}
-		pcb->moal_mfree(pmadapter->pmoal_handle, evt_buf);
+	/* Check CSI signature */
+	if (csi_record->CSI_Sign != CSI_SIGNATURE) {
+		PRINTM(MERROR, "Wrong CSI signature 0x%04x. Should be 0x%04x",
+		       csi_record->CSI_Sign, CSI_SIGNATURE);
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
 	}
+	/* Event length is the CSI record length in byte */
+	csi_len = csi_record->Len * 4;
+	if (csi_len > pmbuf->data_len - sizeof(eventcause))
+		csi_len = pmbuf->data_len - sizeof(eventcause);
+
+	/* Reports come at a high rate, build the event header in the head
+	 * room in front of the record and pass the record to moal in place */
+	if (pmbuf->data_offset + sizeof(eventcause) < sizeof(mlan_event)) {
+		PRINTM(MERROR, "No room for CSI event header\n");
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
+	}
+	pevent = (pmlan_event)((t_u8 *)csi_record - sizeof(mlan_event));
+	pevent->bss_index = pmpriv->bss_index;
+	pevent->event_id = MLAN_EVENT_ID_CSI;
+	pevent->event_len = csi_len;
+	wlan_recv_event(pmpriv, pevent->event_id, pevent);
 
 	LEAVE();
-	return status;
+	return MLAN_STATUS_SUCCESS;
 }
 
 /**
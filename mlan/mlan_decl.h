@@ -474,6 +474,8 @@ typedef struct _card_type_entry {
 #define MEVT_D MBIT(18)
 #define MFW_D MBIT(19)
 #define MIF_D MBIT(20)
+/** Record binary trace events in the trace ring */
+#define MTRACE_D MBIT(21)
 
 #define MENTRY MBIT(28)
 #define MWARN MBIT(29)
@@ -481,6 +483,24 @@ typedef struct _card_type_entry {
 #define MHEX_DUMP MBIT(31)
 #endif /* DEBUG_LEVEL1 */
 
+/** Trace ring event ids, see MTRACE_D */
+typedef enum _mlan_trace_event {
+	/** Packet queued to RA list, arg0: tid, arg1: length */
+	MTRACE_TX_ENQUEUE = 1,
+	/** Packet into RX reorder, arg0: tid, arg1: sequence number */
+	MTRACE_RX_REORDER,
+	/** SDIO CMD53 read, arg0: port, arg1: length */
+	MTRACE_SDIO_RD,
+	/** SDIO CMD53 write, arg0: port, arg1: length */
+	MTRACE_SDIO_WR,
+	/** SDIO multi-buffer read, arg0: port, arg1: number of buffers */
+	MTRACE_SDIO_RD_MB,
+	/** SDIO multi-buffer write, arg0: port, arg1: number of buffers */
+	MTRACE_SDIO_WR_MB,
+	/** SDIO interrupt, arg0: 1 if polled, arg1: poll index or 0 */
+	MTRACE_SDIO_INT,
+} mlan_trace_event;
+
 /** Memory allocation type: DMA */
 #define MLAN_MEM_DMA MBIT(0)
 
@@ -656,6 +676,10 @@ typedef struct _mlan_fw_image {
 	t_u32 fw_len;
 	/** Firmware reload flag */
 	t_u8 fw_reload;
+	/** Time spent downloading the image (us), set by MLAN */
+	t_u32 dnld_time;
+	/** Time spent waiting for firmware ready (us), set by MLAN */
+	t_u32 ready_time;
 } mlan_fw_image, *pmlan_fw_image;
 
 /** MrvlIEtypesHeader_t */
@@ -1090,10 +1114,8 @@ typedef struct _mlan_buffer {
 	/** Fields below are valid for data packet only */
 	/** QoS priority */
 	t_u32 priority;
-	/** Time stamp when packet is received (seconds) */
-	t_u32 in_ts_sec;
-	/** Time stamp when packet is received (micro seconds) */
-	t_u32 in_ts_usec;
+	/** Time stamp when packet is queued (nanoseconds), 0 if not stamped */
+	t_u64 in_ts_nsec;
 	/** Time stamp when packet is processed (seconds) */
 	t_u32 out_ts_sec;
 	/** Time stamp when packet is processed (micro seconds) */
@@ -2226,6 +2248,8 @@ typedef struct _mlan_callbacks {
 	/** moal_get_system_time */
 	mlan_status (*moal_get_system_time)(t_void *pmoal, t_u32 *psec,
 					    t_u32 *pusec);
+	/** moal_get_tx_tstamp */
+	mlan_status (*moal_get_tx_tstamp)(t_void *pmoal, t_u64 *pnsec);
 	/** moal_init_timer*/
 	mlan_status (*moal_init_timer)(t_void *pmoal, t_void **pptimer,
 				       IN t_void (*callback)(t_void *pcontext),
@@ -2252,6 +2276,9 @@ typedef struct _mlan_callbacks {
 				     t_u32 level);
 	/** moal_assert */
 	t_void (*moal_assert)(t_void *pmoal, t_u32 cond);
+	/** moal_trace */
+	t_void (*moal_trace)(t_void *pmoal, t_u32 event, t_u32 arg0,
+			     t_u32 arg1);
 
 	/** moal_hist_data_add */
 	t_void (*moal_hist_data_add)(t_void *pmoal, t_u32 bss_index,
@@ -2348,6 +2375,10 @@ typedef struct _mlan_device {
 	t_u16 multi_dtim;
 	/** IEEE ps inactivity timeout value */
 	t_u16 inact_tmo;
+	/** Command response cache lifetime in ms, 0 to disable */
+	t_u32 cmd_cache_ttl;
+	/** Max sleep confirm hold-off in ms, 0 to disable */
+	t_u32 ps_hold_max;
 	/** card type */
 	t_u16 card_type;
 	/** card rev */
@@ -2412,6 +2443,8 @@ void mlan_process_deaggr_pkt(t_void *padapter, pmlan_buffer pmbuf, t_u8 *drop);
 
 /** interrupt handler */
 MLAN_API mlan_status mlan_interrupt(t_u16 msg_id, t_void *padapter);
+/** poll interrupt status */
+MLAN_API mlan_status mlan_interrupt_poll(t_void *padapter);
 
 #if defined(SYSKT)
 /** GPIO IRQ callback function */
@@ -1852,6 +1852,10 @@ typedef enum _ENH_PS_MODES {
 #define CMD_F_CANCELED (1 << 1)
 /** scan command flag */
 #define CMD_F_SCAN (1 << 2)
+/** command response may be served from the response cache */
+#define CMD_F_CACHE (1 << 3)
+/** command response flushes the response cache */
+#define CMD_F_CACHE_FLUSH (1 << 4)
 
 /** Host Command ID bit mask (bit 11:0) */
 #define HostCmd_CMD_ID_MASK 0x0fff
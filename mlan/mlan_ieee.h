@@ -1976,6 +1976,9 @@ typedef MLAN_PACK_START struct {
 #pragma pack(pop)
 #endif
 
+/** Max number of IEs kept in the IE index of a BSS entry */
+#define MAX_BSS_IE_INDEX 64
+
 /** BSSDescriptor_t
  *    Structure used to store information for beacon/probe response
  */
@@ -2163,6 +2166,12 @@ typedef struct _BSSDescriptor_t {
 	t_u32 beacon_buf_size;
 	/** Max allocated size for updated scan response */
 	t_u32 beacon_buf_size_max;
+	/** Bitmap of the element IDs found in the stored scan response */
+	t_u32 ie_map[8];
+	/** Number of IEs in the IE index */
+	t_u8 ie_num;
+	/** Offset of each IE in the stored scan response, in beacon order */
+	t_u16 ie_offset[MAX_BSS_IE_INDEX];
 	/** scan age in secs */
 	t_u32 age_in_secs;
 } BSSDescriptor_t, *pBSSDescriptor_t;
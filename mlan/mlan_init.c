@@ -657,9 +657,15 @@ t_void wlan_init_adapter(pmlan_adapter pmadapter)
 		pmadapter->passive_to_active_scan = MLAN_PASS_TO_ACT_SCAN_EN;
 
 	pmadapter->scan_chan_gap = 0;
-	pmadapter->num_in_scan_table = 0;
-	memset(pmadapter, pmadapter->pscan_table, 0,
-	       (sizeof(BSSDescriptor_t) * MRVDRV_MAX_BSSID_LIST));
+	/* A fast fw reload keeps the scan results */
+	if (!pmadapter->keep_scan_table) {
+		pmadapter->num_in_scan_table = 0;
+		memset(pmadapter, pmadapter->pscan_table, 0,
+		       (sizeof(BSSDescriptor_t) * MRVDRV_MAX_BSSID_LIST));
+		memset(pmadapter, pmadapter->bcn_buf, 0,
+		       pmadapter->bcn_buf_size);
+		pmadapter->pbcn_buf_end = pmadapter->bcn_buf;
+	}
 	pmadapter->active_scan_triggered = MFALSE;
 	if (!pmadapter->init_para.ext_scan)
 		pmadapter->ext_scan = EXT_SCAN_TYPE_ENH;
@@ -671,9 +677,6 @@ t_void wlan_init_adapter(pmlan_adapter pmadapter)
 	pmadapter->ext_scan_timeout = MFALSE;
 	pmadapter->scan_probes = DEFAULT_PROBES;
 
-	memset(pmadapter, pmadapter->bcn_buf, 0, pmadapter->bcn_buf_size);
-	pmadapter->pbcn_buf_end = pmadapter->bcn_buf;
-
 	pmadapter->radio_on = RADIO_ON;
 	if (!pmadapter->multiple_dtim)
 		pmadapter->multiple_dtim = MRVDRV_DEFAULT_MULTIPLE_DTIM;
@@ -705,6 +708,11 @@ t_void wlan_init_adapter(pmlan_adapter pmadapter)
 
 	pmadapter->pm_wakeup_fw_try = MFALSE;
 
+	pmadapter->ps_sleep_start = 0;
+	pmadapter->ps_wake_start = 0;
+	pmadapter->ps_xfer_seen = MTRUE;
+	pmadapter->ps_holding = MFALSE;
+
 	if (!pmadapter->init_para.max_tx_buf)
 		pmadapter->max_tx_buf_size =
 			pmadapter->pcard_info->max_tx_buf_size;
@@ -781,6 +789,7 @@ t_void wlan_init_adapter(pmlan_adapter pmadapter)
 	pmadapter->pmlan_buffer_event = MNULL;
 	memset(pmadapter, &pmadapter->region_channel, 0,
 	       sizeof(pmadapter->region_channel));
+	wlan_cfp_index_invalidate(pmadapter);
 	pmadapter->region_code = 0;
 	memcpy_ext(pmadapter, pmadapter->country_code,
 		   MRVDRV_DEFAULT_COUNTRY_CODE, COUNTRY_CODE_LEN,
@@ -944,6 +953,12 @@ mlan_status wlan_init_lock_list(pmlan_adapter pmadapter)
 		ret = MLAN_STATUS_FAILURE;
 		goto error;
 	}
+	if (pcb->moal_init_lock(pmadapter->pmoal_handle,
+				&pmadapter->prxreorder_lock) !=
+	    MLAN_STATUS_SUCCESS) {
+		ret = MLAN_STATUS_FAILURE;
+		goto error;
+	}
 
 	util_init_list_head((t_void *)pmadapter->pmoal_handle,
 			    &pmadapter->rx_data_queue, MTRUE,
@@ -1006,6 +1021,9 @@ t_void wlan_free_lock_list(pmlan_adapter pmadapter)
 	if (pmadapter->pmlan_cmd_lock)
 		pcb->moal_free_lock(pmadapter->pmoal_handle,
 				    pmadapter->pmlan_cmd_lock);
+	if (pmadapter->prxreorder_lock)
+		pcb->moal_free_lock(pmadapter->pmoal_handle,
+				    pmadapter->prxreorder_lock);
 
 	for (i = 0; i < pmadapter->priv_num; i++) {
 		if (pmadapter->priv[i]) {
@@ -1123,6 +1141,22 @@ mlan_status wlan_init_timer(pmlan_adapter pmadapter)
 		goto error;
 	}
 	pmadapter->wakeup_fw_timer_is_set = MFALSE;
+	if (pcb->moal_init_timer(pmadapter->pmoal_handle,
+				 &pmadapter->pps_hold_timer,
+				 wlan_ps_hold_timeout_func,
+				 pmadapter) != MLAN_STATUS_SUCCESS) {
+		ret = MLAN_STATUS_FAILURE;
+		goto error;
+	}
+	pmadapter->ps_hold_timer_is_set = MFALSE;
+	if (pcb->moal_init_timer(pmadapter->pmoal_handle,
+				 &pmadapter->prxreorder_timer,
+				 wlan_11n_rxreorder_timeout_func,
+				 pmadapter) != MLAN_STATUS_SUCCESS) {
+		ret = MLAN_STATUS_FAILURE;
+		goto error;
+	}
+	pmadapter->rxreorder_timer_is_set = MFALSE;
 error:
 	LEAVE();
 	return ret;
@@ -1149,6 +1183,14 @@ t_void wlan_free_timer(pmlan_adapter pmadapter)
 		pcb->moal_free_timer(pmadapter->pmoal_handle,
 				     pmadapter->pwakeup_fw_timer);
 
+	if (pmadapter->pps_hold_timer)
+		pcb->moal_free_timer(pmadapter->pmoal_handle,
+				     pmadapter->pps_hold_timer);
+
+	if (pmadapter->prxreorder_timer)
+		pcb->moal_free_timer(pmadapter->pmoal_handle,
+				     pmadapter->prxreorder_timer);
+
 	LEAVE();
 	return;
 }
@@ -1420,6 +1462,18 @@ t_void wlan_free_adapter(pmlan_adapter pmadapter)
 				     pmadapter->pwakeup_fw_timer);
 		pmadapter->wakeup_fw_timer_is_set = MFALSE;
 	}
+	if (pmadapter->ps_hold_timer_is_set) {
+		/* Cancel sleep confirm hold-off timer */
+		pcb->moal_stop_timer(pmadapter->pmoal_handle,
+				     pmadapter->pps_hold_timer);
+		pmadapter->ps_hold_timer_is_set = MFALSE;
+	}
+	if (pmadapter->rxreorder_timer_is_set) {
+		/* Cancel rx reorder flush timer */
+		pcb->moal_stop_timer(pmadapter->pmoal_handle,
+				     pmadapter->prxreorder_timer);
+		pmadapter->rxreorder_timer_is_set = MFALSE;
+	}
 	wlan_free_fw_cfp_tables(pmadapter);
 #ifdef STA_SUPPORT
 	PRINTM(MINFO, "Free ScanTable\n");
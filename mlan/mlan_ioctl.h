@@ -127,6 +127,9 @@ enum _mlan_ioctl_req_id {
 	MLAN_OID_GET_SIGNAL_EXT = 0x00050008,
 	MLAN_OID_LINK_STATS = 0x00050009,
 	MLAN_OID_GET_UAP_STATS_LOG = 0x0005000A,
+#ifdef UAP_SUPPORT
+	MLAN_OID_UAP_STA_STATS = 0x0005000B,
+#endif
 	/* Security Configuration Group */
 	MLAN_IOCTL_SEC_CFG = 0x00060000,
 	MLAN_OID_SEC_CFG_AUTH_MODE = 0x00060001,
@@ -238,6 +241,7 @@ enum _mlan_ioctl_req_id {
 #endif
 	MLAN_OID_11H_CHAN_DFS_STATE = 0x00110007,
 	MLAN_OID_11H_DFS_W53_CFG = 0x00110008,
+	MLAN_OID_11H_CHAN_DFS_STATE_MAP = 0x00110009,
 
 	/* 802.11n Configuration Group RANDYTODO for value assign */
 	MLAN_IOCTL_11AC_CFG = 0x00120000,
@@ -2218,6 +2222,9 @@ typedef struct {
 /** Debug command number */
 #define DBG_CMD_NUM 10
 
+/** Power save histogram buckets */
+#define PS_HIST_NUM 16
+
 /** sdio mp debug number */
 #define SDIO_MP_DBG_NUM 10
 
@@ -2356,6 +2363,14 @@ typedef struct _mlan_debug_info {
 	t_u32 last_int_status;
 	/** number of interrupt receive */
 	t_u32 num_of_irq;
+	/** number of interrupt status polls that found work */
+	t_u32 num_int_poll;
+	/** number of data packets read from the card */
+	t_u32 num_sdio_rx_pkt;
+	/** number of data packets written to the card */
+	t_u32 num_sdio_tx_pkt;
+	/** interrupts per 1000 data packets */
+	t_u32 irq_per_kpkt;
 	/** flag for sdio rx aggr */
 	t_u8 sdio_rx_aggr;
 	/** FW update port number */
@@ -2425,12 +2440,42 @@ typedef struct _mlan_debug_info {
 	t_u16 last_cmd_resp_id[DBG_CMD_NUM];
 	/** Last command response index */
 	t_u16 last_cmd_resp_index;
+	/** Round trip time in us of last commands */
+	t_u32 last_cmd_rtt[DBG_CMD_NUM];
+	/** Pending queue wait in us of last commands */
+	t_u32 last_cmd_wait[DBG_CMD_NUM];
+	/** Number of command round trips measured */
+	t_u32 num_cmd_rtt;
+	/** Average command round trip time in us */
+	t_u32 cmd_rtt_avg;
+	/** Max command round trip time in us */
+	t_u32 cmd_rtt_max;
 	/** List of last events */
 	t_u16 last_event[DBG_CMD_NUM];
 	/** Last event index */
 	t_u16 last_event_index;
 	/** Number of no free command node */
 	t_u16 num_no_cmd_node;
+	/** Number of commands served from the response cache */
+	t_u32 num_cmd_cache_hit;
+	/** Number of cacheable commands sent to firmware */
+	t_u32 num_cmd_cache_miss;
+	/** Number of BSS entries parsed from scan responses */
+	t_u32 num_scan_bss_parsed;
+	/** BSS entries parsed per second of scan response handling */
+	t_u32 scan_parse_rate;
+	/** Number of sleep confirms held off after recent traffic */
+	t_u32 num_ps_hold;
+	/** Number of hold-offs that saw traffic before they expired */
+	t_u32 num_ps_hold_hit;
+	/** Number of wakeups that went back to sleep without traffic */
+	t_u32 num_ps_idle_wake;
+	/** Average gap in us between traffic bursts */
+	t_u32 ps_burst_gap;
+	/** Sleep duration histogram, bucket n counts [2^(n-1), 2^n) ms */
+	t_u32 ps_sleep_hist[PS_HIST_NUM];
+	/** Wake latency histogram, bucket n counts [2^(n-1), 2^n) us */
+	t_u32 ps_wake_hist[PS_HIST_NUM];
 	/** pending command id */
 	t_u16 pending_cmd;
 	/** time stamp for dnld last cmd */
@@ -2503,6 +2548,46 @@ typedef struct _mlan_ds_sta_list {
 	sta_info_data info[MAX_NUM_CLIENTS];
 	/* ie_buf will be append at the end */
 } mlan_ds_sta_list, *pmlan_ds_sta_list;
+
+/** per-station traffic counters maintained by the driver */
+typedef struct _sta_traffic_stats {
+	/** packets received from the station */
+	t_u64 rx_packets;
+	/** bytes received from the station */
+	t_u64 rx_bytes;
+	/** packets queued to the station */
+	t_u64 tx_packets;
+	/** bytes queued to the station */
+	t_u64 tx_bytes;
+	/** rate of the last received packet in 500Kbps (legacy) or MCS */
+	t_u16 rx_rate;
+	/** rate info of the last received packet */
+	t_u8 rx_rate_info;
+	/** RSSI reported by firmware in the last station list */
+	t_s8 fw_rssi;
+} sta_traffic_stats;
+
+/** station statistics entry */
+typedef struct _sta_stats_data {
+	/** STA MAC address */
+	t_u8 mac_address[MLAN_MAC_ADDR_LENGTH];
+	/** SNR of the last received packet */
+	t_s8 snr;
+	/** Noise floor of the last received packet */
+	t_s8 nf;
+	/** last rx time in msec */
+	t_u64 last_rx_in_msec;
+	/** traffic counters */
+	sta_traffic_stats traffic;
+} sta_stats_data;
+
+/** mlan_ds_sta_stats structure for MLAN_OID_UAP_STA_STATS */
+typedef struct _mlan_ds_sta_stats {
+	/** station count */
+	t_u16 sta_count;
+	/** station statistics */
+	sta_stats_data info[MAX_NUM_CLIENTS];
+} mlan_ds_sta_stats, *pmlan_ds_sta_stats;
 #endif
 
 /** Type definition of mlan_ds_get_info for MLAN_IOCTL_GET_INFO */
@@ -2535,6 +2620,8 @@ typedef struct _mlan_ds_get_info {
 		mlan_ds_uap_stats ustats;
 		/** UAP station list for MLAN_OID_UAP_STA_LIST */
 		mlan_ds_sta_list sta_list;
+		/** UAP station statistics for MLAN_OID_UAP_STA_STATS */
+		mlan_ds_sta_stats sta_stats;
 #endif
 	} param;
 } mlan_ds_get_info, *pmlan_ds_get_info;
@@ -4294,6 +4381,17 @@ typedef struct _mlan_ds_11h_chan_dfs_state {
 	dfs_state_t dfs_state;
 } mlan_ds_11h_chan_dfs_state;
 
+/** Max number of channels for MLAN_OID_11H_CHAN_DFS_STATE_MAP */
+#define MAX_DFS_STATE_MAP_CHAN 32
+
+/** dfs state of all DFS channels for MLAN_OID_11H_CHAN_DFS_STATE_MAP */
+typedef struct _mlan_ds_11h_dfs_state_map {
+	/** number of channels */
+	t_u8 num_chan;
+	/** dfs state per channel */
+	mlan_ds_11h_chan_dfs_state chan[MAX_DFS_STATE_MAP_CHAN];
+} mlan_ds_11h_dfs_state_map;
+
 typedef struct _mlan_ds_11h_dfs_w53_cfg {
 	/** dfs w53 cfg */
 	t_u8 dfs53cfg;
@@ -4320,6 +4418,8 @@ typedef struct _mlan_ds_11h_cfg {
 		/** channel dfs state for MLAN_OID_11H_CHAN_DFS_STATE */
 		mlan_ds_11h_chan_dfs_state ch_dfs_state;
 		mlan_ds_11h_dfs_w53_cfg dfs_w53_cfg;
+		/** dfs state map for MLAN_OID_11H_CHAN_DFS_STATE_MAP */
+		mlan_ds_11h_dfs_state_map dfs_state_map;
 	} param;
 } mlan_ds_11h_cfg, *pmlan_ds_11h_cfg;
 
@@ -5505,6 +5605,9 @@ typedef struct _mlan_ds_ch_load {
 	t_u16 ch_load_param;
 } mlan_ds_ch_load;
 
+/** fw_reload of MLAN_OID_MISC_WARM_RESET: reload, keep the scan table */
+#define MLAN_FW_RELOAD_KEEP_SCAN 2
+
 /** Type definition of mlan_ds_misc_cfg for MLAN_IOCTL_MISC_CFG */
 typedef struct _mlan_ds_misc_cfg {
 	/** Sub-command */
@@ -180,6 +180,15 @@ extern t_u32 mlan_drvdbg;
 			print_callback(MNULL, MHEX_DUMP | level, x, y, z);     \
 	} while (0)
 
+/** Record a binary event in the moal trace ring */
+#define MTRACE(pmadapter, event, arg0, arg1)                                   \
+	do {                                                                   \
+		if ((mlan_drvdbg & MTRACE_D) &&                                \
+		    (pmadapter)->callbacks.moal_trace)                         \
+			(pmadapter)->callbacks.moal_trace(                     \
+				(pmadapter)->pmoal_handle, event, arg0, arg1); \
+	} while (0)
+
 #else /* DEBUG_LEVEL1 */
 
 #define PRINTM(level, msg...)                                                  \
@@ -204,6 +213,10 @@ extern t_u32 mlan_drvdbg;
 	do {                                                                   \
 	} while (0)
 
+#define MTRACE(pmadapter, event, arg0, arg1)                                   \
+	do {                                                                   \
+	} while (0)
+
 #endif /* DEBUG_LEVEL1 */
 
 /* Reason Code 3: STA is leaving (or has left) IBSS or ESS */
@@ -474,6 +487,14 @@ extern t_void (*assert_callback)(t_void *pmoal_handle, t_u32 cond);
 
 /** The first valid channel for use */
 #define FIRST_VALID_CHANNEL 0xff
+/** Number of band classes in the CFP lookup index (BG and A) */
+#define CFP_INDEX_BAND_NUM 2
+/** Channels covered by the CFP lookup index */
+#define CFP_INDEX_CHAN_NUM 256
+/** CFP lookup index band class for 2.4GHz */
+#define CFP_INDEX_BAND_BG 0
+/** CFP lookup index band class for 5GHz */
+#define CFP_INDEX_BAND_A 1
 /** Default Ad-Hoc channel */
 #define DEFAULT_AD_HOC_CHANNEL 6
 /** Default Ad-Hoc channel A */
@@ -627,12 +648,40 @@ typedef struct _wlan_dbg {
 	t_u16 last_cmd_resp_id[DBG_CMD_NUM];
 	/** Last command response index */
 	t_u16 last_cmd_resp_index;
+	/** Round trip time in us of last commands, by last_cmd_index */
+	t_u32 last_cmd_rtt[DBG_CMD_NUM];
+	/** Pending queue wait in us of last commands, by last_cmd_index */
+	t_u32 last_cmd_wait[DBG_CMD_NUM];
+	/** Number of command round trips measured */
+	t_u32 num_cmd_rtt;
+	/** Sum of command round trip times in us */
+	t_u64 cmd_rtt_total;
+	/** Max command round trip time in us */
+	t_u32 cmd_rtt_max;
 	/** List of last events */
 	t_u16 last_event[DBG_CMD_NUM];
 	/** Last event index */
 	t_u16 last_event_index;
 	/** Number of no free command node */
 	t_u16 num_no_cmd_node;
+	/** Number of commands served from the response cache */
+	t_u32 num_cmd_cache_hit;
+	/** Number of cacheable commands sent to firmware */
+	t_u32 num_cmd_cache_miss;
+	/** Number of BSS entries parsed from scan responses */
+	t_u32 num_scan_bss_parsed;
+	/** Time spent parsing scan responses in us */
+	t_u32 scan_parse_time;
+	/** Number of sleep confirms held off after recent traffic */
+	t_u32 num_ps_hold;
+	/** Number of hold-offs that saw traffic before they expired */
+	t_u32 num_ps_hold_hit;
+	/** Number of wakeups that went back to sleep without traffic */
+	t_u32 num_ps_idle_wake;
+	/** Sleep duration histogram, bucket n counts [2^(n-1), 2^n) ms */
+	t_u32 ps_sleep_hist[PS_HIST_NUM];
+	/** Wake latency histogram, bucket n counts [2^(n-1), 2^n) us */
+	t_u32 ps_wake_hist[PS_HIST_NUM];
 } wlan_dbg;
 
 /** Hardware status codes */
@@ -783,6 +832,8 @@ typedef struct _wmm_desc {
 
 	/** Max driver packet delay sent to the firmware for expiry eval */
 	t_u32 drv_pkt_delay_max;
+	/** TX packets need a queue timestamp (admission control active) */
+	t_u8 tx_tstamp_req;
 
 	/** WMM queue priority table */
 	t_u8 queue_priority[MAX_AC_QUEUES];
@@ -1341,8 +1392,8 @@ struct _TxBAStreamTbl {
 typedef struct _RxReorderTbl RxReorderTbl;
 
 typedef struct {
-	/** Timer for flushing */
-	t_void *timer;
+	/** Flush deadline in ms, served by the adapter reorder timer */
+	t_u32 expiry;
 	/** Timer set flag */
 	t_u8 timer_is_set;
 	/** RxReorderTbl ptr */
@@ -1367,8 +1418,12 @@ struct _RxReorderTbl {
 	int last_seq;
 	/** Window size */
 	int win_size;
-	/** Pointer to pointer to RxReorderTbl */
+	/** Pointer to pointer to RxReorderTbl, ring of win_size slots */
 	t_void **rx_reorder_ptr;
+	/** Ring slot of start_win in rx_reorder_ptr */
+	int win_base;
+	/** Occupancy bitmap of rx_reorder_ptr, one bit per ring slot */
+	t_u32 *rx_reorder_bitmap;
 	/** Timer context */
 	reorder_tmr_cnxt_t timer_context;
 	/** BA stream status */
@@ -1433,8 +1488,35 @@ struct _cmd_ctrl_node {
 	t_void *pioctl_buf;
 	/** pre_allocated mlan_buffer for cmd */
 	mlan_buffer *pmbuf;
+	/** Time in us the command was queued */
+	t_u64 queue_ts;
+	/** Time in us the command was downloaded */
+	t_u64 dnld_ts;
+	/** Hash of the command body, valid with CMD_F_CACHE */
+	t_u32 cache_key;
 };
 
+/** Number of cached command responses */
+#define CMD_CACHE_NUM 8
+/** Max size of a cached command response */
+#define CMD_CACHE_RESP_SIZE 512
+
+/** Cached response of a read-only firmware command */
+typedef struct _cmd_cache_entry {
+	/** Command number, 0 if the entry is free */
+	t_u16 cmd_no;
+	/** BSS index of the command */
+	t_u8 bss_index;
+	/** Hash of the command body */
+	t_u32 key;
+	/** Time in us the entry expires */
+	t_u64 expiry;
+	/** Response length */
+	t_u16 resp_len;
+	/** Response with the header already in host order */
+	t_u8 resp[CMD_CACHE_RESP_SIZE];
+} cmd_cache_entry;
+
 /** default tdls wmm qosinfo */
 #define DEFAULT_TDLS_WMM_QOS_INFO 15
 /** default tdls sleep period */
@@ -1525,6 +1607,10 @@ struct _sta_node {
 	t_void *cm_connectioninfo;
 #endif
 	sta_stats stats;
+#ifdef UAP_SUPPORT
+	/** driver maintained traffic counters */
+	sta_traffic_stats traffic;
+#endif
 };
 
 /** 802.11h State information kept in the 'mlan_adapter' driver structure */
@@ -1562,15 +1648,14 @@ enum _dfs_timestamp_repr_e {
 	DFS_TS_REPR_CAC_COMPLETION
 };
 
+/** Number of DFS timestamp entries, indexed by channel number */
+#define DFS_TS_CHAN_NUM 256
+
 /** DFS Timestamp type used for marking NOP/CAC events */
 typedef struct _wlan_dfs_timestamp_t wlan_dfs_timestamp_t;
 
 /** DFS Timestamp type used for marking NOP/CAC events */
 struct _wlan_dfs_timestamp_t {
-	/** Pointer to previous node */
-	wlan_dfs_timestamp_t *pprev;
-	/** Pointer to next node */
-	wlan_dfs_timestamp_t *pnext;
 	/** WLAN Channel number */
 	t_u8 channel;
 	/** What this timestamp represents */
@@ -1597,8 +1682,12 @@ typedef struct {
 	 * to determine if data is old or not.
 	 */
 	t_u32 dfs_report_time_sec;
-	/** List for holding dfs_timestamps for NOP/CAC events */
-	mlan_list_head dfs_ts_head;
+	/** dfs_timestamps for NOP/CAC events, indexed by channel */
+	wlan_dfs_timestamp_t dfs_ts[DFS_TS_CHAN_NUM];
+	/** Number of channels under NOP */
+	t_u16 dfs_nop_count;
+	/** Lower bound of the NOP start times (sec), checked for expiry */
+	t_u32 dfs_nop_oldest_sec;
 } wlan_dfs_device_state_t;
 
 /** Enumeration for mlan_ds_11h_radar_det_hndlg stages */
@@ -1904,6 +1993,14 @@ typedef struct _mlan_sdio_card {
 	t_u32 ioport;
 	/** number of interrupt receive */
 	t_u32 num_of_irq;
+	/** number of interrupt status polls that found work */
+	t_u32 num_int_poll;
+	/** interrupt status read from mlan_interrupt_poll */
+	t_u8 int_polling;
+	/** number of data packets read from the card */
+	t_u32 num_rx_pkt;
+	/** number of data packets written to the card */
+	t_u32 num_tx_pkt;
 	/** max SDIO single port tx size */
 	t_u16 max_sp_tx_size;
 	/** max SDIO single port rx size */
@@ -2199,6 +2296,10 @@ typedef struct _mlan_adapter {
 	mlan_list_head scan_pending_q;
 	/** ioctl pending queue */
 	mlan_list_head ioctl_pending_q;
+	/** Command response cache lifetime in ms, 0 to disable */
+	t_u32 cmd_cache_ttl;
+	/** Command response cache */
+	cmd_cache_entry cmd_cache[CMD_CACHE_NUM];
 	/** pending_ioctl flag */
 	t_u8 pending_ioctl;
 	pmlan_private pending_disconnect_priv;
@@ -2234,6 +2335,20 @@ typedef struct _mlan_adapter {
 	t_u8 cfp_code_bg;
 	/** CFP table code for 5GHz */
 	t_u8 cfp_code_a;
+	/** CFP lookup index needs to be rebuilt */
+	t_u8 cfp_index_dirty;
+#ifdef STA_SUPPORT
+	/** 11D was in use by a station when the CFP index was built */
+	t_u8 cfp_index_11d;
+	/** region_channel CFP by band class and channel */
+	chan_freq_power_t *cfp_index[CFP_INDEX_BAND_NUM][CFP_INDEX_CHAN_NUM];
+	/** region_channel first CFP by band class */
+	chan_freq_power_t *cfp_index_first[CFP_INDEX_BAND_NUM];
+	/** universal_channel CFP by band class and channel */
+	chan_freq_power_t *cfp_index_un[CFP_INDEX_BAND_NUM][CFP_INDEX_CHAN_NUM];
+	/** universal_channel first CFP by band class */
+	chan_freq_power_t *cfp_index_un_first[CFP_INDEX_BAND_NUM];
+#endif
 	wmm_ac_parameters_t ac_params[MAX_AC_QUEUES];
 	/** Minimum BA Threshold */
 	t_u8 min_ba_threshold;
@@ -2389,6 +2504,32 @@ typedef struct _mlan_adapter {
 	t_void *pwakeup_fw_timer;
 	/** Card wakeup timer */
 	t_u8 wakeup_fw_timer_is_set;
+	/** Max sleep confirm hold-off in ms, 0 to disable */
+	t_u32 ps_hold_max;
+	/** Average gap in us between traffic bursts */
+	t_u32 ps_burst_gap;
+	/** Time stamp in us of the last data transfer */
+	t_u64 ps_last_xfer;
+	/** Time stamp in us the card went to sleep, 0 if awake */
+	t_u64 ps_sleep_start;
+	/** Time stamp in us the card wakeup was requested, 0 if none */
+	t_u64 ps_wake_start;
+	/** Data was transferred since the card woke up */
+	t_u8 ps_xfer_seen;
+	/** Sleep confirm is being held off */
+	t_u8 ps_holding;
+	/** Sleep confirm hold-off timer */
+	t_void *pps_hold_timer;
+	/** Sleep confirm hold-off timer set flag */
+	t_u8 ps_hold_timer_is_set;
+	/** RX reorder flush timer shared by all reorder tables */
+	t_void *prxreorder_timer;
+	/** RX reorder flush timer set flag */
+	t_u8 rxreorder_timer_is_set;
+	/** RX reorder flush timer expiry in ms */
+	t_u32 rxreorder_timer_expiry;
+	/** Lock for the RX reorder flush timer and table deadlines */
+	t_void *prxreorder_lock;
 	/** Number of wake up timeouts */
 	t_u32 pm_wakeup_timeout;
 
@@ -2471,6 +2612,8 @@ typedef struct _mlan_adapter {
 #ifdef STA_SUPPORT
 	/** warm-reset IOCTL request buffer pointer */
 	pmlan_ioctl_req pwarm_reset_ioctl_req;
+	/** Keep the scan table across wlan_init_adapter */
+	t_u8 keep_scan_table;
 #endif
 	/** SCAN IOCTL request buffer pointer */
 	pmlan_ioctl_req pscan_ioctl_req;
@@ -2723,6 +2866,14 @@ mlan_status wlan_ret_rx_mgmt_ind(pmlan_private pmpriv, HostCmd_DS_COMMAND *resp,
 
 /** Check Power Save condition */
 t_void wlan_check_ps_cond(mlan_adapter *pmadapter);
+/** Sleep confirm hold-off timeout */
+t_void wlan_ps_hold_timeout_func(t_void *function_context);
+/** Account a data transfer for power save */
+t_void wlan_ps_note_xfer(mlan_adapter *pmadapter);
+/** Account a sleep confirm for power save */
+t_void wlan_ps_note_sleep(mlan_adapter *pmadapter);
+/** Account a card wakeup for power save */
+t_void wlan_ps_note_awake(mlan_adapter *pmadapter);
 
 /** handle command for enhanced power save mode */
 mlan_status wlan_cmd_enh_power_mode(pmlan_private pmpriv,
@@ -2962,6 +3113,10 @@ t_s32 wlan_find_ssid_in_list(pmlan_private pmpriv, mlan_802_11_ssid *ssid,
 /** Find a BSSID in a list */
 t_s32 wlan_find_bssid_in_list(mlan_private *pmpriv, t_u8 *bssid, t_u32 mode);
 
+/** Find an IE of a BSS entry through its IE index */
+t_u8 *wlan_bss_get_ie(BSSDescriptor_t *pbss_entry, t_u8 element_id,
+		      t_u8 *pprev);
+
 /** Find best network */
 mlan_status wlan_find_best_network(mlan_private *pmpriv,
 				   mlan_ssid_bssid *preq_ssid_bssid);
@@ -3058,6 +3213,10 @@ t_void wlan_free_curr_bcn(mlan_private *pmpriv);
 
 #endif /* STA_SUPPORT */
 
+/** Mark the Channel-Frequency-Power lookup index for rebuild */
+#define wlan_cfp_index_invalidate(pmadapter)                                   \
+	((pmadapter)->cfp_index_dirty = MTRUE)
+
 /* Rate related functions */
 /** Convert index into data rate */
 t_u32 wlan_index_to_data_rate(pmlan_adapter pmadapter, t_u8 index,
@@ -3810,6 +3969,8 @@ typedef enum _delay_unit {
 	SEC,
 } t_delay_unit;
 
+/** current system time in us */
+t_u64 wlan_get_time_us(mlan_adapter *pmadapter);
 /** delay function */
 t_void wlan_delay_func(mlan_adapter *pmadapter, t_u32 delay, t_delay_unit u);
 
@@ -427,6 +427,7 @@ mlan_status wlan_get_info_debug_info(pmlan_adapter pmadapter,
 				     pmlan_ioctl_req pioctl_req)
 {
 	pmlan_private pmpriv = pmadapter->priv[pioctl_req->bss_index];
+	pmlan_callbacks pcb = &pmadapter->callbacks;
 	mlan_status ret = MLAN_STATUS_SUCCESS;
 	mlan_ds_get_info *info;
 	mlan_debug_info *debug_info = MNULL;
@@ -523,12 +524,50 @@ mlan_status wlan_get_info_debug_info(pmlan_adapter pmadapter,
 			   sizeof(debug_info->last_cmd_resp_id));
 		debug_info->last_cmd_resp_index =
 			pmadapter->dbg.last_cmd_resp_index;
+		memcpy_ext(pmadapter, debug_info->last_cmd_rtt,
+			   pmadapter->dbg.last_cmd_rtt,
+			   sizeof(pmadapter->dbg.last_cmd_rtt),
+			   sizeof(debug_info->last_cmd_rtt));
+		memcpy_ext(pmadapter, debug_info->last_cmd_wait,
+			   pmadapter->dbg.last_cmd_wait,
+			   sizeof(pmadapter->dbg.last_cmd_wait),
+			   sizeof(debug_info->last_cmd_wait));
+		debug_info->num_cmd_rtt = pmadapter->dbg.num_cmd_rtt;
+		debug_info->cmd_rtt_avg = 0;
+		if (pmadapter->dbg.num_cmd_rtt)
+			debug_info->cmd_rtt_avg = (t_u32)pcb->moal_do_div(
+				pmadapter->dbg.cmd_rtt_total,
+				pmadapter->dbg.num_cmd_rtt);
+		debug_info->cmd_rtt_max = pmadapter->dbg.cmd_rtt_max;
 		memcpy_ext(pmadapter, debug_info->last_event,
 			   pmadapter->dbg.last_event,
 			   sizeof(pmadapter->dbg.last_event),
 			   sizeof(debug_info->last_event));
 		debug_info->last_event_index = pmadapter->dbg.last_event_index;
 		debug_info->num_no_cmd_node = pmadapter->dbg.num_no_cmd_node;
+		debug_info->num_cmd_cache_hit = pmadapter->dbg.num_cmd_cache_hit;
+		debug_info->num_cmd_cache_miss =
+			pmadapter->dbg.num_cmd_cache_miss;
+		debug_info->num_scan_bss_parsed =
+			pmadapter->dbg.num_scan_bss_parsed;
+		debug_info->scan_parse_rate = 0;
+		if (pmadapter->dbg.scan_parse_time)
+			debug_info->scan_parse_rate = (t_u32)pcb->moal_do_div(
+				(t_u64)pmadapter->dbg.num_scan_bss_parsed *
+					1000000,
+				pmadapter->dbg.scan_parse_time);
+		debug_info->num_ps_hold = pmadapter->dbg.num_ps_hold;
+		debug_info->num_ps_hold_hit = pmadapter->dbg.num_ps_hold_hit;
+		debug_info->num_ps_idle_wake = pmadapter->dbg.num_ps_idle_wake;
+		debug_info->ps_burst_gap = pmadapter->ps_burst_gap;
+		memcpy_ext(pmadapter, debug_info->ps_sleep_hist,
+			   pmadapter->dbg.ps_sleep_hist,
+			   sizeof(pmadapter->dbg.ps_sleep_hist),
+			   sizeof(debug_info->ps_sleep_hist));
+		memcpy_ext(pmadapter, debug_info->ps_wake_hist,
+			   pmadapter->dbg.ps_wake_hist,
+			   sizeof(pmadapter->dbg.ps_wake_hist),
+			   sizeof(debug_info->ps_wake_hist));
 		debug_info->pending_cmd =
 			(pmadapter->curr_cmd) ?
 				pmadapter->dbg.last_cmd_id
@@ -556,6 +595,19 @@ mlan_status wlan_get_info_debug_info(pmlan_adapter pmadapter,
 				pmadapter->pcard_sd->mp_invalid_update;
 			debug_info->num_of_irq =
 				pmadapter->pcard_sd->num_of_irq;
+			debug_info->num_int_poll =
+				pmadapter->pcard_sd->num_int_poll;
+			debug_info->num_sdio_rx_pkt =
+				pmadapter->pcard_sd->num_rx_pkt;
+			debug_info->num_sdio_tx_pkt =
+				pmadapter->pcard_sd->num_tx_pkt;
+			debug_info->irq_per_kpkt = 0;
+			if (debug_info->num_sdio_rx_pkt ||
+			    debug_info->num_sdio_tx_pkt)
+				debug_info->irq_per_kpkt = (t_u32)pcb->moal_do_div(
+					(t_u64)debug_info->num_of_irq * 1000,
+					debug_info->num_sdio_rx_pkt +
+						debug_info->num_sdio_tx_pkt);
 			memcpy_ext(pmadapter, debug_info->mp_update,
 				   pmadapter->pcard_sd->mp_update,
 				   sizeof(pmadapter->pcard_sd->mp_update),
@@ -993,11 +1045,12 @@ pmlan_buffer wlan_alloc_mlan_buffer(mlan_adapter *pmadapter, t_u32 data_len,
 		data_len = (data_len + MLAN_SDIO_BLOCK_SIZE - 1) /
 			   MLAN_SDIO_BLOCK_SIZE * MLAN_SDIO_BLOCK_SIZE;
 
-	/* head_room is not implemented for malloc mlan buffer */
-
 	switch (malloc_flag) {
 	case MOAL_MALLOC_BUFFER:
-		buf_size = sizeof(mlan_buffer) + data_len + DMA_ALIGNMENT;
+		/* Keep the data DMA aligned after the head_room */
+		head_room = ALIGN_SZ(head_room, DMA_ALIGNMENT);
+		buf_size = sizeof(mlan_buffer) + head_room + data_len +
+			   DMA_ALIGNMENT;
 		ret = pcb->moal_malloc(pmadapter->pmoal_handle, buf_size,
 				       MLAN_MEM_DEF | MLAN_MEM_DMA,
 				       (t_u8 **)&pmbuf);
@@ -1011,7 +1064,7 @@ pmlan_buffer wlan_alloc_mlan_buffer(mlan_adapter *pmadapter, t_u32 data_len,
 		/* Align address */
 		pmbuf->pbuf = (t_u8 *)ALIGN_ADDR(
 			(t_u8 *)pmbuf + sizeof(mlan_buffer), DMA_ALIGNMENT);
-		pmbuf->data_offset = 0;
+		pmbuf->data_offset = head_room;
 		pmbuf->data_len = data_len;
 		pmbuf->flags |= MLAN_BUF_FLAG_MALLOC_BUF;
 		break;
@@ -1071,6 +1124,22 @@ t_void wlan_free_mlan_buffer(mlan_adapter *pmadapter, pmlan_buffer pmbuf)
 	return;
 }
 
+/**
+ *  @brief This function returns the current system time in us
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *
+ *  @return             Time in us
+ */
+t_u64 wlan_get_time_us(mlan_adapter *pmadapter)
+{
+	t_u32 sec = 0, usec = 0;
+
+	pmadapter->callbacks.moal_get_system_time(pmadapter->pmoal_handle,
+						  &sec, &usec);
+	return (t_u64)sec * 1000000 + usec;
+}
+
 /**
  *  @brief Delay function implementation
  *
@@ -1185,6 +1254,7 @@ mlan_status wlan_bss_ioctl_bss_role(pmlan_adapter pmadapter,
 		wlan_free_priv(pmpriv);
 
 		pmpriv->bss_role = bss->param.bss_role;
+		wlan_cfp_index_invalidate(pmadapter);
 		if (pmpriv->bss_type == MLAN_BSS_TYPE_UAP)
 			pmpriv->bss_type = MLAN_BSS_TYPE_STA;
 		else if (pmpriv->bss_type == MLAN_BSS_TYPE_STA)
@@ -43,6 +43,7 @@ EXPORT_SYMBOL(mlan_rx_process);
 EXPORT_SYMBOL(mlan_select_wmm_queue);
 EXPORT_SYMBOL(mlan_process_deaggr_pkt);
 EXPORT_SYMBOL(mlan_interrupt);
+EXPORT_SYMBOL(mlan_interrupt_poll);
 #if defined(SYSKT)
 EXPORT_SYMBOL(mlan_hs_callback);
 #endif /* SYSKT_MULTI || SYSKT */
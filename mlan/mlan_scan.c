@@ -1669,6 +1669,25 @@ static t_void wlan_ret_802_11_scan_get_tlv_ptrs(pmlan_adapter pmadapter,
 	LEAVE();
 }
 
+/**
+ *  @brief Account the BSS entries parsed from one scan response
+ *
+ *  @param pmadapter    A pointer to mlan_adapter structure
+ *  @param start        Time in us the parsing started
+ *  @param num          Number of BSS entries parsed
+ *
+ *  @return             N/A
+ */
+static t_void wlan_scan_parse_account(pmlan_adapter pmadapter, t_u64 start,
+				      t_u32 num)
+{
+	t_u64 now = wlan_get_time_us(pmadapter);
+
+	pmadapter->dbg.num_scan_bss_parsed += num;
+	if (now > start)
+		pmadapter->dbg.scan_parse_time += (t_u32)(now - start);
+}
+
 /**
  *  @brief Interpret a BSS scan response returned from the firmware
  *
@@ -1852,6 +1871,12 @@ static mlan_status wlan_interpret_bss_desc_with_ie(pmlan_adapter pmadapter,
 			continue;
 		}
 
+		/* Index the IE so later lookups need not walk the beacon */
+		pbss_entry->ie_map[element_id >> 5] |= MBIT(element_id & 0x1f);
+		if (pbss_entry->ie_num < MAX_BSS_IE_INDEX)
+			pbss_entry->ie_offset[pbss_entry->ie_num++] =
+				(t_u16)(pcurrent_ptr - pbss_entry->pbeacon_buf);
+
 		switch (element_id) {
 		case SSID:
 			if (element_len > MRVDRV_MAX_SSID_LENGTH) {
@@ -2307,6 +2332,54 @@ static mlan_status wlan_interpret_bss_desc_with_ie(pmlan_adapter pmadapter,
 	return ret;
 }
 
+/**
+ *  @brief Find an IE in the stored scan response of a BSS entry
+ *         through its IE index
+ *
+ *  @param pbss_entry   A pointer to BSSDescriptor_t structure
+ *  @param element_id   Element ID to find
+ *  @param pprev        IE to search after, MNULL to find the first one
+ *
+ *  @return             A pointer to the IE, or MNULL if not found
+ */
+t_u8 *wlan_bss_get_ie(BSSDescriptor_t *pbss_entry, t_u8 element_id,
+		      t_u8 *pprev)
+{
+	t_u8 *pbuf = pbss_entry->pbeacon_buf;
+	t_u8 *pos = MNULL;
+	t_u32 prev_offset = 0;
+	t_u32 left;
+	t_u32 i;
+
+	if (!pbuf ||
+	    !(pbss_entry->ie_map[element_id >> 5] & MBIT(element_id & 0x1f)))
+		return MNULL;
+	if (pprev)
+		prev_offset = (t_u32)(pprev - pbuf);
+	for (i = 0; i < pbss_entry->ie_num; i++) {
+		if (pprev && pbss_entry->ie_offset[i] <= prev_offset)
+			continue;
+		pos = pbuf + pbss_entry->ie_offset[i];
+		if (*pos == element_id)
+			return pos;
+	}
+	if (pbss_entry->ie_num < MAX_BSS_IE_INDEX)
+		return MNULL;
+
+	/* Index is full, walk the IEs past its last entry */
+	pos = pbuf + pbss_entry->ie_offset[MAX_BSS_IE_INDEX - 1];
+	pos += *(pos + 1) + sizeof(IEEEtypes_Header_t);
+	left = pbss_entry->beacon_buf_size - (t_u32)(pos - pbuf);
+	while (left >= sizeof(IEEEtypes_Header_t) &&
+	       left >= (t_u32)(*(pos + 1) + sizeof(IEEEtypes_Header_t))) {
+		if (*pos == element_id && (!pprev || pos > pprev))
+			return pos;
+		left -= *(pos + 1) + sizeof(IEEEtypes_Header_t);
+		pos += *(pos + 1) + sizeof(IEEEtypes_Header_t);
+	}
+	return MNULL;
+}
+
 /**
  *  @brief Adjust ie's position in BSSDescriptor_t
  *
@@ -4489,6 +4562,7 @@ mlan_status wlan_ret_802_11_scan(mlan_private *pmpriv, HostCmd_DS_COMMAND *resp,
 	t_u8 null_ssid[MLAN_MAX_SSID_LENGTH] = {0};
 	t_u32 status_code = 0;
 	pmlan_ioctl_req pscan_ioctl_req = MNULL;
+	t_u64 parse_start;
 
 	ENTER();
 	pcb = (pmlan_callbacks)&pmadapter->callbacks;
@@ -4577,6 +4651,7 @@ mlan_status wlan_ret_802_11_scan(mlan_private *pmpriv, HostCmd_DS_COMMAND *resp,
 		goto done;
 	}
 
+	parse_start = wlan_get_time_us(pmadapter);
 	for (idx = 0; idx < pscan_rsp->number_of_sets && bytes_left; idx++) {
 		/* Zero out the bss_new_entry we are about to store info in */
 		memset(pmadapter, bss_new_entry, 0x00, sizeof(BSSDescriptor_t));
@@ -4743,6 +4818,8 @@ mlan_status wlan_ret_802_11_scan(mlan_private *pmpriv, HostCmd_DS_COMMAND *resp,
 		}
 	}
 
+	wlan_scan_parse_account(pmadapter, parse_start, idx);
+
 	PRINTM(MINFO, "SCAN_RESP: Scanned %2d APs, %d valid, %d total\n",
 	       pscan_rsp->number_of_sets,
 	       num_in_table - pmadapter->num_in_scan_table, num_in_table);
@@ -5102,6 +5179,7 @@ static mlan_status wlan_update_ssid_in_beacon_buf(
 	IEEEtypes_ExtCap_t *pextcap;
 	mlan_status ret = MLAN_STATUS_FAILURE;
 	t_u32 rsnx_offset = 0;
+	t_u32 i;
 
 	if (pnew_entry->ssid.ssid_len >= pbss_entry->ssid.ssid_len)
 		beacon_buf_size =
@@ -5148,6 +5226,10 @@ static mlan_status wlan_update_ssid_in_beacon_buf(
 			    sizeof(IEEEtypes_Header_t)));
 
 	/* adjust the ie pointer */
+	for (i = 0; i < pnew_entry->ie_num; i++) {
+		if (pnew_entry->ie_offset[i] > BEACON_FIX_SIZE)
+			pnew_entry->ie_offset[i] += offset;
+	}
 	if (pnew_entry->pwpa_ie)
 		pnew_entry->wpa_offset += offset;
 	if (pnew_entry->prsn_ie)
@@ -5198,11 +5280,16 @@ static mlan_status wlan_update_ssid_in_beacon_buf(
 		pnew_entry->he_cap_offset += offset;
 	if (pnew_entry->phe_oprat)
 		pnew_entry->he_oprat_offset += offset;
-	if (pnew_rsnx)
+	if (pnew_rsnx) {
 		memcpy_ext(
 			pmadapter, pbeacon_buf + rsnx_offset, (t_u8 *)pnew_rsnx,
 			pnew_rsnx->ieee_hdr.len + sizeof(IEEEtypes_Header_t),
 			pnew_rsnx->ieee_hdr.len + sizeof(IEEEtypes_Header_t));
+		pnew_entry->ie_map[RSNX_IE >> 5] |= MBIT(RSNX_IE & 0x1f);
+		if (pnew_entry->ie_num < MAX_BSS_IE_INDEX)
+			pnew_entry->ie_offset[pnew_entry->ie_num++] =
+				(t_u16)rsnx_offset;
+	}
 	DBG_HEXDUMP(MCMD_D, "MBSSID beacon buf", pbeacon_buf, beacon_buf_size);
 	ret = MLAN_STATUS_SUCCESS;
 done:
@@ -5449,10 +5536,6 @@ static void wlan_parse_multi_bssid_ap(mlan_private *pmpriv,
 				      BSSDescriptor_t *pbss_entry,
 				      t_u32 *num_in_table)
 {
-	IEEEtypes_ElementId_e element_id;
-	t_u8 element_len;
-	t_u16 total_ie_len;
-	t_u32 bytes_left = pbss_entry->beacon_buf_size - BEACON_FIX_SIZE;
 	t_u8 *pcurrent_ptr = pbss_entry->pbeacon_buf + BEACON_FIX_SIZE;
 	IEEEtypes_Ssid_t *pssid = (IEEEtypes_Ssid_t *)pcurrent_ptr;
 
@@ -5461,25 +5544,13 @@ static void wlan_parse_multi_bssid_ap(mlan_private *pmpriv,
 		       "Invalid beacon ie, ssid should be in the first element\n");
 		return;
 	}
-	/* Process variable IE */
-	while (bytes_left >= 2) {
-		element_id = (IEEEtypes_ElementId_e)(*((t_u8 *)pcurrent_ptr));
-		element_len = *((t_u8 *)pcurrent_ptr + 1);
-		total_ie_len = element_len + sizeof(IEEEtypes_Header_t);
-
-		if (bytes_left < total_ie_len) {
-			PRINTM(MERROR, "InterpretIE: Error in processing IE, "
-				       "bytes left < IE length\n");
-			bytes_left = 0;
-			continue;
-		}
-		if (element_id == MULTI_BSSID)
-			wlan_parse_multi_bssid_ie(
-				pmpriv, pbss_entry,
-				(IEEEtypes_MultiBSSID_t *)pcurrent_ptr,
-				num_in_table);
-		pcurrent_ptr += total_ie_len;
-		bytes_left -= total_ie_len;
+	pcurrent_ptr = wlan_bss_get_ie(pbss_entry, MULTI_BSSID, MNULL);
+	while (pcurrent_ptr) {
+		wlan_parse_multi_bssid_ie(
+			pmpriv, pbss_entry,
+			(IEEEtypes_MultiBSSID_t *)pcurrent_ptr, num_in_table);
+		pcurrent_ptr =
+			wlan_bss_get_ie(pbss_entry, MULTI_BSSID, pcurrent_ptr);
 	}
 	return;
 }
@@ -5516,6 +5587,7 @@ static mlan_status wlan_parse_ext_scan_result(mlan_private *pmpriv,
 	MrvlIEtypes_Bss_Scan_Info_t *pscan_info_tlv = MNULL;
 	t_u8 band;
 	t_u32 age_ts_usec;
+	t_u64 parse_start;
 
 	ENTER();
 	pcb = (pmlan_callbacks)&pmadapter->callbacks;
@@ -5554,6 +5626,7 @@ static mlan_status wlan_parse_ext_scan_result(mlan_private *pmpriv,
 		goto done;
 	}
 
+	parse_start = wlan_get_time_us(pmadapter);
 	for (idx = 0;
 	     idx < number_of_sets && bytes_left > sizeof(MrvlIEtypesHeader_t);
 	     idx++) {
@@ -5702,6 +5775,8 @@ static mlan_status wlan_parse_ext_scan_result(mlan_private *pmpriv,
 		}
 	}
 
+	wlan_scan_parse_account(pmadapter, parse_start, idx);
+
 	PRINTM(MCMND, "EXT_SCAN: Scanned %2d APs, %d valid, %d total\n",
 	       number_of_sets, num_in_table - pmadapter->num_in_scan_table,
 	       num_in_table);
@@ -344,6 +344,36 @@ static mlan_status wlan_get_wr_port_data(mlan_adapter *pmadapter, t_u8 *pport)
 	return MLAN_STATUS_SUCCESS;
 }
 
+/**
+ *  @brief This function waits between two register polls during
+ *  firmware download
+ *
+ *  The card normally answers within a few CMD52s, so the first
+ *  polls go back to back. After that the wait sleeps, doubling up to
+ *  SDIO_POLL_MAX_SLEEP.
+ *
+ *  @param pmadapter  A pointer to mlan_adapter structure
+ *  @param tries      Number of polls done so far
+ *  @param waited     A pointer to the time slept so far (us)
+ *  @param budget     Maximum time to sleep (us)
+ *  @return           MTRUE to poll again, MFALSE on timeout
+ */
+static t_u8 wlan_sdio_poll_wait(mlan_adapter *pmadapter, t_u32 tries,
+				t_u32 *waited, t_u32 budget)
+{
+	t_u32 delay;
+
+	if (tries < SDIO_POLL_SPIN_TRIES)
+		return MTRUE;
+	if (*waited >= budget)
+		return MFALSE;
+	tries -= SDIO_POLL_SPIN_TRIES;
+	delay = (tries < 4) ? (10U << tries) : SDIO_POLL_MAX_SLEEP;
+	wlan_udelay(pmadapter, delay);
+	*waited += delay;
+	return MTRUE;
+}
+
 /**
  *  @brief This function polls the card status register.
  *
@@ -356,11 +386,14 @@ static mlan_status wlan_sdio_poll_card_status(mlan_adapter *pmadapter,
 {
 	pmlan_callbacks pcb = &pmadapter->callbacks;
 	t_u32 tries;
+	t_u32 waited = 0;
 	t_u32 cs = 0;
 
 	ENTER();
 
-	for (tries = 0; tries < 10000; tries++) {
+	for (tries = 0; wlan_sdio_poll_wait(pmadapter, tries, &waited,
+					    SDIO_CARD_STATUS_TIMEOUT);
+	     tries++) {
 		if (pcb->moal_read_reg(pmadapter->pmoal_handle,
 				       pmadapter->pcard_sd->reg->poll_reg,
 				       &cs) != MLAN_STATUS_SUCCESS)
@@ -369,7 +402,6 @@ static mlan_status wlan_sdio_poll_card_status(mlan_adapter *pmadapter,
 			LEAVE();
 			return MLAN_STATUS_SUCCESS;
 		}
-		wlan_udelay(pmadapter, 10);
 	}
 
 	PRINTM(MERROR,
@@ -681,7 +713,7 @@ static mlan_status wlan_sdio_prog_fw_w_helper(pmlan_adapter pmadapter, t_u8 *fw,
 	t_u8 *fwbuf;
 	mlan_buffer mbuf;
 	t_u16 len = 0;
-	t_u32 txlen = 0, tx_blocks = 0, tries = 0;
+	t_u32 txlen = 0, tx_blocks = 0, tries = 0, waited = 0;
 	t_u32 i = 0;
 	const mlan_sdio_card_reg *reg = pmadapter->pcard_sd->reg;
 	t_u32 read_base_0_reg = reg->base_0_reg;
@@ -732,7 +764,11 @@ static mlan_status wlan_sdio_prog_fw_w_helper(pmlan_adapter pmadapter, t_u8 *fw,
 		if (firmwarelen && offset >= firmwarelen)
 			break;
 
-		for (tries = 0; tries < MAX_POLL_TRIES; tries++) {
+		len = 0;
+		waited = 0;
+		for (tries = 0; wlan_sdio_poll_wait(pmadapter, tries, &waited,
+						    SDIO_DNLD_LEN_TIMEOUT);
+		     tries++) {
 			ret = pcb->moal_read_reg(pmadapter->pmoal_handle,
 						 read_base_0_reg, &base0);
 			if (ret != MLAN_STATUS_SUCCESS) {
@@ -755,9 +791,10 @@ static mlan_status wlan_sdio_prog_fw_w_helper(pmlan_adapter pmadapter, t_u8 *fw,
 
 			if (len)
 				break;
-			wlan_udelay(pmadapter, 10);
 		}
 
+		/* The helper sets the size of every block, up to
+		 * WLAN_UPLD_SIZE, so larger bursts are not possible */
 		if (!len)
 			break;
 		else if (len > WLAN_UPLD_SIZE) {
@@ -948,6 +985,7 @@ static mlan_status wlan_decode_rx_packet(mlan_adapter *pmadapter,
 			wlan_free_mlan_buffer(pmadapter, pmbuf);
 		}
 		pmadapter->data_received = MTRUE;
+		wlan_ps_note_xfer(pmadapter);
 		break;
 	case MLAN_TYPE_DATA:
 		PRINTM(MINFO, "--- Rx: Data packet ---\n");
@@ -978,6 +1016,7 @@ static mlan_status wlan_decode_rx_packet(mlan_adapter *pmadapter,
 			wlan_handle_rx_packet(pmadapter, pmbuf);
 		}
 		pmadapter->data_received = MTRUE;
+		wlan_ps_note_xfer(pmadapter);
 		break;
 
 	case MLAN_TYPE_CMD:
@@ -1801,6 +1840,7 @@ static mlan_status wlan_sdio_dnld_fw(pmlan_adapter pmadapter,
 	mlan_status ret = MLAN_STATUS_SUCCESS;
 	t_u32 poll_num = 1;
 	t_u32 winner = 0;
+	t_u64 start;
 
 	ENTER();
 
@@ -1854,6 +1894,7 @@ static mlan_status wlan_sdio_dnld_fw(pmlan_adapter pmadapter,
 	}
 
 	/* Download the firmware image via helper */
+	start = wlan_get_time_us(pmadapter);
 	ret = wlan_sdio_prog_fw_w_helper(pmadapter, pmfw->pfw_buf,
 					 pmfw->fw_len);
 	if (ret != MLAN_STATUS_SUCCESS) {
@@ -1861,9 +1902,11 @@ static mlan_status wlan_sdio_dnld_fw(pmlan_adapter pmadapter,
 		LEAVE();
 		return ret;
 	}
+	pmfw->dnld_time = (t_u32)(wlan_get_time_us(pmadapter) - start);
 
 poll_fw:
 	/* Check if the firmware is downloaded successfully or not */
+	start = wlan_get_time_us(pmadapter);
 	ret = wlan_sdio_check_fw_status(pmadapter, poll_num);
 	if (ret != MLAN_STATUS_SUCCESS) {
 		PRINTM(MFATAL, "FW failed to be active in time!\n");
@@ -1871,6 +1914,9 @@ poll_fw:
 		LEAVE();
 		return ret;
 	}
+	pmfw->ready_time = (t_u32)(wlan_get_time_us(pmadapter) - start);
+	PRINTM(MMSG, "WLAN FW download %u us, ready %u us\n", pmfw->dnld_time,
+	       pmfw->ready_time);
 	if (IS_SD9177(pmadapter->card_type))
 		wlan_mdelay(pmadapter, 1000);
 done:
@@ -2096,7 +2142,10 @@ static mlan_status wlan_sdio_interrupt(t_u16 msg_id, pmlan_adapter pmadapter)
 		 * Clear the interrupt status register
 		 */
 		PRINTM(MINTR, "wlan_interrupt: sdio_ireg = 0x%x\n", sdio_ireg);
-		pmadapter->pcard_sd->num_of_irq++;
+		if (pmadapter->pcard_sd->int_polling)
+			pmadapter->pcard_sd->num_int_poll++;
+		else
+			pmadapter->pcard_sd->num_of_irq++;
 		pcb->moal_spin_lock(pmadapter->pmoal_handle,
 				    pmadapter->pint_lock);
 		pmadapter->ireg |= sdio_ireg;
@@ -2107,8 +2156,9 @@ static mlan_status wlan_sdio_interrupt(t_u16 msg_id, pmlan_adapter pmadapter)
 			pmadapter->pm_wakeup_fw_try = MFALSE;
 			pmadapter->ps_state = PS_STATE_AWAKE;
 			pmadapter->pm_wakeup_card_req = MFALSE;
+			wlan_ps_note_awake(pmadapter);
 		}
-	} else {
+	} else if (!pmadapter->pcard_sd->int_polling) {
 		PRINTM(MMSG, "wlan_interrupt: sdio_ireg = 0x%x\n", sdio_ireg);
 	}
 done:
@@ -2237,7 +2287,8 @@ static mlan_status wlan_process_sdio_int_status(mlan_adapter *pmadapter)
 				goto done;
 			}
 			rx_len = (t_u16)(rx_blocks * MLAN_SDIO_BLOCK_SIZE);
-			pmbuf = wlan_alloc_mlan_buffer(pmadapter, rx_len, 0,
+			pmbuf = wlan_alloc_mlan_buffer(pmadapter, rx_len,
+						       CMD_PORT_RX_HEAD_ROOM,
 						       MOAL_MALLOC_BUFFER);
 			if (pmbuf == MNULL) {
 				PRINTM(MERROR,
@@ -2396,6 +2447,7 @@ static mlan_status wlan_process_sdio_int_status(mlan_adapter *pmadapter)
 				ret = MLAN_STATUS_FAILURE;
 				goto term_cmd53;
 			}
+			pmadapter->pcard_sd->num_rx_pkt++;
 		}
 		/* We might receive data/sleep_cfm at the same time */
 		/* reset data_receive flag to avoid ps_state change */
@@ -2483,6 +2535,8 @@ mlan_status wlan_sdio_host_to_card(mlan_adapter *pmadapter, t_u8 type,
 		else
 			ret = wlan_host_to_card_mp_aggr(pmadapter, pmbuf, port,
 							0);
+		if (ret != MLAN_STATUS_FAILURE)
+			pmadapter->pcard_sd->num_tx_pkt++;
 	} else {
 		/*Type must be MLAN_TYPE_CMD*/
 		pmadapter->cmd_sent = MTRUE;
@@ -2543,6 +2597,9 @@ static mlan_status wlan_sdio_host_to_card_ext(pmlan_private pmpriv, t_u8 type,
 
 	if (type == MLAN_TYPE_DATA && ret == MLAN_STATUS_FAILURE)
 		pmadapter->data_sent = MFALSE;
+	else if (ret != MLAN_STATUS_FAILURE &&
+		 (type == MLAN_TYPE_DATA || pmbuf != pmadapter->psleep_cfm))
+		wlan_ps_note_xfer(pmadapter);
 
 	LEAVE();
 	return ret;
@@ -2838,6 +2895,8 @@ static mlan_status wlan_pm_sdio_wakeup_card(pmlan_adapter pmadapter,
 	pmadapter->callbacks.moal_get_system_time(pmadapter->pmoal_handle,
 						  &pmadapter->pm_wakeup_in_secs,
 						  &age_ts_usec);
+	if (pmadapter->ps_state != PS_STATE_AWAKE && !pmadapter->ps_wake_start)
+		pmadapter->ps_wake_start = wlan_get_time_us(pmadapter);
 
 	if (timeout) {
 		pmadapter->callbacks.moal_start_timer(
@@ -98,6 +98,15 @@ Change log:
 /** Card Control Registers : Download card ready */
 #define DN_LD_CARD_RDY (0x1U << 0)
 
+/** FW download: register polls issued back to back before sleeping */
+#define SDIO_POLL_SPIN_TRIES 8
+/** FW download: longest sleep between two register polls (us) */
+#define SDIO_POLL_MAX_SLEEP 160
+/** FW download: card status poll budget (us) */
+#define SDIO_CARD_STATUS_TIMEOUT 100000
+/** FW download: helper length register poll budget (us) */
+#define SDIO_DNLD_LEN_TIMEOUT 1000
+
 /** Card Control Registers : Host power interrupt mask */
 #define HOST_POWER_INT_MASK (0x1U << 3)
 /** Card Control Registers : Abort card interrupt mask */
@@ -158,6 +167,8 @@ Change log:
 
 /** Event header Len*/
 #define MLAN_EVENT_HEADER_LEN 8
+/** Head room of cmd port rx buffers, lets CSI reports go to moal in place */
+#define CMD_PORT_RX_HEAD_ROOM DMA_ALIGNMENT
 
 /** SDIO byte mode size */
 #define MAX_BYTE_MODE_SIZE 512
@@ -299,6 +299,7 @@ mlan_status mlan_register(pmlan_device pmdevice, t_void **ppmlan_adapter)
 	MASSERT(pcb->moal_memcpy_ext);
 	MASSERT(pcb->moal_memcmp);
 	MASSERT(pcb->moal_get_system_time);
+	MASSERT(pcb->moal_get_tx_tstamp);
 	MASSERT(pcb->moal_init_timer);
 	MASSERT(pcb->moal_free_timer);
 	MASSERT(pcb->moal_get_boot_ktime);
@@ -386,6 +387,8 @@ mlan_status mlan_register(pmlan_device pmdevice, t_void **ppmlan_adapter)
 
 	pmadapter->multiple_dtim = pmdevice->multi_dtim;
 	pmadapter->inact_tmo = pmdevice->inact_tmo;
+	pmadapter->cmd_cache_ttl = pmdevice->cmd_cache_ttl;
+	pmadapter->ps_hold_max = pmdevice->ps_hold_max;
 	pmadapter->init_para.drcs_chantime_mode = pmdevice->drcs_chantime_mode;
 	pmadapter->hs_wake_interval = pmdevice->hs_wake_interval;
 	if (pmdevice->indication_gpio != 0xff) {
@@ -1121,8 +1124,10 @@ process_start:
 					MFALSE);
 			}
 			pmadapter->pm_wakeup_fw_try = MFALSE;
-			if (pmadapter->ps_state == PS_STATE_SLEEP)
+			if (pmadapter->ps_state == PS_STATE_SLEEP) {
 				pmadapter->ps_state = PS_STATE_AWAKE;
+				wlan_ps_note_awake(pmadapter);
+			}
 			if (pmadapter->wakeup_fw_timer_is_set) {
 				pcb->moal_stop_timer(
 					pmadapter->pmoal_handle,
@@ -1475,6 +1480,37 @@ mlan_status mlan_interrupt(t_u16 msg_id, t_void *adapter)
 	return ret;
 }
 
+/**
+ *  @brief This function polls the interrupt status without an interrupt,
+ *         used to keep serving a busy card before its interrupt is
+ *         enabled again
+ *
+ *  @param adapter  A pointer to mlan_adapter structure
+ *  @return         MLAN_STATUS_SUCCESS if an interrupt status is pending,
+ *                  otherwise MLAN_STATUS_FAILURE, also when the card is
+ *                  not awake
+ */
+mlan_status mlan_interrupt_poll(t_void *adapter)
+{
+	mlan_adapter *pmadapter = (mlan_adapter *)adapter;
+	mlan_status ret = MLAN_STATUS_FAILURE;
+
+	ENTER();
+	/* Reading the status registers would wake a sleeping card */
+	if (!IS_SD(pmadapter->card_type) ||
+	    pmadapter->ps_state != PS_STATE_AWAKE) {
+		LEAVE();
+		return ret;
+	}
+	pmadapter->pcard_sd->int_polling = MTRUE;
+	pmadapter->ops.interrupt(0, pmadapter);
+	pmadapter->pcard_sd->int_polling = MFALSE;
+	if (pmadapter->ireg)
+		ret = MLAN_STATUS_SUCCESS;
+	LEAVE();
+	return ret;
+}
+
 /**
  *  @brief This function wakeup firmware.
  *
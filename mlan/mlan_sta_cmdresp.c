@@ -598,6 +598,7 @@ static mlan_status wlan_ret_802_11_snmp_mib(pmlan_private pmpriv,
 			/* Set user enable flag if called from ioctl */
 			if (pioctl_buf)
 				pmpriv->state_11d.user_enable_11d = ul_temp;
+			wlan_cfp_index_invalidate(pmpriv->adapter);
 		}
 		/* Update state for 11h */
 		if (oid == Dot11H_i) {
@@ -512,6 +512,7 @@ t_void wlan_reset_connect_state(pmlan_private priv, t_u8 drv_disconnect)
 	if ((wlan_fw_11d_is_enabled(priv)) &&
 	    (priv->state_11d.user_enable_11d == DISABLE_11D)) {
 		priv->state_11d.enable_11d = DISABLE_11D;
+		wlan_cfp_index_invalidate(pmadapter);
 		enable = DISABLE_11D;
 
 		/* Send cmd to FW to enable/disable 11D function */
@@ -872,6 +873,7 @@ mlan_status wlan_ops_sta_process_event(t_void *priv)
 		pmadapter->ps_state = PS_STATE_AWAKE;
 		pmadapter->pm_wakeup_card_req = MFALSE;
 		pmadapter->pm_wakeup_fw_try = MFALSE;
+		wlan_ps_note_awake(pmadapter);
 		break;
 
 	case EVENT_HS_ACT_REQ:
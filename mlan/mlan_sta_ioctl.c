@@ -4137,7 +4137,10 @@ mlan_status wlan_misc_ioctl_warm_reset(pmlan_adapter pmadapter,
 	pmadapter->rx_pkts_queued = 0;
 
 	/* Initialize adapter structure */
+	pmadapter->keep_scan_table =
+		(misc->param.fw_reload == MLAN_FW_RELOAD_KEEP_SCAN);
 	wlan_init_adapter(pmadapter);
+	pmadapter->keep_scan_table = MFALSE;
 	pmadapter->hw_status = WlanHardwareStatusInitializing;
 
 	/* Initialize private structures */
@@ -4147,7 +4150,7 @@ mlan_status wlan_misc_ioctl_warm_reset(pmlan_adapter pmadapter,
 	}
 	mlan_block_rx_process(pmadapter, MFALSE);
 
-	if (misc->param.fw_reload != MTRUE) {
+	if (!misc->param.fw_reload) {
 		/* Restart the firmware */
 		ret = wlan_prepare_cmd(pmpriv, HostCmd_CMD_FUNC_SHUTDOWN,
 				       HostCmd_ACT_GEN_SET, 0, MNULL, MNULL);
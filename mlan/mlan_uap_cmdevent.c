@@ -3126,6 +3126,7 @@ static mlan_status wlan_uap_ret_snmp_mib(pmlan_private pmpriv,
 			/* Set user enable flag if called from ioctl */
 			if (pioctl_buf)
 				pmpriv->state_11d.user_enable_11d = data;
+			wlan_cfp_index_invalidate(pmpriv->adapter);
 			break;
 		case Dot11H_i:
 			data = wlan_le16_to_cpu(*((t_u16 *)(psnmp_mib->value)));
@@ -3724,6 +3725,7 @@ static mlan_status wlan_uap_ret_sta_list(pmlan_private pmpriv,
 					&(info->param.sta_list.info[i].stats),
 					&(sta_ptr->stats), sizeof(sta_stats),
 					sizeof(sta_stats));
+				sta_ptr->traffic.fw_rssi = tlv->rssi;
 			} else
 				info->param.sta_list.info[i].bandmode = 0xFF;
 			pioctl_buf->data_read_written +=
@@ -5281,7 +5283,7 @@ mlan_status wlan_ops_uap_process_event(t_void *priv)
 		pmadapter->pm_wakeup_card_req = MFALSE;
 		pmadapter->pm_wakeup_fw_try = MFALSE;
 		pmadapter->ps_state = PS_STATE_AWAKE;
-
+		wlan_ps_note_awake(pmadapter);
 		break;
 	case EVENT_PS_SLEEP:
 		PRINTM(MINFO, "EVENT: SLEEP\n");
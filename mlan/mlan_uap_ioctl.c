@@ -800,6 +800,59 @@ static mlan_status wlan_uap_get_sta_list(pmlan_adapter pmadapter,
 	return ret;
 }
 
+/**
+ *  @brief Get driver maintained per-station statistics
+ *
+ *  The counters are kept in the station list by the data path,
+ *  so no firmware command is issued here.
+ *
+ *  @param pmadapter	A pointer to mlan_adapter structure
+ *  @param pioctl_req	A pointer to ioctl request buffer
+ *
+ *  @return		MLAN_STATUS_SUCCESS --success, otherwise fail
+ */
+static mlan_status wlan_uap_get_sta_stats(pmlan_adapter pmadapter,
+					  pmlan_ioctl_req pioctl_req)
+{
+	pmlan_private pmpriv = pmadapter->priv[pioctl_req->bss_index];
+	pmlan_callbacks pcb = &pmadapter->callbacks;
+	mlan_ds_get_info *info = (mlan_ds_get_info *)pioctl_req->pbuf;
+	mlan_ds_sta_stats *sta_stats = &info->param.sta_stats;
+	sta_stats_data *entry = MNULL;
+	sta_node *sta_ptr = MNULL;
+	t_u16 count = 0;
+
+	ENTER();
+
+	pcb->moal_spin_lock(pmadapter->pmoal_handle, pmpriv->sta_list.plock);
+	sta_ptr = (sta_node *)util_peek_list(pmadapter->pmoal_handle,
+					     &pmpriv->sta_list, MNULL, MNULL);
+	while (sta_ptr && (sta_ptr != (sta_node *)&pmpriv->sta_list) &&
+	       count < MAX_NUM_CLIENTS) {
+		entry = &sta_stats->info[count];
+		memcpy_ext(pmadapter, entry->mac_address, sta_ptr->mac_addr,
+			   MLAN_MAC_ADDR_LENGTH, MLAN_MAC_ADDR_LENGTH);
+		entry->snr = sta_ptr->snr;
+		entry->nf = sta_ptr->nf;
+		entry->last_rx_in_msec = sta_ptr->stats.last_rx_in_msec;
+		memcpy_ext(pmadapter, &entry->traffic, &sta_ptr->traffic,
+			   sizeof(sta_traffic_stats),
+			   sizeof(sta_traffic_stats));
+		count++;
+		sta_ptr = sta_ptr->pnext;
+	}
+	pcb->moal_spin_unlock(pmadapter->pmoal_handle, pmpriv->sta_list.plock);
+
+	sta_stats->sta_count = count;
+	pioctl_req->data_read_written = MLAN_SUB_COMMAND_SIZE +
+					sizeof(mlan_ds_sta_stats) -
+					sizeof(sta_stats_data) *
+						(MAX_NUM_CLIENTS - count);
+
+	LEAVE();
+	return MLAN_STATUS_SUCCESS;
+}
+
 /**
  *  @brief soft_reset
  *
@@ -1996,6 +2049,8 @@ mlan_status wlan_ops_uap_ioctl(t_void *adapter, pmlan_ioctl_req pioctl_req)
 			status = wlan_uap_get_stats_log(pmadapter, pioctl_req);
 		else if (pget_info->sub_command == MLAN_OID_UAP_STA_LIST)
 			status = wlan_uap_get_sta_list(pmadapter, pioctl_req);
+		else if (pget_info->sub_command == MLAN_OID_UAP_STA_STATS)
+			status = wlan_uap_get_sta_stats(pmadapter, pioctl_req);
 		else if (pget_info->sub_command == MLAN_OID_GET_BSS_INFO)
 			status = wlan_uap_get_bss_info(pmadapter, pioctl_req);
 		else if (pget_info->sub_command == MLAN_OID_GET_FW_INFO) {
@@ -2313,6 +2368,9 @@ mlan_status wlan_ops_uap_ioctl(t_void *adapter, pmlan_ioctl_req pioctl_req)
 		if (cfg11h->sub_command == MLAN_OID_11H_CHAN_DFS_STATE)
 			status = wlan_11h_ioctl_chan_dfs_state(pmadapter,
 							       pioctl_req);
+		if (cfg11h->sub_command == MLAN_OID_11H_CHAN_DFS_STATE_MAP)
+			status = wlan_11h_ioctl_chan_dfs_state_map(pmadapter,
+								   pioctl_req);
 		if (cfg11h->sub_command == MLAN_OID_11H_DFS_W53_CFG)
 			status = wlan_11h_ioctl_dfs_w53_cfg(pmadapter,
 							    pioctl_req);
@@ -426,6 +426,12 @@ mlan_status wlan_ops_uap_process_rx_packet(t_void *adapter, pmlan_buffer pmbuf)
 			pmadapter->pmoal_handle, &last_rx_sec, &last_rx_usec);
 		sta_ptr->stats.last_rx_in_msec =
 			(t_u64)last_rx_sec * 1000 + (t_u64)last_rx_usec / 1000;
+		if (rx_pkt_type != PKT_TYPE_BAR) {
+			sta_ptr->traffic.rx_packets++;
+			sta_ptr->traffic.rx_bytes += prx_pd->rx_pkt_length;
+			sta_ptr->traffic.rx_rate = adj_rx_rate;
+			sta_ptr->traffic.rx_rate_info = prx_pd->rate_info;
+		}
 	}
 
 #ifdef DRV_EMBEDDED_AUTHENTICATOR
@@ -518,8 +524,7 @@ mlan_status wlan_uap_recv_packet(mlan_private *priv, pmlan_buffer pmbuf)
 				newbuf->bss_index = pmbuf->bss_index;
 				newbuf->buf_type = pmbuf->buf_type;
 				newbuf->priority = pmbuf->priority;
-				newbuf->in_ts_sec = pmbuf->in_ts_sec;
-				newbuf->in_ts_usec = pmbuf->in_ts_usec;
+				newbuf->in_ts_nsec = pmbuf->in_ts_nsec;
 				newbuf->data_offset =
 					(sizeof(TxPD) + priv->intf_hr_len +
 					 DMA_ALIGNMENT);
@@ -566,8 +571,7 @@ mlan_status wlan_uap_recv_packet(mlan_private *priv, pmlan_buffer pmbuf)
 				newbuf->bss_index = pmbuf->bss_index;
 				newbuf->buf_type = pmbuf->buf_type;
 				newbuf->priority = pmbuf->priority;
-				newbuf->in_ts_sec = pmbuf->in_ts_sec;
-				newbuf->in_ts_usec = pmbuf->in_ts_usec;
+				newbuf->in_ts_nsec = pmbuf->in_ts_nsec;
 				newbuf->data_offset =
 					(sizeof(TxPD) + priv->intf_hr_len +
 					 DMA_ALIGNMENT);
@@ -674,8 +678,7 @@ mlan_status wlan_process_uap_rx_packet(mlan_private *priv, pmlan_buffer pmbuf)
 				newbuf->bss_index = pmbuf->bss_index;
 				newbuf->buf_type = pmbuf->buf_type;
 				newbuf->priority = pmbuf->priority;
-				newbuf->in_ts_sec = pmbuf->in_ts_sec;
-				newbuf->in_ts_usec = pmbuf->in_ts_usec;
+				newbuf->in_ts_nsec = pmbuf->in_ts_nsec;
 				newbuf->data_offset =
 					(sizeof(TxPD) + priv->intf_hr_len +
 					 DMA_ALIGNMENT);
@@ -492,4 +492,36 @@ static INLINE t_u32 bitcount(t_u32 num)
 	return count;
 }
 
+/**
+ *  @brief This function finds the lowest clear bit of a 32 bit word
+ *
+ *  @param word  word, must not be 0xffffffff
+ *  @return      index of the lowest clear bit
+ */
+static INLINE t_u32 util_ffz32(t_u32 word)
+{
+	t_u32 bit = 0;
+
+	word = ~word;
+	if (!(word & 0xffff)) {
+		bit += 16;
+		word >>= 16;
+	}
+	if (!(word & 0xff)) {
+		bit += 8;
+		word >>= 8;
+	}
+	if (!(word & 0xf)) {
+		bit += 4;
+		word >>= 4;
+	}
+	if (!(word & 0x3)) {
+		bit += 2;
+		word >>= 2;
+	}
+	if (!(word & 0x1))
+		bit += 1;
+	return bit;
+}
+
 #endif /* !_MLAN_UTIL_H_ */
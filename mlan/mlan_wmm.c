@@ -1591,6 +1591,15 @@ void wlan_wmm_setup_ac_downgrade(pmlan_private priv)
 		}
 	}
 
+	/* Queue delay is only needed while an AC is admission controlled */
+	priv->wmm.tx_tstamp_req = MFALSE;
+	if (priv->wmm_enabled == MTRUE) {
+		for (ac_val = WMM_AC_BK; ac_val <= WMM_AC_VO; ac_val++) {
+			if (priv->wmm.ac_status[ac_val].flow_required)
+				priv->wmm.tx_tstamp_req = MTRUE;
+		}
+	}
+
 	LEAVE();
 }
 
@@ -2094,9 +2103,16 @@ t_void wlan_wmm_add_buf_txqueue(pmlan_adapter pmadapter, pmlan_buffer pmbuf)
 	       pmbuf, pmbuf->priority, tid_down, ra_list);
 	util_enqueue_list_tail(pmadapter->pmoal_handle, &ra_list->buf_head,
 			       (pmlan_linked_list)pmbuf, MNULL, MNULL);
+	MTRACE(pmadapter, MTRACE_TX_ENQUEUE, tid_down, pmbuf->data_len);
 
 	ra_list->total_pkts++;
 	ra_list->packet_count++;
+#ifdef UAP_SUPPORT
+	if (sta_ptr) {
+		sta_ptr->traffic.tx_packets++;
+		sta_ptr->traffic.tx_bytes += pmbuf->data_len;
+	}
+#endif
 
 	priv->wmm.pkts_queued[tid_down]++;
 	if (ra_list->tx_pause) {
@@ -2111,14 +2127,14 @@ t_void wlan_wmm_add_buf_txqueue(pmlan_adapter pmadapter, pmlan_buffer pmbuf)
 			MLAN_SCALAR_COND_LESS_THAN, tos_to_tid_inv[tid_down],
 			tos_to_tid_inv[tid_down], MNULL, MNULL);
 	}
-	/* Record the current time the packet was queued; used to determine
-	 *   the amount of time the packet was queued in the driver before it
-	 *   was sent to the firmware.  The delay is then sent along with the
-	 *   packet to the firmware for aggregate delay calculation for stats
-	 *   and MSDU lifetime expiry.
+	/* Record the time the packet was queued if admission control needs
+	 *   the driver queue delay and the OS layer has not stamped it yet.
+	 *   The delay is sent along with the packet to the firmware for
+	 *   aggregate delay calculation and MSDU lifetime expiry.
 	 */
-	pmadapter->callbacks.moal_get_system_time(
-		pmadapter->pmoal_handle, &pmbuf->in_ts_sec, &pmbuf->in_ts_usec);
+	if (priv->wmm.tx_tstamp_req && !pmbuf->in_ts_nsec)
+		pmadapter->callbacks.moal_get_tx_tstamp(pmadapter->pmoal_handle,
+							&pmbuf->in_ts_nsec);
 	pmadapter->callbacks.moal_spin_unlock(pmadapter->pmoal_handle,
 					      priv->wmm.ra_list_spinlock);
 
@@ -2373,7 +2389,8 @@ t_u32 wlan_wmm_process_association_req(pmlan_private priv, t_u8 **ppassoc_buf,
  *   When the packet is received at the OS/Driver interface, the current
  *     time is set in the packet structure.  The difference between the present
  *     time and that received time is computed in this function and limited
- *     based on pre-compiled limits in the driver.
+ *     based on pre-compiled limits in the driver.  Packets that were not
+ *     timestamped report no delay.
  *
  *   @param priv   Ptr to the mlan_private driver data struct
  *   @param pmbuf  Ptr to the mlan_buffer which has been previously timestamped
@@ -2384,15 +2401,28 @@ t_u8 wlan_wmm_compute_driver_packet_delay(pmlan_private priv,
 					  const pmlan_buffer pmbuf)
 {
 	t_u8 ret_val = 0;
-	t_u32 out_ts_sec, out_ts_usec;
+	t_u64 out_ts_nsec = 0;
+	t_u64 delay_nsec;
 	t_s32 queue_delay;
 
 	ENTER();
 
-	priv->adapter->callbacks.moal_get_system_time(
-		priv->adapter->pmoal_handle, &out_ts_sec, &out_ts_usec);
-	queue_delay = (t_s32)(out_ts_sec - pmbuf->in_ts_sec) * 1000;
-	queue_delay += (t_s32)(out_ts_usec - pmbuf->in_ts_usec) / 1000;
+	/* Packet was not stamped, no consumer needs the delay */
+	if (!pmbuf->in_ts_nsec) {
+		LEAVE();
+		return ret_val;
+	}
+
+	priv->adapter->callbacks.moal_get_tx_tstamp(priv->adapter->pmoal_handle,
+						    &out_ts_nsec);
+	delay_nsec = (out_ts_nsec > pmbuf->in_ts_nsec) ?
+			     (out_ts_nsec - pmbuf->in_ts_nsec) :
+			     0;
+	/* Clamp before the division so it stays 32 bit */
+	if (delay_nsec >= (t_u64)priv->wmm.drv_pkt_delay_max * 1000000)
+		queue_delay = (t_s32)priv->wmm.drv_pkt_delay_max;
+	else
+		queue_delay = (t_s32)((t_u32)delay_nsec / 1000000);
 
 	/*
 	 * Queue delay is passed as a uint8 in units of 2ms (ms shifted
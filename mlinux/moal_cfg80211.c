@@ -2367,9 +2367,8 @@ void woal_mgmt_frame_register(moal_private *priv, u16 frame_type, bool reg)
 		 * Note that this callback may not sleep, and cannot run
 		 * concurrently with itself.
 		 */
-		woal_reg_rx_mgmt_ind(priv, MLAN_ACT_SET, &mgmt_subtype_mask,
-				     MOAL_NO_WAIT);
 		priv->mgmt_subtype_mask = last_mgmt_subtype_mask;
+		woal_reg_rx_mgmt_ind_async(priv, mgmt_subtype_mask);
 	}
 
 	LEAVE();
@@ -2427,8 +2426,7 @@ void woal_cfg80211_mgmt_frame_register(struct wiphy *wiphy,
 
 	if (priv->mgmt_subtype_mask != upd->interface_stypes) {
 		priv->mgmt_subtype_mask = upd->interface_stypes;
-		woal_reg_rx_mgmt_ind(priv, MLAN_ACT_SET, &upd->interface_stypes,
-				     MOAL_NO_WAIT);
+		woal_reg_rx_mgmt_ind_async(priv, upd->interface_stypes);
 	}
 #else
 	if (frame_type == IEEE80211_STYPE_AUTH
@@ -2912,7 +2910,7 @@ int woal_cfg80211_mgmt_tx(struct wiphy *wiphy,
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 
 		/* Delay 30ms to guarantee the packet has been already tx'ed,
 		 * because if we call cfg80211_mgmt_tx_status() immediately,
@@ -5034,9 +5034,13 @@ static int woal_cfg80211_subcmd_set_csi(struct wiphy *wiphy,
 				&cfg->param.csi_params,
 				sizeof(mlan_ds_csi_params),
 				sizeof(mlan_ds_csi_params));
+		/* Reopen the dump file in the new format on the next report */
+		woal_cfg80211_csi_dump_stop(priv);
 		if (tb_vendor[ATTR_CSI_DUMP_FORMAT])
 			priv->csi_dump_format =
 				nla_get_u8(tb_vendor[ATTR_CSI_DUMP_FORMAT]);
+		/* Start a new dump file size budget */
+		priv->csi_dump_len = 0;
 	} else if (csi_enable == 0) {
 		nla_parse(tb_vendor, ATTR_CSI_MAX, (struct nlattr *)data, len,
 			  NULL
@@ -5238,35 +5242,128 @@ static int woal_cfg80211_subcmd_get_csi_capa(struct wiphy *wiphy,
 }
 
 /**
- * @brief Save CSI dump to file
+ * @brief Write one CSI report to the dump file
  *
- * @param dir_name    Directory name
- * @param file_name    File name
- * @param buf    Pointer to dump buffer
+ * @param priv    A pointer to moal_private
+ * @param buf    Pointer to CSI report
  * @param buf_len    Length of buf
- * @param name    Full path name of CSI dump
  *
- * @return      0: success  -1: fail
+ * @return      MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
  */
-static mlan_status woal_save_csi_dump_to_file(char *dir_name, char *file_name,
-					      t_u8 *buf, int buf_len,
-					      t_u8 format, char *name)
+static mlan_status woal_save_csi_dump_to_file(moal_private *priv, t_u8 *buf,
+					      int buf_len)
 {
 	mlan_status ret = MLAN_STATUS_SUCCESS;
+	char *txt = NULL;
+	t_u8 *data = buf;
+	int len = buf_len;
+	int i, pos = 0;
+	loff_t off = 0;
+	ssize_t written;
 	ENTER();
 
-	if (!dir_name || !file_name || !buf) {
-		PRINTM(MERROR, "Can't save dump info to file\n");
+	if (!priv->csi_dump_file) {
+		snprintf(priv->csi_dump_path, CSI_DUMP_PATH_LEN, "/data/%s",
+			 priv->csi_dump_format == 1 ? "csi_dump.bin" :
+						      "csi_dump.txt");
+		priv->csi_dump_file =
+			filp_open(priv->csi_dump_path,
+				  O_CREAT | O_WRONLY | O_APPEND, 0644);
+		if (IS_ERR(priv->csi_dump_file)) {
+			PRINTM(MERROR, "Create file %s error\n",
+			       priv->csi_dump_path);
+			priv->csi_dump_file = NULL;
+			ret = MLAN_STATUS_FAILURE;
+			goto done;
+		}
+	}
+	if (priv->csi_dump_format != 1) {
+		/* ASCII: one line per record, 32-bit words in hex */
+		txt = kmalloc((buf_len / 4) * 9 + 1, GFP_KERNEL);
+		if (!txt) {
+			ret = MLAN_STATUS_FAILURE;
+			goto done;
+		}
+		for (i = 0; i + 4 <= buf_len; i += 4)
+			pos += sprintf(txt + pos, "%08x ",
+				       le32_to_cpu(*(__le32 *)(buf + i)));
+		if (pos)
+			txt[pos - 1] = '\n';
+		data = (t_u8 *)txt;
+		len = pos;
+	}
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 14, 0)
+	written = kernel_write(priv->csi_dump_file, data, len, &off);
+#else
+	written = kernel_write(priv->csi_dump_file, data, len, off);
+#endif
+	if (written != len) {
+		PRINTM(MERROR, "Write file %s error %d\n", priv->csi_dump_path,
+		       (int)written);
 		ret = MLAN_STATUS_FAILURE;
-		goto done;
 	}
 done:
+	kfree(txt);
 	LEAVE();
 	return ret;
 }
 
 /**
- * @brief vendor event to upload csi dump
+ * @brief Work writing queued CSI reports to the dump file
+ *
+ * @param work    A pointer to work_struct
+ *
+ * @return      N/A
+ */
+static void woal_csi_dump_work_queue(struct work_struct *work)
+{
+	moal_private *priv = container_of(work, moal_private, csi_dump_work);
+	struct sk_buff *skb;
+
+	while ((skb = skb_dequeue(&priv->csi_dump_q))) {
+		if (woal_save_csi_dump_to_file(priv, skb->data, skb->len) !=
+		    MLAN_STATUS_SUCCESS)
+			PRINTM(MERROR, "Failed to save CSI dump to file\n");
+		kfree_skb(skb);
+	}
+}
+
+/**
+ * @brief Init the CSI dump file writer of an interface
+ *
+ * @param priv     A pointer to moal_private
+ *
+ * @return      N/A
+ */
+void woal_cfg80211_csi_dump_init(moal_private *priv)
+{
+	skb_queue_head_init(&priv->csi_dump_q);
+	INIT_WORK(&priv->csi_dump_work, woal_csi_dump_work_queue);
+	priv->csi_dump_file = NULL;
+}
+
+/**
+ * @brief Stop the CSI dump file writer and close the dump file
+ *
+ * @param priv     A pointer to moal_private
+ *
+ * @return      N/A
+ */
+void woal_cfg80211_csi_dump_stop(moal_private *priv)
+{
+	cancel_work_sync(&priv->csi_dump_work);
+	skb_queue_purge(&priv->csi_dump_q);
+	if (priv->csi_dump_file) {
+		filp_close(priv->csi_dump_file, NULL);
+		priv->csi_dump_file = NULL;
+	}
+}
+
+/**
+ * @brief Queue a CSI report for the dump file
+ *
+ * The report is copied and written to the file from a work item, the
+ * caller runs in the main process.
  *
  * @param priv     A pointer to moal_private
  * @param data     a pointer to data
@@ -5278,31 +5375,26 @@ mlan_status woal_cfg80211_event_csi_dump(moal_private *priv, t_u8 *data,
 					 int len)
 {
 	mlan_status ret = MLAN_STATUS_SUCCESS;
-	char path_name[20];
-	char file_name[20];
+	struct sk_buff *skb;
 
 	ENTER();
 
 	DBG_HEXDUMP(MCMD_D, "CSI dump data", data, len);
-	sprintf(path_name, "/data");
-	if (priv->csi_dump_format == 1)
-		sprintf(file_name, "csi_dump.bin");
-	else
-		sprintf(file_name, "csi_dump.txt");
 	priv->csi_dump_len += len;
 	if (priv->csi_dump_len > CSI_DUMP_FILE_MAX) {
 		PRINTM(MERROR,
 		       "Reached file maximum size. Not saving CSI records.\n");
 		goto done;
 	}
-	/* Save CSI dump to file */
-	ret = woal_save_csi_dump_to_file(path_name, file_name, data, len,
-					 priv->csi_dump_format,
-					 priv->csi_dump_path);
-	if (ret != MLAN_STATUS_SUCCESS) {
-		PRINTM(MERROR, "Failed to save CSI dump to file\n");
+	skb = alloc_skb(len, GFP_ATOMIC);
+	if (!skb) {
+		PRINTM(MERROR, "Failed to queue CSI dump\n");
+		ret = MLAN_STATUS_FAILURE;
 		goto done;
 	}
+	moal_memcpy_ext(priv->phandle, skb_put(skb, len), data, len, len);
+	skb_queue_tail(&priv->csi_dump_q, skb);
+	schedule_work(&priv->csi_dump_work);
 
 done:
 	LEAVE();
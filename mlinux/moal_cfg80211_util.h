@@ -881,5 +881,7 @@ typedef struct {
 
 mlan_status woal_cfg80211_event_csi_dump(moal_private *priv, t_u8 *data,
 					 int len);
+void woal_cfg80211_csi_dump_init(moal_private *priv);
+void woal_cfg80211_csi_dump_stop(moal_private *priv);
 #endif
 #endif /* _MOAL_CFGVENDOR_H_ */
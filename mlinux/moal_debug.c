@@ -123,11 +123,33 @@ static struct debug_data items[] = {
 	 item_addr(last_cmd_resp_id), INFO_ADDR},
 	{"last_cmd_resp_index", item_size(last_cmd_resp_index),
 	 item_addr(last_cmd_resp_index), INFO_ADDR},
+	{"num_cmd_rtt", item_size(num_cmd_rtt), item_addr(num_cmd_rtt),
+	 INFO_ADDR},
+	{"cmd_rtt_avg", item_size(cmd_rtt_avg), item_addr(cmd_rtt_avg),
+	 INFO_ADDR},
+	{"cmd_rtt_max", item_size(cmd_rtt_max), item_addr(cmd_rtt_max),
+	 INFO_ADDR},
 	{"last_event", item_size(last_event), item_addr(last_event), INFO_ADDR},
 	{"last_event_index", item_size(last_event_index),
 	 item_addr(last_event_index), INFO_ADDR},
 	{"num_no_cmd_node", item_size(num_no_cmd_node),
 	 item_addr(num_no_cmd_node), INFO_ADDR},
+	{"num_cmd_cache_hit", item_size(num_cmd_cache_hit),
+	 item_addr(num_cmd_cache_hit), INFO_ADDR},
+	{"num_cmd_cache_miss", item_size(num_cmd_cache_miss),
+	 item_addr(num_cmd_cache_miss), INFO_ADDR},
+	{"num_scan_bss_parsed", item_size(num_scan_bss_parsed),
+	 item_addr(num_scan_bss_parsed), INFO_ADDR},
+	{"scan_parse_rate", item_size(scan_parse_rate),
+	 item_addr(scan_parse_rate), INFO_ADDR},
+	{"num_ps_hold", item_size(num_ps_hold), item_addr(num_ps_hold),
+	 INFO_ADDR},
+	{"num_ps_hold_hit", item_size(num_ps_hold_hit),
+	 item_addr(num_ps_hold_hit), INFO_ADDR},
+	{"num_ps_idle_wake", item_size(num_ps_idle_wake),
+	 item_addr(num_ps_idle_wake), INFO_ADDR},
+	{"ps_burst_gap", item_size(ps_burst_gap), item_addr(ps_burst_gap),
+	 INFO_ADDR},
 	{"num_cmd_h2c_fail", item_size(num_cmd_host_to_card_failure),
 	 item_addr(num_cmd_host_to_card_failure), INFO_ADDR},
 	{"num_cmd_sleep_cfm_fail",
@@ -148,6 +170,14 @@ static struct debug_data items[] = {
 	 item_addr(last_int_status), INFO_ADDR | (INTF_SD << 8)},
 	{"num_of_irq", item_size(num_of_irq), item_addr(num_of_irq),
 	 INFO_ADDR | (INTF_SD << 8)},
+	{"num_int_poll", item_size(num_int_poll), item_addr(num_int_poll),
+	 INFO_ADDR | (INTF_SD << 8)},
+	{"num_sdio_rx_pkt", item_size(num_sdio_rx_pkt),
+	 item_addr(num_sdio_rx_pkt), INFO_ADDR | (INTF_SD << 8)},
+	{"num_sdio_tx_pkt", item_size(num_sdio_tx_pkt),
+	 item_addr(num_sdio_tx_pkt), INFO_ADDR | (INTF_SD << 8)},
+	{"irq_per_kpkt", item_size(irq_per_kpkt), item_addr(irq_per_kpkt),
+	 INFO_ADDR | (INTF_SD << 8)},
 	{"mp_invalid_update", item_size(mp_invalid_update),
 	 item_addr(mp_invalid_update), INFO_ADDR | (INTF_SD << 8)},
 	{"sdio_rx_aggr", item_size(sdio_rx_aggr), item_addr(sdio_rx_aggr),
@@ -203,10 +233,20 @@ static struct debug_data items[] = {
 	 item_handle_addr(vmalloc_count), HANDLE_ADDR},
 	{"mbufalloc_count", item_handle_size(mbufalloc_count),
 	 item_handle_addr(mbufalloc_count), HANDLE_ADDR},
+	{"tx_stage_pkts", item_handle_size(tx_stage_pkts),
+	 item_handle_addr(tx_stage_pkts), HANDLE_ADDR},
+	{"tx_stage_kicks", item_handle_size(tx_stage_kicks),
+	 item_handle_addr(tx_stage_kicks), HANDLE_ADDR},
+	{"tx_stage_drains", item_handle_size(tx_stage_drains),
+	 item_handle_addr(tx_stage_drains), HANDLE_ADDR},
 	{"main_state", item_handle_size(main_state),
 	 item_handle_addr(main_state), HANDLE_ADDR},
 	{"driver_state", item_handle_size(driver_state),
 	 item_handle_addr(driver_state), HANDLE_ADDR},
+	{"reload_us", item_handle_size(reload_us), item_handle_addr(reload_us),
+	 HANDLE_ADDR},
+	{"reload_first_pkt_us", item_handle_size(reload_first_pkt_us),
+	 item_handle_addr(reload_first_pkt_us), HANDLE_ADDR},
 #ifdef SDIO_MMC_DEBUG
 	{"sdiocmd53w", item_handle_size(cmd53w), item_handle_addr(cmd53w),
 	 HANDLE_ADDR},
@@ -218,6 +258,16 @@ static struct debug_data items[] = {
 	 item_handle_addr(hs_skip_count), HANDLE_ADDR},
 	{"hs_force_count", item_handle_size(hs_force_count),
 	 item_handle_addr(hs_force_count), HANDLE_ADDR},
+	{"suspend_wait_us", item_handle_size(suspend_wait_us),
+	 item_handle_addr(suspend_wait_us), HANDLE_ADDR},
+	{"suspend_hs_us", item_handle_size(suspend_hs_us),
+	 item_handle_addr(suspend_hs_us), HANDLE_ADDR},
+	{"suspend_us", item_handle_size(suspend_us),
+	 item_handle_addr(suspend_us), HANDLE_ADDR},
+	{"resume_us", item_handle_size(resume_us), item_handle_addr(resume_us),
+	 HANDLE_ADDR},
+	{"resume_ack_us", item_handle_size(resume_ack_us),
+	 item_handle_addr(resume_ack_us), HANDLE_ADDR},
 #endif
 };
 
@@ -288,11 +338,33 @@ static struct debug_data uap_items[] = {
 	 item_addr(last_cmd_resp_id), INFO_ADDR},
 	{"last_cmd_resp_index", item_size(last_cmd_resp_index),
 	 item_addr(last_cmd_resp_index), INFO_ADDR},
+	{"num_cmd_rtt", item_size(num_cmd_rtt), item_addr(num_cmd_rtt),
+	 INFO_ADDR},
+	{"cmd_rtt_avg", item_size(cmd_rtt_avg), item_addr(cmd_rtt_avg),
+	 INFO_ADDR},
+	{"cmd_rtt_max", item_size(cmd_rtt_max), item_addr(cmd_rtt_max),
+	 INFO_ADDR},
 	{"last_event", item_size(last_event), item_addr(last_event), INFO_ADDR},
 	{"last_event_index", item_size(last_event_index),
 	 item_addr(last_event_index), INFO_ADDR},
 	{"num_no_cmd_node", item_size(num_no_cmd_node),
 	 item_addr(num_no_cmd_node), INFO_ADDR},
+	{"num_cmd_cache_hit", item_size(num_cmd_cache_hit),
+	 item_addr(num_cmd_cache_hit), INFO_ADDR},
+	{"num_cmd_cache_miss", item_size(num_cmd_cache_miss),
+	 item_addr(num_cmd_cache_miss), INFO_ADDR},
+	{"num_scan_bss_parsed", item_size(num_scan_bss_parsed),
+	 item_addr(num_scan_bss_parsed), INFO_ADDR},
+	{"scan_parse_rate", item_size(scan_parse_rate),
+	 item_addr(scan_parse_rate), INFO_ADDR},
+	{"num_ps_hold", item_size(num_ps_hold), item_addr(num_ps_hold),
+	 INFO_ADDR},
+	{"num_ps_hold_hit", item_size(num_ps_hold_hit),
+	 item_addr(num_ps_hold_hit), INFO_ADDR},
+	{"num_ps_idle_wake", item_size(num_ps_idle_wake),
+	 item_addr(num_ps_idle_wake), INFO_ADDR},
+	{"ps_burst_gap", item_size(ps_burst_gap), item_addr(ps_burst_gap),
+	 INFO_ADDR},
 	{"num_cmd_h2c_fail", item_size(num_cmd_host_to_card_failure),
 	 item_addr(num_cmd_host_to_card_failure), INFO_ADDR},
 	{"num_cmd_sleep_cfm_fail",
@@ -313,6 +385,14 @@ static struct debug_data uap_items[] = {
 	 item_addr(last_int_status), INFO_ADDR | (INTF_SD << 8)},
 	{"num_of_irq", item_size(num_of_irq), item_addr(num_of_irq),
 	 INFO_ADDR | (INTF_SD << 8)},
+	{"num_int_poll", item_size(num_int_poll), item_addr(num_int_poll),
+	 INFO_ADDR | (INTF_SD << 8)},
+	{"num_sdio_rx_pkt", item_size(num_sdio_rx_pkt),
+	 item_addr(num_sdio_rx_pkt), INFO_ADDR | (INTF_SD << 8)},
+	{"num_sdio_tx_pkt", item_size(num_sdio_tx_pkt),
+	 item_addr(num_sdio_tx_pkt), INFO_ADDR | (INTF_SD << 8)},
+	{"irq_per_kpkt", item_size(irq_per_kpkt), item_addr(irq_per_kpkt),
+	 INFO_ADDR | (INTF_SD << 8)},
 	{"mp_invalid_update", item_size(mp_invalid_update),
 	 item_addr(mp_invalid_update), INFO_ADDR | (INTF_SD << 8)},
 	{"sdio_rx_aggr", item_size(sdio_rx_aggr), item_addr(sdio_rx_aggr),
@@ -354,10 +434,20 @@ static struct debug_data uap_items[] = {
 	 item_handle_addr(vmalloc_count), HANDLE_ADDR},
 	{"mbufalloc_count", item_handle_size(mbufalloc_count),
 	 item_handle_addr(mbufalloc_count), HANDLE_ADDR},
+	{"tx_stage_pkts", item_handle_size(tx_stage_pkts),
+	 item_handle_addr(tx_stage_pkts), HANDLE_ADDR},
+	{"tx_stage_kicks", item_handle_size(tx_stage_kicks),
+	 item_handle_addr(tx_stage_kicks), HANDLE_ADDR},
+	{"tx_stage_drains", item_handle_size(tx_stage_drains),
+	 item_handle_addr(tx_stage_drains), HANDLE_ADDR},
 	{"main_state", item_handle_size(main_state),
 	 item_handle_addr(main_state), HANDLE_ADDR},
 	{"driver_state", item_handle_size(driver_state),
 	 item_handle_addr(driver_state), HANDLE_ADDR},
+	{"reload_us", item_handle_size(reload_us), item_handle_addr(reload_us),
+	 HANDLE_ADDR},
+	{"reload_first_pkt_us", item_handle_size(reload_first_pkt_us),
+	 item_handle_addr(reload_first_pkt_us), HANDLE_ADDR},
 #ifdef SDIO_MMC_DEBUG
 	{"sdiocmd53w", item_handle_size(cmd53w), item_handle_addr(cmd53w),
 	 HANDLE_ADDR | (INTF_SD << 8)},
@@ -369,6 +459,16 @@ static struct debug_data uap_items[] = {
 	 item_handle_addr(hs_skip_count), HANDLE_ADDR},
 	{"hs_force_count", item_handle_size(hs_force_count),
 	 item_handle_addr(hs_force_count), HANDLE_ADDR},
+	{"suspend_wait_us", item_handle_size(suspend_wait_us),
+	 item_handle_addr(suspend_wait_us), HANDLE_ADDR},
+	{"suspend_hs_us", item_handle_size(suspend_hs_us),
+	 item_handle_addr(suspend_hs_us), HANDLE_ADDR},
+	{"suspend_us", item_handle_size(suspend_us),
+	 item_handle_addr(suspend_us), HANDLE_ADDR},
+	{"resume_us", item_handle_size(resume_us), item_handle_addr(resume_us),
+	 HANDLE_ADDR},
+	{"resume_ack_us", item_handle_size(resume_ack_us),
+	 item_handle_addr(resume_ack_us), HANDLE_ADDR},
 #endif
 };
 #endif /* UAP_SUPPORT */
@@ -955,6 +1055,19 @@ static int woal_debug_read(struct seq_file *sfp, void *data)
 		else
 			seq_printf(sfp, "%s=%d\n", d[i].name, val);
 	}
+	seq_printf(sfp, "last_cmd_rtt_wait=");
+	for (i = 0; i < DBG_CMD_NUM; i++)
+		seq_printf(sfp, "%u/%u ", info->last_cmd_rtt[i],
+			   info->last_cmd_wait[i]);
+	seq_printf(sfp, "\n");
+	seq_printf(sfp, "ps_sleep_hist_ms=");
+	for (i = 0; i < PS_HIST_NUM; i++)
+		seq_printf(sfp, "%u ", info->ps_sleep_hist[i]);
+	seq_printf(sfp, "\n");
+	seq_printf(sfp, "ps_wake_hist_us=");
+	for (i = 0; i < PS_HIST_NUM; i++)
+		seq_printf(sfp, "%u ", info->ps_wake_hist[i]);
+	seq_printf(sfp, "\n");
 	if (IS_SD(priv->phandle->card_type)) {
 		mp_aggr_pkt_limit = info->mp_aggr_pkt_limit;
 		seq_printf(sfp, "last_recv_wr_bitmap=0x%x last_mp_index=%d\n",
@@ -4111,6 +4111,8 @@ static int woal_priv_set_get_drvdbg(moal_private *priv, t_u8 *respbuf,
 #endif
 	printk(KERN_ALERT "MMPA_D (%08x) %s\n", MMPA_D,
 	       (drvdbg & MMPA_D) ? "X" : "");
+	printk(KERN_ALERT "MTRACE_D (%08x) %s\n", MTRACE_D,
+	       (drvdbg & MTRACE_D) ? "X" : "");
 	printk(KERN_ALERT "MIF_D  (%08x) %s\n", MIF_D,
 	       (drvdbg & MIF_D) ? "X" : "");
 	printk(KERN_ALERT "MFW_D  (%08x) %s\n", MFW_D,
@@ -10651,11 +10653,18 @@ static mlan_status woal_do_dfs_cac(moal_private *priv,
  */
 static t_u8 woal_get_next_dfs_chan(moal_private *priv)
 {
-	int i;
+	int i, j;
 	int idx = priv->curr_cac_idx;
 	mlan_ds_11h_chan_dfs_state ch_dfs_state;
+	mlan_ds_11h_dfs_state_map *map = NULL;
 	t_u8 chan = 0;
 	ENTER();
+	/* Fetch the state of all DFS channels once */
+	map = kzalloc(sizeof(mlan_ds_11h_dfs_state_map), GFP_KERNEL);
+	if (map && woal_11h_get_dfs_state_map(priv, map)) {
+		kfree(map);
+		map = NULL;
+	}
 	idx++;
 	if (idx >= priv->auto_dfs_cfg.num_of_chan)
 		idx = 0;
@@ -10665,8 +10674,18 @@ static t_u8 woal_get_next_dfs_chan(moal_private *priv)
 			memset(&ch_dfs_state, 0, sizeof(ch_dfs_state));
 			ch_dfs_state.channel =
 				priv->auto_dfs_cfg.dfs_chan_list[idx];
-			woal_11h_chan_dfs_state(priv, MLAN_ACT_GET,
-						&ch_dfs_state);
+			if (map) {
+				for (j = 0; j < map->num_chan; j++) {
+					if (map->chan[j].channel ==
+					    ch_dfs_state.channel) {
+						ch_dfs_state = map->chan[j];
+						break;
+					}
+				}
+			} else {
+				woal_11h_chan_dfs_state(priv, MLAN_ACT_GET,
+							&ch_dfs_state);
+			}
 			if (ch_dfs_state.dfs_state != DFS_UNAVAILABLE) {
 				chan = priv->auto_dfs_cfg.dfs_chan_list[idx];
 				priv->curr_cac_idx = idx;
@@ -10677,6 +10696,7 @@ static t_u8 woal_get_next_dfs_chan(moal_private *priv)
 		if (idx >= priv->auto_dfs_cfg.num_of_chan)
 			idx = 0;
 	}
+	kfree(map);
 	LEAVE();
 	return chan;
 }
@@ -16490,6 +16510,551 @@ done:
 	return ret;
 }
 
+/**
+ *  @brief Get signal, stats and data rate as binary TLVs in one batch
+ *
+ *  The command name is followed by a t_u32 bitmap of MBIT(STATS_TLV_*)
+ *  selecting the TLVs, 0 for all of them. The response is a sequence
+ *  of woal_stats_tlv.
+ *
+ *  @param priv         A pointer to moal_private structure
+ *  @param respbuf      A pointer to response buffer
+ *  @param respbuflen   Available length of response buffer
+ *
+ *  @return             Number of bytes written, negative for failure.
+ */
+static int woal_priv_get_stats_tlv(moal_private *priv, t_u8 *respbuf,
+				   t_u32 respbuflen)
+{
+	mlan_ioctl_req *req[STATS_TLV_MAX] = {NULL};
+	mlan_status status[STATS_TLV_MAX] = {MLAN_STATUS_SUCCESS};
+	t_u16 type[STATS_TLV_MAX];
+	mlan_ds_get_info *info = NULL;
+	mlan_ds_rate *rate = NULL;
+	woal_stats_tlv *tlv = NULL;
+	t_u32 header_len = strlen(CMD_NXP) + strlen(PRIV_CMD_STATS_TLV);
+	t_u32 mask = 0;
+	t_u32 pos = 0;
+	t_u16 value_len = 0;
+	t_u8 *value = NULL;
+	int num = 0;
+	int ret = 0;
+	int i;
+
+	ENTER();
+
+	if (respbuflen < header_len + sizeof(mask)) {
+		PRINTM(MERROR, "statstlv: respbuflen (%d) too small!\n",
+		       (int)respbuflen);
+		ret = -EINVAL;
+		goto done;
+	}
+	moal_memcpy_ext(priv->phandle, &mask, respbuf + header_len,
+			sizeof(mask), sizeof(mask));
+	if (!mask)
+		mask = MBIT(STATS_TLV_SIGNAL) | MBIT(STATS_TLV_GETLOG) |
+		       MBIT(STATS_TLV_DATARATE);
+
+	for (i = 1; i <= STATS_TLV_MAX; i++) {
+		if (!(mask & MBIT(i)))
+			continue;
+		if (i == STATS_TLV_DATARATE) {
+			req[num] = woal_alloc_mlan_ioctl_req(
+				sizeof(mlan_ds_rate));
+			if (req[num] == NULL) {
+				ret = -ENOMEM;
+				goto done;
+			}
+			req[num]->req_id = MLAN_IOCTL_RATE;
+			rate = (mlan_ds_rate *)req[num]->pbuf;
+			rate->sub_command = MLAN_OID_GET_DATA_RATE;
+		} else {
+			req[num] = woal_alloc_mlan_ioctl_req(
+				sizeof(mlan_ds_get_info));
+			if (req[num] == NULL) {
+				ret = -ENOMEM;
+				goto done;
+			}
+			req[num]->req_id = MLAN_IOCTL_GET_INFO;
+			info = (mlan_ds_get_info *)req[num]->pbuf;
+			if (i == STATS_TLV_SIGNAL) {
+				info->sub_command = MLAN_OID_GET_SIGNAL;
+				info->param.signal.selector =
+					ALL_RSSI_INFO_MASK;
+			} else {
+				info->sub_command = MLAN_OID_GET_STATS;
+			}
+		}
+		req[num]->action = MLAN_ACT_GET;
+		type[num] = i;
+		num++;
+	}
+	if (!num) {
+		ret = -EINVAL;
+		goto done;
+	}
+
+	woal_request_ioctl_batch(priv, req, num, MOAL_IOCTL_WAIT, status);
+
+	for (i = 0; i < num; i++) {
+		if (status[i] != MLAN_STATUS_SUCCESS) {
+			PRINTM(MERROR, "statstlv: Failed to get TLV %d\n",
+			       type[i]);
+			ret = -EFAULT;
+			goto done;
+		}
+		info = (mlan_ds_get_info *)req[i]->pbuf;
+		rate = (mlan_ds_rate *)req[i]->pbuf;
+		switch (type[i]) {
+		case STATS_TLV_SIGNAL:
+			value = (t_u8 *)&info->param.signal;
+			value_len = sizeof(mlan_ds_get_signal);
+			break;
+		case STATS_TLV_GETLOG:
+			value = (t_u8 *)&info->param.stats;
+			if (priv->phandle->fw_getlog_enable)
+				value_len = sizeof(mlan_ds_get_stats);
+			else
+				value_len = sizeof(mlan_ds_get_stats_org);
+			break;
+		default:
+			value = (t_u8 *)&rate->param.data_rate;
+			value_len = sizeof(mlan_data_rate);
+			break;
+		}
+		if (pos + sizeof(woal_stats_tlv) + value_len > respbuflen) {
+			PRINTM(MERROR, "statstlv: respbuflen (%d) too small!\n",
+			       (int)respbuflen);
+			ret = -EFAULT;
+			goto done;
+		}
+		tlv = (woal_stats_tlv *)(respbuf + pos);
+		tlv->type = type[i];
+		tlv->len = value_len;
+		moal_memcpy_ext(priv->phandle, tlv->value, value, value_len,
+				respbuflen - pos - sizeof(woal_stats_tlv));
+		pos += sizeof(woal_stats_tlv) + value_len;
+	}
+	ret = pos;
+
+done:
+	for (i = 0; i < num; i++) {
+		if (req[i] && status[i] != MLAN_STATUS_PENDING)
+			kfree(req[i]);
+	}
+	LEAVE();
+	return ret;
+}
+
+static int woal_priv_cmdlist(moal_private *priv, t_u8 *respbuf,
+			     t_u32 respbuflen);
+
+/** NXP private command handler with the common argument list */
+typedef int (*woal_priv_cmd_handler)(moal_private *priv, t_u8 *respbuf,
+				     t_u32 respbuflen);
+
+/** Command can be issued without arguments, usually to get a setting */
+#define PRIV_CMD_ACT_GET MBIT(0)
+/** Command takes min_args to max_args numerical arguments */
+#define PRIV_CMD_ACT_SET MBIT(1)
+
+/** NXP private command table entry */
+typedef struct _woal_priv_cmd_entry {
+	/** Command name */
+	char *name;
+	/** Length of command name */
+	t_u8 len;
+	/** Handler, NULL if handled in woal_android_priv_cmd */
+	woal_priv_cmd_handler handler;
+	/** PRIV_CMD_ACT_* flags, 0 if the handler checks its arguments */
+	t_u8 flags;
+	/** Minimum number of arguments for PRIV_CMD_ACT_SET */
+	t_u8 min_args;
+	/** Maximum number of arguments for PRIV_CMD_ACT_SET */
+	t_u8 max_args;
+} woal_priv_cmd_entry;
+
+#define PRIV_CMD_ENTRY_ARGS(cmd, func, flags, min, max)                        \
+	{cmd, sizeof(cmd) - 1, func, flags, min, max}
+#define PRIV_CMD_ENTRY(cmd, func) PRIV_CMD_ENTRY_ARGS(cmd, func, 0, 0, 0)
+/** Get with no arguments, set with min to max arguments */
+#define PRIV_CMD_ENTRY_GETSET(cmd, func, min, max)                             \
+	PRIV_CMD_ENTRY_ARGS(cmd, func, PRIV_CMD_ACT_GET | PRIV_CMD_ACT_SET,    \
+			    min, max)
+/** Always takes min to max arguments */
+#define PRIV_CMD_ENTRY_SET(cmd, func, min, max)                                \
+	PRIV_CMD_ENTRY_ARGS(cmd, func, PRIV_CMD_ACT_SET, min, max)
+
+/**
+ * NXP private commands. Arguments follow the command name without a
+ * separator, so names are matched as prefixes and the first match wins:
+ * a name must come before any other name that is a prefix of it.
+ * Commands taking only numbers describe their argument count here and
+ * are rejected before the handler runs; the others, taking strings, MAC
+ * addresses or binary data, or ignoring their arguments, parse their own.
+ */
+static const woal_priv_cmd_entry woal_priv_cmd_table[] = {
+	PRIV_CMD_ENTRY(PRIV_CMD_VERSION, woal_get_priv_driver_version),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_BANDCFG, woal_setget_priv_bandcfg, 1, 3),
+	PRIV_CMD_ENTRY(PRIV_CMD_HOSTCMD, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_11AXCMDCFG, NULL),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_RANGE_EXT, woal_setget_priv_range_ext, 1,
+			      1),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_HTTXCFG, woal_setget_priv_httxcfg, 1, 2),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_HTCAPINFO, woal_setget_priv_htcapinfo, 1,
+			      2),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_ADDBAPARA, woal_setget_priv_addbapara, 5,
+			      5),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_AGGRPRIOTBL,
+			      woal_setget_priv_aggrpriotbl, MAX_NUM_TID * 2,
+			      MAX_NUM_TID * 2),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_ADDBAREJECT,
+			      woal_setget_priv_addbareject, MAX_NUM_TID,
+			      MAX_NUM_TID),
+	PRIV_CMD_ENTRY(PRIV_CMD_DELBA, woal_priv_delba),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_REJECTADDBAREQ, woal_priv_rejectaddbareq,
+			      1, 1),
+	PRIV_CMD_ENTRY_SET(PRIV_CMD_VHTCFG, woal_setget_priv_vhtcfg, 2, 6),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_OPERMODECFG,
+			      woal_setget_priv_opermodecfg, 2, 2),
+	PRIV_CMD_ENTRY(PRIV_CMD_DATARATE, woal_get_priv_datarate),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_TXRATECFG, woal_setget_priv_txratecfg, 1,
+			      4),
+#if defined(STA_SUPPORT) || defined(UAP_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_GETLOG, woal_get_priv_getlog),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_CUSTOMIE, woal_priv_customie),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_ESUPPMODE, woal_setget_priv_esuppmode, 3,
+			      3),
+	PRIV_CMD_ENTRY(PRIV_CMD_PASSPHRASE, woal_setget_priv_passphrase),
+	PRIV_CMD_ENTRY(PRIV_CMD_DEAUTH, woal_priv_deauth),
+#ifdef UAP_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_AP_DEAUTH, woal_priv_ap_deauth),
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_STA_LIST, woal_priv_get_sta_list),
+	PRIV_CMD_ENTRY(PRIV_CMD_BSS_CONFIG, woal_priv_bss_config),
+#endif
+#ifdef WIFI_DIRECT_SUPPORT
+#if defined(STA_SUPPORT) && defined(UAP_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_BSSROLE, NULL),
+#endif
+#endif
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_SETUSERSCAN, woal_priv_setuserscan),
+	PRIV_CMD_ENTRY(PRIV_CMD_GETSCANTABLE, woal_priv_getscantable),
+	PRIV_CMD_ENTRY(PRIV_CMD_GETCHANSTATS, woal_priv_get_chanstats),
+	PRIV_CMD_ENTRY(PRIV_CMD_EXTCAPCFG, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_CANCELSCAN, NULL),
+#endif
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_DEEPSLEEP, woal_priv_setgetdeepsleep, 1,
+			      2),
+	PRIV_CMD_ENTRY(PRIV_CMD_IPADDR, NULL),
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_WPSSESSION, woal_priv_setwpssession, 1,
+			      1),
+	PRIV_CMD_ENTRY_SET(PRIV_CMD_OTPUSERDATA, woal_priv_otpuserdata, 1, 1),
+	PRIV_CMD_ENTRY(PRIV_CMD_COUNTRYCODE, woal_priv_set_get_countrycode),
+	PRIV_CMD_ENTRY(PRIV_CMD_CFPINFO, woal_priv_get_cfpinfo),
+	PRIV_CMD_ENTRY(PRIV_CMD_TCPACKENH, woal_priv_setgettcpackenh),
+#ifdef REASSOCIATION
+	PRIV_CMD_ENTRY(PRIV_CMD_ASSOCBSSID, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_ASSOCESSID, NULL),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_WAKEUPREASON, woal_priv_getwakeupreason),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_LISTENINTERVAL,
+		       woal_priv_set_get_listeninterval),
+#endif
+#ifdef DEBUG_LEVEL1
+	PRIV_CMD_ENTRY(PRIV_CMD_DRVDBG, woal_priv_set_get_drvdbg),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_HSCFG, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_HSSETPARA, woal_priv_hssetpara),
+	PRIV_CMD_ENTRY(PRIV_CMD_MGMT_FILTER, woal_priv_mgmt_filter),
+	PRIV_CMD_ENTRY(PRIV_CMD_SCANCFG, woal_priv_set_get_scancfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_GETNLNUM, woal_priv_getnlnum),
+	PRIV_CMD_ENTRY(PRIV_CMD_SET_BSS_MODE, woal_priv_set_bss_mode),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_SET_AP, woal_priv_set_ap),
+	PRIV_CMD_ENTRY(PRIV_CMD_SET_POWER, woal_priv_set_power),
+	PRIV_CMD_ENTRY(PRIV_CMD_SET_ESSID, woal_priv_set_essid),
+	PRIV_CMD_ENTRY(PRIV_CMD_SET_AUTH, woal_priv_set_auth),
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_AP, woal_priv_get_ap),
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_POWER, woal_priv_get_power),
+	PRIV_CMD_ENTRY(PRIV_CMD_PSMODE, woal_priv_set_get_psmode),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_WARMRESET, woal_priv_warmreset),
+	PRIV_CMD_ENTRY(PRIV_CMD_TXPOWERCFG, woal_priv_txpowercfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_RX_ABORT_CFG_EXT, woal_priv_rx_abort_cfg_ext),
+	PRIV_CMD_ENTRY(PRIV_CMD_RX_ABORT_CFG, woal_priv_rx_abort_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_TX_AMPDU_PROT_MODE,
+		       woal_priv_tx_ampdu_prot_mode),
+	PRIV_CMD_ENTRY(PRIV_CMD_DOT11MC_UNASSOC_FTM_CFG,
+		       woal_priv_dot11mc_unassoc_ftm_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_RATE_ADAPT_CFG, woal_priv_rate_adapt_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_CCK_DESENSE_CFG, woal_priv_cck_desense_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_PSCFG, woal_priv_pscfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_BCNTIMEOUTCFG, woal_priv_bcntimeoutcfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_SLEEPPD, woal_priv_sleeppd),
+	PRIV_CMD_ENTRY(PRIV_CMD_TXCONTROL, woal_priv_txcontrol),
+	PRIV_CMD_ENTRY(PRIV_CMD_REGRDWR, woal_priv_regrdwr),
+	PRIV_CMD_ENTRY(PRIV_CMD_RDEEPROM, woal_priv_rdeeprom),
+	PRIV_CMD_ENTRY(PRIV_CMD_MEMRDWR, woal_priv_memrdwr),
+	PRIV_CMD_ENTRY(PRIV_CMD_SDCMD52RW, woal_priv_sdcmd52rw),
+	PRIV_CMD_ENTRY(PRIV_CMD_SDIO_CLOCK, woal_priv_sdio_clock_ioctl),
+	PRIV_CMD_ENTRY(PRIV_CMD_MPA_CTRL, woal_priv_sdio_mpa_ctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_SD_CMD53_RW, woal_priv_cmd53rdwr),
+	PRIV_CMD_ENTRY(PRIV_CMD_ROBUSTCOEX, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_DMCS, woal_priv_dmcs),
+	PRIV_CMD_ENTRY(PRIV_CMD_HAL_PHY_CFG, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_CSI, NULL),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_ARPFILTER, woal_priv_arpfilter),
+#endif
+#if defined(SDIO_SUSPEND_RESUME)
+	PRIV_CMD_ENTRY(PRIV_CMD_AUTO_ARP, woal_priv_set_get_auto_arp),
+#endif
+#ifdef RX_PACKET_COALESCE
+	PRIV_CMD_ENTRY(PRIV_CMD_RX_COAL_CFG, NULL),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_MGMT_FRAME_CTRL,
+		       woal_priv_mgmt_frame_passthru_ctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_QCONFIG, woal_priv_qconfig),
+	PRIV_CMD_ENTRY(PRIV_CMD_ADDTS, woal_priv_wmm_addts_req_ioctl),
+	PRIV_CMD_ENTRY(PRIV_CMD_DELTS, woal_priv_wmm_delts_req_ioctl),
+	PRIV_CMD_ENTRY(PRIV_CMD_QSTATUS, woal_priv_wmm_queue_status_ioctl),
+	PRIV_CMD_ENTRY(PRIV_CMD_TS_STATUS, woal_priv_wmm_ts_status_ioctl),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_QOS_CFG, NULL),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_MAC_CTRL, woal_priv_macctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_GETWAP, woal_priv_getwap),
+	PRIV_CMD_ENTRY(PRIV_CMD_REGION_CODE, woal_priv_region_code),
+	PRIV_CMD_ENTRY(PRIV_CMD_DRCS_CFG, woal_priv_drcs_time_slicing_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_MULTI_CHAN_CFG, woal_priv_multi_chan_config),
+	PRIV_CMD_ENTRY(PRIV_CMD_MULTI_CHAN_POLICY, woal_priv_multi_chan_policy),
+	PRIV_CMD_ENTRY(PRIV_CMD_FWMACADDR, woal_priv_fwmacaddr),
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(2, 6, 39)
+	PRIV_CMD_ENTRY(PRIV_CMD_OFFCHANNEL, NULL),
+#endif
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_DSCP_MAP, woal_priv_set_get_dscp_map),
+	PRIV_CMD_ENTRY(PRIV_CMD_VEREXT, woal_priv_get_driver_verext),
+#if defined(STA_SUPPORT) && defined(STA_WEXT)
+	PRIV_CMD_ENTRY(PRIV_CMD_RADIO_CTRL, woal_priv_radio_ctrl),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_WMM_CFG, woal_priv_wmm_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_MIN_BA_THRESH_CFG,
+		       woal_priv_min_ba_threshold_cfg),
+#if defined(STA_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_11D_CFG, woal_priv_11d_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_11D_CLR_TBL, woal_priv_11d_clr_chan_tbl),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_11K_CFG, woal_priv_11k_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_11K_NEIGHBOR_REPORT,
+		       woal_priv_11k_neighbor_report),
+#ifndef OPCHAN
+	PRIV_CMD_ENTRY(PRIV_CMD_WWS_CFG, woal_priv_wws_cfg),
+#endif
+#if defined(REASSOCIATION)
+	PRIV_CMD_ENTRY(PRIV_CMD_REASSOCTRL, woal_priv_set_get_reassoc),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_TXBUF_CFG, woal_priv_txbuf_cfg),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_AUTH_TYPE, woal_priv_auth_type),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_POWER_CONS, woal_priv_11h_local_pwr_constraint),
+	PRIV_CMD_ENTRY(PRIV_CMD_THERMAL, woal_priv_thermal),
+	PRIV_CMD_ENTRY(PRIV_CMD_BCN_INTERVAL, woal_priv_beacon_interval),
+#ifdef STA_SUPPORT
+	PRIV_CMD_ENTRY_GETSET(PRIV_CMD_GET_SIGNAL, woal_priv_get_signal, 1, 2),
+#endif
+#if defined(STA_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_PMFCFG, woal_priv_set_get_pmfcfg),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_INACTIVITYTO, woal_priv_inactivity_timeout_ext),
+	PRIV_CMD_ENTRY(PRIV_CMD_AMSDU_AGGR_CTRL, woal_priv_11n_amsdu_aggr_ctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_MCAST_AGGR_GROUP,
+		       woal_priv_mcast_aggr_group_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_MC_AGGR_CFG, woal_priv_mc_aggr_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_CH_LOAD, woal_priv_get_ch_load),
+	PRIV_CMD_ENTRY(PRIV_CMD_TX_BF_CAP, woal_priv_tx_bf_cap_ioctl),
+	PRIV_CMD_ENTRY(PRIV_CMD_SLEEP_PARAMS, woal_priv_sleep_params_ioctl),
+#ifdef UAP_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_NET_MON, woal_priv_net_monitor_ioctl),
+#endif
+#if defined(STA_CFG80211) && defined(UAP_CFG80211)
+	PRIV_CMD_ENTRY(PRIV_CMD_MONITOR_MODE, NULL),
+#endif
+#if defined(DFS_TESTING_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_DFS_TESTING, woal_priv_dfs_testing),
+	PRIV_CMD_ENTRY(PRIV_CMD_CLEAR_NOP, woal_priv_clear_nop),
+	PRIV_CMD_ENTRY(PRIV_CMD_FAKE_RADAR, woal_priv_fake_radar),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_DFS53_CFG, woal_priv_dfs53cfg),
+#ifdef UAP_SUPPORT
+	PRIV_CMD_ENTRY(PRIV_CMD_DFS_CAC, woal_priv_do_dfs_cac),
+	PRIV_CMD_ENTRY(PRIV_CMD_AUTODFS, woal_priv_auto_dfs_cfg),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_ARB_CFG, woal_priv_arbcfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_CFP_CODE, woal_priv_cfp_code),
+	PRIV_CMD_ENTRY(PRIV_CMD_ANT_CFG, woal_priv_set_get_tx_rx_ant),
+	PRIV_CMD_ENTRY(PRIV_CMD_SYSCLOCK, woal_priv_sysclock),
+	PRIV_CMD_ENTRY(PRIV_CMD_ASSOCIATE, woal_priv_associate_ssid_bssid),
+	PRIV_CMD_ENTRY(PRIV_CMD_TX_BF_CFG, woal_priv_tx_bf_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_BOOTSLEEP, woal_priv_bootsleep),
+	PRIV_CMD_ENTRY(PRIV_CMD_PORT_CTRL, woal_priv_port_ctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_PB_BYPASS, woal_priv_bypassed_packet),
+#ifdef WIFI_DIRECT_SUPPORT
+#if defined(UAP_CFG80211)
+	PRIV_CMD_ENTRY(PRIV_CMD_CFG_NOA, woal_priv_cfg_noa),
+	PRIV_CMD_ENTRY(PRIV_CMD_CFG_OPP_PS, woal_priv_cfg_opp_ps),
+#endif
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_CFG_CLOCK_SYNC, woal_priv_cfg_clock_sync),
+	PRIV_CMD_ENTRY(PRIV_CMD_CFG_GET_TSF_INFO, woal_priv_cfg_get_tsf_info),
+	PRIV_CMD_ENTRY(PRIV_CMD_TARGET_CHANNEL, woal_priv_target_channel),
+	PRIV_CMD_ENTRY(PRIV_CMD_BACKUP_CHANNEL, woal_priv_backup_channel),
+	PRIV_CMD_ENTRY(PRIV_CMD_DFS_REPEATER_CFG, woal_priv_dfs_repeater_cfg),
+#ifdef WIFI_DIRECT_SUPPORT
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+	PRIV_CMD_ENTRY(PRIV_CMD_MIRACAST_CFG, woal_priv_miracast_cfg),
+#endif
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_COEX_RX_WINSIZE, woal_priv_coex_rx_winsize),
+	PRIV_CMD_ENTRY(PRIV_CMD_TX_AGGR_CTRL, woal_priv_txaggrctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_AUTO_TDLS, woal_priv_auto_tdls),
+	PRIV_CMD_ENTRY(PRIV_CMD_TDLS_IDLE_TIME, woal_priv_tdls_idle_time),
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_SENSOR_TEMP, woal_priv_get_sensor_temp),
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+	PRIV_CMD_ENTRY(PRIV_CMD_DFS_OFFLOAD, NULL),
+#endif
+#endif
+#if defined(UAP_SUPPORT)
+	PRIV_CMD_ENTRY(PRIV_CMD_EXTEND_CHAN_SWITCH,
+		       woal_priv_extend_channel_switch),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_DYN_BW, woal_priv_config_dyn_bw),
+	PRIV_CMD_ENTRY(PRIV_CMD_IND_RST_CFG, woal_priv_ind_rst_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_PER_PKT_CFG, woal_priv_per_pkt_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_DEAUTH_CTRL, woal_priv_deauth_ctrl),
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_CORRELATED_TIME, woal_get_correlated_time),
+	PRIV_CMD_ENTRY(PRIV_CMD_11AXCFG, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_TWT_SETUP, NULL),
+	PRIV_CMD_ENTRY(PRIV_CMD_TWT_TEARDOWN, NULL),
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+	PRIV_CMD_ENTRY(PRIV_CMD_GET_CFG_CHAN_LIST, NULL),
+#endif
+	PRIV_CMD_ENTRY(PRIV_CMD_LPM, woal_priv_set_get_lpm),
+	PRIV_CMD_ENTRY(PRIV_CMD_IPS_CFG, woal_priv_ips_cfg),
+	PRIV_CMD_ENTRY(PRIV_CMD_CMDLIST, woal_priv_cmdlist),
+	PRIV_CMD_ENTRY(PRIV_CMD_STATS_TLV, woal_priv_get_stats_tlv),
+};
+
+/**
+ *  @brief Find the NXP private command table entry for a command
+ *
+ *  @param cmd          Command string following CMD_NXP
+ *
+ *  @return             Table entry or NULL if not found
+ */
+static const woal_priv_cmd_entry *woal_find_priv_cmd(char *cmd)
+{
+	const woal_priv_cmd_entry *entry = NULL;
+	char first = tolower(cmd[0]);
+	int i;
+
+	for (i = 0; i < (int)ARRAY_SIZE(woal_priv_cmd_table); i++) {
+		entry = &woal_priv_cmd_table[i];
+		/* Cheap check before the full compare */
+		if (tolower(entry->name[0]) != first)
+			continue;
+		if (strnicmp(cmd, entry->name, entry->len) == 0)
+			return entry;
+	}
+	return NULL;
+}
+
+/**
+ *  @brief Check the argument count of a command against its table entry
+ *
+ *  @param entry        A pointer to the command table entry
+ *  @param args         Arguments following the command name
+ *
+ *  @return             0 if accepted, -EINVAL otherwise
+ */
+static int woal_check_priv_cmd_args(const woal_priv_cmd_entry *entry,
+				    char *args)
+{
+	int argc = 0;
+
+	if (!entry->flags)
+		return 0;
+	/* Count the same way as parse_arguments */
+	if (*args) {
+		argc = 1;
+		while (*args)
+			if (*args++ == ' ')
+				argc++;
+	}
+	if (!argc) {
+		if (entry->flags & PRIV_CMD_ACT_GET)
+			return 0;
+	} else if ((entry->flags & PRIV_CMD_ACT_SET) &&
+		   argc >= entry->min_args && argc <= entry->max_args) {
+		return 0;
+	}
+	PRINTM(MERROR, "%s: Invalid number of arguments %d\n", entry->name,
+	       argc);
+	return -EINVAL;
+}
+
+/**
+ *  @brief List the NXP private commands supported by the driver
+ *
+ *  @param priv         A pointer to moal_private structure
+ *  @param respbuf      A pointer to response buffer
+ *  @param respbuflen   Available length of response buffer
+ *
+ *  @return             Number of bytes written, negative for failure.
+ */
+static int woal_priv_cmdlist(moal_private *priv, t_u8 *respbuf,
+			     t_u32 respbuflen)
+{
+	const woal_priv_cmd_entry *entry = NULL;
+	char line[64];
+	t_u32 pos = 0;
+	int len, i;
+
+	ENTER();
+
+	if (respbuflen < 1) {
+		LEAVE();
+		return -EINVAL;
+	}
+	memset(respbuf, 0, respbuflen);
+	for (i = 0; i < (int)ARRAY_SIZE(woal_priv_cmd_table); i++) {
+		entry = &woal_priv_cmd_table[i];
+		/* One line per command: name [get] [set min-max] */
+		len = snprintf(line, sizeof(line), "%s%s", entry->name,
+			       (entry->flags & PRIV_CMD_ACT_GET) ? " get" : "");
+		if (entry->flags & PRIV_CMD_ACT_SET)
+			len += snprintf(line + len, sizeof(line) - len,
+					" set %d-%d", entry->min_args,
+					entry->max_args);
+		/* Keep room for the terminating NUL */
+		if (pos + len + 2 > respbuflen)
+			break;
+		moal_memcpy_ext(priv->phandle, respbuf + pos, line, len,
+				respbuflen - pos);
+		pos += len;
+		respbuf[pos++] = '\n';
+	}
+
+	LEAVE();
+	return pos + 1;
+}
+
 /**
  *  @brief Set priv command for Android
  *  @param dev          A pointer to net_device structure
@@ -16504,6 +17069,7 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 	moal_private *priv = (moal_private *)netdev_priv(dev);
 	char *buf = NULL;
 	char *pdata;
+	const woal_priv_cmd_entry *entry = NULL;
 #ifdef STA_SUPPORT
 	int power_mode = 0;
 	int band = 0;
@@ -16578,22 +17144,19 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 
 	if (strncmp(buf, CMD_NXP, strlen(CMD_NXP)) == 0) {
 		/* This command has come from mlanutl app */
-
-		/* Check command */
-		if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_VERSION,
-			     strlen(PRIV_CMD_VERSION)) == 0) {
-			/* Get version */
-			len = woal_get_priv_driver_version(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_BANDCFG,
-				    strlen(PRIV_CMD_BANDCFG)) == 0) {
-			/* Set/Get band configuration */
-			len = woal_setget_priv_bandcfg(priv, buf,
-						       priv_cmd.total_len);
+		entry = woal_find_priv_cmd(buf + strlen(CMD_NXP));
+		if (entry && entry->handler) {
+			len = woal_check_priv_cmd_args(
+				entry, buf + strlen(CMD_NXP) + entry->len);
+			if (!len)
+				len = entry->handler(priv, (t_u8 *)buf,
+						     priv_cmd.total_len);
 			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HOSTCMD,
-				    strlen(PRIV_CMD_HOSTCMD)) == 0) {
+		}
+
+		/* Check commands with their own argument list */
+		if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HOSTCMD,
+			     strlen(PRIV_CMD_HOSTCMD)) == 0) {
 			/* hostcmd configuration */
 			len = woal_priv_hostcmd(priv, buf, priv_cmd.total_len,
 						MOAL_IOCTL_WAIT);
@@ -16609,128 +17172,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 							  MOAL_IOCTL_WAIT);
 			len += strlen(CMD_NXP) + strlen(PRIV_CMD_11AXCMDCFG);
 			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_RANGE_EXT,
-				    strlen(PRIV_CMD_RANGE_EXT)) == 0) {
-			len = woal_setget_priv_range_ext(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HTTXCFG,
-				    strlen(PRIV_CMD_HTTXCFG)) == 0) {
-			/* Set/Get HT Tx configuration */
-			len = woal_setget_priv_httxcfg(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HTCAPINFO,
-				    strlen(PRIV_CMD_HTCAPINFO)) == 0) {
-			/* Set/Get HT Capability information */
-			len = woal_setget_priv_htcapinfo(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ADDBAPARA,
-				    strlen(PRIV_CMD_ADDBAPARA)) == 0) {
-			/* Set/Get Add BA parameters */
-			len = woal_setget_priv_addbapara(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AGGRPRIOTBL,
-				    strlen(PRIV_CMD_AGGRPRIOTBL)) == 0) {
-			/* Set/Get Aggregation priority table parameters */
-			len = woal_setget_priv_aggrpriotbl(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ADDBAREJECT,
-				    strlen(PRIV_CMD_ADDBAREJECT)) == 0) {
-			/* Set/Get Add BA reject parameters */
-			len = woal_setget_priv_addbareject(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DELBA,
-				    strlen(PRIV_CMD_DELBA)) == 0) {
-			/* Delete selective BA based on parameters */
-			len = woal_priv_delba(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_REJECTADDBAREQ,
-				    strlen(PRIV_CMD_REJECTADDBAREQ)) == 0) {
-			/* Set/Get the reject addba requst conditions*/
-			len = woal_priv_rejectaddbareq(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_VHTCFG,
-				    strlen(PRIV_CMD_VHTCFG)) == 0) {
-			/* Set/Get 11AC configuration */
-			len = woal_setget_priv_vhtcfg(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_OPERMODECFG,
-				    strlen(PRIV_CMD_OPERMODECFG)) == 0) {
-			/* Set/Get 11AC configuration */
-			len = woal_setget_priv_opermodecfg(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DATARATE,
-				    strlen(PRIV_CMD_DATARATE)) == 0) {
-			/* Get data rate */
-			len = woal_get_priv_datarate(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TXRATECFG,
-				    strlen(PRIV_CMD_TXRATECFG)) == 0) {
-			/* Set/Get tx rate cfg */
-			len = woal_setget_priv_txratecfg(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-#if defined(STA_SUPPORT) || defined(UAP_SUPPORT)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GETLOG,
-				    strlen(PRIV_CMD_GETLOG)) == 0) {
-			/* Get wireless stats information */
-			len = woal_get_priv_getlog(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CUSTOMIE,
-				    strlen(PRIV_CMD_CUSTOMIE)) == 0) {
-			/* Custom IE configuration */
-			len = woal_priv_customie(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ESUPPMODE,
-				    strlen(PRIV_CMD_ESUPPMODE)) == 0) {
-			/* Esupplicant mode configuration */
-			len = woal_setget_priv_esuppmode(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PASSPHRASE,
-				    strlen(PRIV_CMD_PASSPHRASE)) == 0) {
-			/* Esupplicant passphrase configuration */
-			len = woal_setget_priv_passphrase(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DEAUTH,
-				    strlen(PRIV_CMD_DEAUTH)) == 0) {
-			/* Deauth */
-			len = woal_priv_deauth(priv, buf, priv_cmd.total_len);
-			goto handled;
-#ifdef UAP_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AP_DEAUTH,
-				    strlen(PRIV_CMD_AP_DEAUTH)) == 0) {
-			/* AP Deauth */
-			len = woal_priv_ap_deauth(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_GET_STA_LIST,
-				    strlen(PRIV_CMD_GET_STA_LIST)) == 0) {
-			/* Get STA list */
-			len = woal_priv_get_sta_list(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_BSS_CONFIG,
-				    strlen(PRIV_CMD_BSS_CONFIG)) == 0) {
-			/* BSS config */
-			len = woal_priv_bss_config(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
 #ifdef WIFI_DIRECT_SUPPORT
 #if defined(STA_SUPPORT) && defined(UAP_SUPPORT)
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_BSSROLE,
@@ -16742,26 +17183,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 #endif
 #endif
 #ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SETUSERSCAN,
-				    strlen(PRIV_CMD_SETUSERSCAN)) == 0) {
-			/* Set user scan */
-			len = woal_priv_setuserscan(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_GETSCANTABLE,
-				    strlen(PRIV_CMD_GETSCANTABLE)) == 0) {
-			/* Get scan table */
-			len = woal_priv_getscantable(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_GETCHANSTATS,
-				    strlen(PRIV_CMD_GETCHANSTATS)) == 0) {
-			/* Get channel statistics */
-			len = woal_priv_get_chanstats(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_EXTCAPCFG,
 				    strlen(PRIV_CMD_EXTCAPCFG)) == 0) {
 			/* Extended capabilities configure */
@@ -16774,48 +17195,12 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			len = woal_cancel_scan(priv, MOAL_IOCTL_WAIT);
 			goto handled;
 #endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DEEPSLEEP,
-				    strlen(PRIV_CMD_DEEPSLEEP)) == 0) {
-			/* Deep sleep */
-			len = woal_priv_setgetdeepsleep(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_IPADDR,
 				    strlen(PRIV_CMD_IPADDR)) == 0) {
 			/* IP address */
 			len = woal_priv_setgetipaddr(priv, buf,
 						     (t_u32)priv_cmd.total_len);
 			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_WPSSESSION,
-				    strlen(PRIV_CMD_WPSSESSION)) == 0) {
-			/* WPS Session */
-			len = woal_priv_setwpssession(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_OTPUSERDATA,
-				    strlen(PRIV_CMD_OTPUSERDATA)) == 0) {
-			/* OTP user data */
-			len = woal_priv_otpuserdata(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_COUNTRYCODE,
-				    strlen(PRIV_CMD_COUNTRYCODE)) == 0) {
-			/* Country code */
-			len = woal_priv_set_get_countrycode(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CFPINFO,
-				    strlen(PRIV_CMD_CFPINFO)) == 0) {
-			/* CFP info */
-			len = woal_priv_get_cfpinfo(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TCPACKENH,
-				    strlen(PRIV_CMD_TCPACKENH)) == 0) {
-			/* TCP ack enhancement */
-			len = woal_priv_setgettcpackenh(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
 #ifdef REASSOCIATION
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ASSOCBSSID,
 				    strlen(PRIV_CMD_ASSOCBSSID)) == 0) {
@@ -16829,30 +17214,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			len = woal_priv_assocessid(priv, buf,
 						   priv_cmd.total_len, 0);
 			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_WAKEUPREASON,
-				    strlen(PRIV_CMD_WAKEUPREASON)) == 0) {
-			/* wakeup reason */
-			len = woal_priv_getwakeupreason(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-#ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_LISTENINTERVAL,
-				    strlen(PRIV_CMD_LISTENINTERVAL)) == 0) {
-			/* Listen Interval */
-			len = woal_priv_set_get_listeninterval(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-#endif
-#ifdef DEBUG_LEVEL1
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DRVDBG,
-				    strlen(PRIV_CMD_DRVDBG)) == 0) {
-			/* Driver debug bit mask */
-			len = woal_priv_set_get_drvdbg(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
 #endif
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HSCFG,
 				    strlen(PRIV_CMD_HSCFG)) == 0) {
@@ -16860,196 +17221,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			len = woal_priv_hscfg(priv, buf, priv_cmd.total_len,
 					      MTRUE);
 			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HSSETPARA,
-				    strlen(PRIV_CMD_HSSETPARA)) == 0) {
-			/* Set HS parameter */
-			len = woal_priv_hssetpara(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_MGMT_FILTER,
-				    strlen(PRIV_CMD_MGMT_FILTER)) == 0) {
-			/* Management frame filter wakeup */
-			len = woal_priv_mgmt_filter(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SCANCFG,
-				    strlen(PRIV_CMD_SCANCFG)) == 0) {
-			/* Scan configuration */
-			len = woal_priv_set_get_scancfg(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GETNLNUM,
-				    strlen(PRIV_CMD_GETNLNUM)) == 0) {
-			/* Scan configuration */
-			len = woal_priv_getnlnum(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_SET_BSS_MODE,
-				    strlen(PRIV_CMD_SET_BSS_MODE)) == 0) {
-			/* Set bss mode */
-			len = woal_priv_set_bss_mode(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-#ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SET_AP,
-				    strlen(PRIV_CMD_SET_AP)) == 0) {
-			/* Set AP */
-			len = woal_priv_set_ap(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SET_POWER,
-				    strlen(PRIV_CMD_SET_POWER)) == 0) {
-			/* Set power management parameters */
-			len = woal_priv_set_power(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SET_ESSID,
-				    strlen(PRIV_CMD_SET_ESSID)) == 0) {
-			/* Set essid */
-			len = woal_priv_set_essid(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SET_AUTH,
-				    strlen(PRIV_CMD_SET_AUTH)) == 0) {
-			/* Set authentication mode parameters */
-			len = woal_priv_set_auth(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GET_AP,
-				    strlen(PRIV_CMD_GET_AP)) == 0) {
-			/* Get AP */
-			len = woal_priv_get_ap(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GET_POWER,
-				    strlen(PRIV_CMD_GET_POWER)) == 0) {
-			/* Get power management parameters */
-			len = woal_priv_get_power(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PSMODE,
-				    strlen(PRIV_CMD_PSMODE)) == 0) {
-			/* Set/Get PS mode */
-			len = woal_priv_set_get_psmode(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_WARMRESET,
-				    strlen(PRIV_CMD_WARMRESET)) == 0) {
-			/* Performs warm reset */
-			len = woal_priv_warmreset(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TXPOWERCFG,
-				    strlen(PRIV_CMD_TXPOWERCFG)) == 0) {
-			/* TX power configurations */
-			len = woal_priv_txpowercfg(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_RX_ABORT_CFG_EXT,
-				    strlen(PRIV_CMD_RX_ABORT_CFG_EXT)) == 0) {
-			/* dynamic Rx Abort config */
-			len = woal_priv_rx_abort_cfg_ext(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_RX_ABORT_CFG,
-				    strlen(PRIV_CMD_RX_ABORT_CFG)) == 0) {
-			/* static Rx Abort config */
-			len = woal_priv_rx_abort_cfg(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_TX_AMPDU_PROT_MODE,
-				    strlen(PRIV_CMD_TX_AMPDU_PROT_MODE)) == 0) {
-			/* tx ampdu protection mode setting */
-			len = woal_priv_tx_ampdu_prot_mode(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_DOT11MC_UNASSOC_FTM_CFG,
-				    strlen(PRIV_CMD_DOT11MC_UNASSOC_FTM_CFG)) ==
-			   0) {
-			/* setting for dot11mc un-associated case FTM frame
-			 * exchange */
-			len = woal_priv_dot11mc_unassoc_ftm_cfg(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_RATE_ADAPT_CFG,
-				    strlen(PRIV_CMD_RATE_ADAPT_CFG)) == 0) {
-			/* rate adapt config */
-			len = woal_priv_rate_adapt_cfg(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_CCK_DESENSE_CFG,
-				    strlen(PRIV_CMD_CCK_DESENSE_CFG)) == 0) {
-			/* cck desense config */
-			len = woal_priv_cck_desense_cfg(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PSCFG,
-				    strlen(PRIV_CMD_PSCFG)) == 0) {
-			/* PS configurations */
-			len = woal_priv_pscfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_BCNTIMEOUTCFG,
-				    strlen(PRIV_CMD_BCNTIMEOUTCFG)) == 0) {
-			/* Beacon timeout configurations */
-			len = woal_priv_bcntimeoutcfg(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SLEEPPD,
-				    strlen(PRIV_CMD_SLEEPPD)) == 0) {
-			/* Sleep period */
-			len = woal_priv_sleeppd(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TXCONTROL,
-				    strlen(PRIV_CMD_TXCONTROL)) == 0) {
-			/* Tx control */
-			len = woal_priv_txcontrol(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_REGRDWR,
-				    strlen(PRIV_CMD_REGRDWR)) == 0) {
-			/* Register Read/Write */
-			len = woal_priv_regrdwr(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_RDEEPROM,
-				    strlen(PRIV_CMD_RDEEPROM)) == 0) {
-			/* Read the EEPROM contents of the card */
-			len = woal_priv_rdeeprom(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_MEMRDWR,
-				    strlen(PRIV_CMD_MEMRDWR)) == 0) {
-			/* Memory Read/Write */
-			len = woal_priv_memrdwr(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SDCMD52RW,
-				    strlen(PRIV_CMD_SDCMD52RW)) == 0) {
-			/* Cmd52 read/write register */
-			len = woal_priv_sdcmd52rw(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SDIO_CLOCK,
-				    strlen(PRIV_CMD_SDIO_CLOCK)) == 0) {
-			/* Turn on/off the sdio clock */
-			len = woal_priv_sdio_clock_ioctl(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_MPA_CTRL,
-				    strlen(PRIV_CMD_MPA_CTRL)) == 0) {
-			/* Set SDIO Multi-point aggregation
-			 * control parameters */
-			len = woal_priv_sdio_mpa_ctrl(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SD_CMD53_RW,
-				    strlen(PRIV_CMD_SD_CMD53_RW)) == 0) {
-			/* Cmd53 read/write register */
-			len = woal_priv_cmd53rdwr(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ROBUSTCOEX,
 				    strlen(PRIV_CMD_ROBUSTCOEX)) == 0) {
 			/* Set Robustcoex GPIOcfg */
@@ -17059,11 +17230,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			      strlen(CMD_NXP);
 			len = woal_priv_robustcoex(priv, pdata, len);
 			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DMCS,
-				    strlen(PRIV_CMD_DMCS)) == 0) {
-			/* Set/Get DMCS config */
-			len = woal_priv_dmcs(priv, buf, priv_cmd.total_len);
-			goto handled;
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_HAL_PHY_CFG,
 				    strlen(PRIV_CMD_HAL_PHY_CFG)) == 0) {
 			/* Set hal_phy config */
@@ -17082,22 +17248,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			priv->csi_seq = 0;
 			len = woal_priv_csi_cmd(priv, pdata, len);
 			goto handled;
-#ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ARPFILTER,
-				    strlen(PRIV_CMD_ARPFILTER)) == 0) {
-			/* ARPFilter Configuration */
-			len = woal_priv_arpfilter(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-#endif
-#if defined(SDIO_SUSPEND_RESUME)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AUTO_ARP,
-				    strlen(PRIV_CMD_AUTO_ARP)) == 0) {
-			/* Auto ARP enable/disable */
-			len = woal_priv_set_get_auto_arp(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-#endif
 #ifdef RX_PACKET_COALESCE
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_RX_COAL_CFG,
 				    strlen(PRIV_CMD_RX_COAL_CFG)) == 0) {
@@ -17107,42 +17257,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			goto handled;
 #endif
 
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MGMT_FRAME_CTRL,
-				    strlen(PRIV_CMD_MGMT_FRAME_CTRL)) == 0) {
-			/* Mgmt Frame Passthrough Ctrl */
-			len = woal_priv_mgmt_frame_passthru_ctrl(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_QCONFIG,
-				    strlen(PRIV_CMD_QCONFIG)) == 0) {
-			/* Queue config */
-			len = woal_priv_qconfig(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ADDTS,
-				    strlen(PRIV_CMD_ADDTS)) == 0) {
-			/* Send an ADDTS TSPEC */
-			len = woal_priv_wmm_addts_req_ioctl(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DELTS,
-				    strlen(PRIV_CMD_DELTS)) == 0) {
-			/* Send a DELTS TSPE */
-			len = woal_priv_wmm_delts_req_ioctl(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_QSTATUS,
-				    strlen(PRIV_CMD_QSTATUS)) == 0) {
-			/* Get the status of the WMM queues */
-			len = woal_priv_wmm_queue_status_ioctl(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TS_STATUS,
-				    strlen(PRIV_CMD_TS_STATUS)) == 0) {
-			/* Get the status of the WMM Traffic Streams */
-			len = woal_priv_wmm_ts_status_ioctl(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
 #ifdef STA_SUPPORT
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_QOS_CFG,
 				    strlen(PRIV_CMD_QOS_CFG)) == 0) {
@@ -17164,48 +17278,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 				len = sizeof(t_u8);
 			goto handled;
 #endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_MAC_CTRL,
-				    strlen(PRIV_CMD_MAC_CTRL)) == 0) {
-			/* MAC CTRL */
-			len = woal_priv_macctrl(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GETWAP,
-				    strlen(PRIV_CMD_GETWAP)) == 0) {
-			/* Get WAP */
-			len = woal_priv_getwap(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_REGION_CODE,
-				    strlen(PRIV_CMD_REGION_CODE)) == 0) {
-			/* Region Code */
-			len = woal_priv_region_code(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DRCS_CFG,
-				    strlen(PRIV_CMD_DRCS_CFG)) == 0) {
-			/* DRCS configuration for mc_cfg_ext*/
-			len = woal_priv_drcs_time_slicing_cfg(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MULTI_CHAN_CFG,
-				    strlen(PRIV_CMD_MULTI_CHAN_CFG)) == 0) {
-			/* Channel time and buffer weight configuration */
-			len = woal_priv_multi_chan_config(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MULTI_CHAN_POLICY,
-				    strlen(PRIV_CMD_MULTI_CHAN_POLICY)) == 0) {
-			/* Multi-channel Policy enable/disable */
-			len = woal_priv_multi_chan_policy(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_FWMACADDR,
-				    strlen(PRIV_CMD_FWMACADDR)) == 0) {
-			/* Set FW MAC address */
-			len = woal_priv_fwmacaddr(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
 #if defined(STA_CFG80211) || defined(UAP_CFG80211)
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(2, 6, 39)
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_OFFCHANNEL,
@@ -17222,182 +17294,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 #endif
 #endif
 
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DSCP_MAP,
-				    strlen(PRIV_CMD_DSCP_MAP)) == 0) {
-			/* Set/Get DSCP Map */
-			len = woal_priv_set_get_dscp_map(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_VEREXT,
-				    strlen(PRIV_CMD_VEREXT)) == 0) {
-			/* Get Extended version */
-			len = woal_priv_get_driver_verext(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-#if defined(STA_SUPPORT) && defined(STA_WEXT)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_RADIO_CTRL,
-				    strlen(PRIV_CMD_RADIO_CTRL)) == 0) {
-			/* Set/Get radio */
-			len = woal_priv_radio_ctrl(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_WMM_CFG,
-				    strlen(PRIV_CMD_WMM_CFG)) == 0) {
-			/* Implement WMM enable command */
-			len = woal_priv_wmm_cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MIN_BA_THRESH_CFG,
-				    strlen(PRIV_CMD_MIN_BA_THRESH_CFG)) == 0) {
-			/* Implement Minimum BA threshold configuration command
-			 */
-			len = woal_priv_min_ba_threshold_cfg(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-#if defined(STA_SUPPORT)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_11D_CFG,
-				    strlen(PRIV_CMD_11D_CFG)) == 0) {
-			/* Implement 802.11D enable command */
-			len = woal_priv_11d_cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_11D_CLR_TBL,
-				    strlen(PRIV_CMD_11D_CLR_TBL)) == 0) {
-			/* Implement 802.11D clear chan table command */
-			len = woal_priv_11d_clr_chan_tbl(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_11K_CFG,
-				    strlen(PRIV_CMD_11K_CFG)) == 0) {
-			/* Implement 802.11K enable command */
-			len = woal_priv_11k_cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_11K_NEIGHBOR_REPORT,
-				    strlen(PRIV_CMD_11K_NEIGHBOR_REPORT)) ==
-			   0) {
-			/* Implement 802.11K get neighbor AP list command */
-			len = woal_priv_11k_neighbor_report(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
-#ifndef OPCHAN
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_WWS_CFG,
-				    strlen(PRIV_CMD_WWS_CFG)) == 0) {
-			/* Set/Get WWS configuration */
-			len = woal_priv_wws_cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-#endif
-#if defined(REASSOCIATION)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_REASSOCTRL,
-				    strlen(PRIV_CMD_REASSOCTRL)) == 0) {
-			/* Set/Get reassociation settings */
-			len = woal_priv_set_get_reassoc(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TXBUF_CFG,
-				    strlen(PRIV_CMD_TXBUF_CFG)) == 0) {
-			/* Get Transmit buffer size */
-			len = woal_priv_txbuf_cfg(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-#ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AUTH_TYPE,
-				    strlen(PRIV_CMD_AUTH_TYPE)) == 0) {
-			/* Set/Get auth type */
-			len = woal_priv_auth_type(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_POWER_CONS,
-				    strlen(PRIV_CMD_POWER_CONS)) == 0) {
-			/* Set/get user provisioned local power constraint */
-			len = woal_priv_11h_local_pwr_constraint(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_THERMAL,
-				    strlen(PRIV_CMD_THERMAL)) == 0) {
-			/* Get thermal reading */
-			len = woal_priv_thermal(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_BCN_INTERVAL,
-				    strlen(PRIV_CMD_BCN_INTERVAL)) == 0) {
-			/* Set/Get beacon interval */
-			len = woal_priv_beacon_interval(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-#ifdef STA_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_GET_SIGNAL,
-				    strlen(PRIV_CMD_GET_SIGNAL)) == 0) {
-			/* Get signal */
-			len = woal_priv_get_signal(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
-#if defined(STA_SUPPORT)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PMFCFG,
-				    strlen(PRIV_CMD_PMFCFG)) == 0) {
-			/* Configure PMF */
-			len = woal_priv_set_get_pmfcfg(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_INACTIVITYTO,
-				    strlen(PRIV_CMD_INACTIVITYTO)) == 0) {
-			/* Get/Set inactivity timeout extend */
-			len = woal_priv_inactivity_timeout_ext(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_AMSDU_AGGR_CTRL,
-				    strlen(PRIV_CMD_AMSDU_AGGR_CTRL)) == 0) {
-			/* Enable/Disable amsdu_aggr_ctrl */
-			len = woal_priv_11n_amsdu_aggr_ctrl(priv, buf,
-							    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MCAST_AGGR_GROUP,
-				    strlen(PRIV_CMD_MCAST_AGGR_GROUP)) == 0) {
-			/* mcast_aggr_group cfg*/
-			len = woal_priv_mcast_aggr_group_cfg(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_MC_AGGR_CFG,
-				    strlen(PRIV_CMD_MC_AGGR_CFG)) == 0) {
-			/* mc_aggr_cfg*/
-			len = woal_priv_mc_aggr_cfg(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CH_LOAD,
-				    strlen(PRIV_CMD_CH_LOAD)) == 0) {
-			/* mc_aggr_cfg*/
-			len = woal_priv_get_ch_load(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TX_BF_CAP,
-				    strlen(PRIV_CMD_TX_BF_CAP)) == 0) {
-			/* Set/Get Transmit beamforming capabilities */
-			len = woal_priv_tx_bf_cap_ioctl(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_SLEEP_PARAMS,
-				    strlen(PRIV_CMD_SLEEP_PARAMS)) == 0) {
-			/* Configure sleep parameters */
-			len = woal_priv_sleep_params_ioctl(priv, buf,
-							   priv_cmd.total_len);
-			goto handled;
-#ifdef UAP_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_NET_MON,
-				    strlen(PRIV_CMD_NET_MON)) == 0) {
-			/* Set/Get network monitor configurations */
-			len = woal_priv_net_monitor_ioctl(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-#endif
 #if defined(STA_CFG80211) && defined(UAP_CFG80211)
 		} else if (strnicmp(buf + strlen(CMD_NXP),
 				    PRIV_CMD_MONITOR_MODE,
@@ -17412,191 +17308,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 				      1;
 			goto handled;
 #endif
-#if defined(DFS_TESTING_SUPPORT)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DFS_TESTING,
-				    strlen(PRIV_CMD_DFS_TESTING)) == 0) {
-			/* Set/Get DFS Testing settings */
-			len = woal_priv_dfs_testing(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CLEAR_NOP,
-				    strlen(PRIV_CMD_CLEAR_NOP)) == 0) {
-			/* Set/Get DFS Testing settings */
-			len = woal_priv_clear_nop(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_FAKE_RADAR,
-				    strlen(PRIV_CMD_FAKE_RADAR)) == 0) {
-			/* mcast_aggr_group cfg*/
-			len = woal_priv_fake_radar(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DFS53_CFG,
-				    strlen(PRIV_CMD_DFS53_CFG)) == 0) {
-			/* Set/Get DFS W53 settings */
-			len = woal_priv_dfs53cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-#ifdef UAP_SUPPORT
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DFS_CAC,
-				    strlen(PRIV_CMD_DFS_CAC)) == 0) {
-			/* perform CAC */
-			len = woal_priv_do_dfs_cac(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AUTODFS,
-				    strlen(PRIV_CMD_AUTODFS)) == 0) {
-			len = woal_priv_auto_dfs_cfg(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ARB_CFG,
-				    strlen(PRIV_CMD_ARB_CFG)) == 0) {
-			/* Set/Get CFP table codes */
-			len = woal_priv_arbcfg(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CFP_CODE,
-				    strlen(PRIV_CMD_CFP_CODE)) == 0) {
-			/* Set/Get CFP table codes */
-			len = woal_priv_cfp_code(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ANT_CFG,
-				    strlen(PRIV_CMD_ANT_CFG)) == 0) {
-			/* Set/Get Tx/Rx antenna */
-			len = woal_priv_set_get_tx_rx_ant(priv, buf,
-							  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_SYSCLOCK,
-				    strlen(PRIV_CMD_SYSCLOCK)) == 0) {
-			/* Get/Set system clock */
-			len = woal_priv_sysclock(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_ASSOCIATE,
-				    strlen(PRIV_CMD_ASSOCIATE)) == 0) {
-			/* Associate to a specific indexed entry in the
-			 * ScanTable */
-			len = woal_priv_associate_ssid_bssid(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_TX_BF_CFG,
-				    strlen(PRIV_CMD_TX_BF_CFG)) == 0) {
-			/* Set/Get Transmit beamforming configuration */
-			len = woal_priv_tx_bf_cfg(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_BOOTSLEEP,
-				    strlen(PRIV_CMD_BOOTSLEEP)) == 0) {
-			len = woal_priv_bootsleep(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PORT_CTRL,
-				    strlen(PRIV_CMD_PORT_CTRL)) == 0) {
-			/* Set/Get Port Control mode */
-			len = woal_priv_port_ctrl(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PB_BYPASS,
-				    strlen(PRIV_CMD_PB_BYPASS)) == 0) {
-			/* Private IOCTL entry to get the By-passed TX packet
-			 * from upper layer */
-			len = woal_priv_bypassed_packet(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-#ifdef WIFI_DIRECT_SUPPORT
-#if defined(UAP_CFG80211)
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CFG_NOA,
-				    strlen(PRIV_CMD_CFG_NOA)) == 0) {
-			/* Set/Get P2P NoA (Notice of Absence) parameters */
-			len = woal_priv_cfg_noa(priv, buf, priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_CFG_OPP_PS,
-				    strlen(PRIV_CMD_CFG_OPP_PS)) == 0) {
-			/* Set/Get P2P OPP-PS parameters */
-			len = woal_priv_cfg_opp_ps(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-#endif
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_CFG_CLOCK_SYNC,
-				    strlen(PRIV_CMD_CFG_CLOCK_SYNC)) == 0) {
-			/* Set/Get P2P NoA (Notice of Absence) parameters */
-			len = woal_priv_cfg_clock_sync(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_CFG_GET_TSF_INFO,
-				    strlen(PRIV_CMD_CFG_GET_TSF_INFO)) == 0) {
-			/* Get TSF info */
-			len = woal_priv_cfg_get_tsf_info(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_TARGET_CHANNEL,
-				    strlen(PRIV_CMD_TARGET_CHANNEL)) == 0) {
-			/* Get/Set Target channel*/
-			len = woal_priv_target_channel(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_BACKUP_CHANNEL,
-				    strlen(PRIV_CMD_BACKUP_CHANNEL)) == 0) {
-			/* Get/Set Backup channel*/
-			len = woal_priv_backup_channel(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_DFS_REPEATER_CFG,
-				    strlen(PRIV_CMD_DFS_REPEATER_CFG)) == 0) {
-			/* Set/Get DFS_REPEATER mode */
-			len = woal_priv_dfs_repeater_cfg(priv, buf,
-							 priv_cmd.total_len);
-			goto handled;
-#ifdef WIFI_DIRECT_SUPPORT
-#if defined(STA_CFG80211) || defined(UAP_CFG80211)
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_MIRACAST_CFG,
-				    strlen(PRIV_CMD_MIRACAST_CFG)) == 0) {
-			/* Set/Get MIRACAST configuration parameters */
-			len = woal_priv_miracast_cfg(priv, buf,
-						     priv_cmd.total_len);
-			goto handled;
-#endif
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_COEX_RX_WINSIZE,
-				    strlen(PRIV_CMD_COEX_RX_WINSIZE)) == 0) {
-			/* Set/Get control to coex RX window size */
-			len = woal_priv_coex_rx_winsize(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_TX_AGGR_CTRL,
-				    strlen(PRIV_CMD_TX_AGGR_CTRL)) == 0) {
-			/* Set/Get control to TX AMPDU on infra link */
-			len = woal_priv_txaggrctrl(priv, buf,
-						   priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_AUTO_TDLS,
-				    strlen(PRIV_CMD_AUTO_TDLS)) == 0) {
-			/* Set/Get control to enable/disable auto TDLS */
-			len = woal_priv_auto_tdls(priv, buf,
-						  priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_TDLS_IDLE_TIME,
-				    strlen(PRIV_CMD_TDLS_IDLE_TIME)) == 0) {
-			/* Set/Get TDLS idle timeout value */
-			len = woal_priv_tdls_idle_time(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_GET_SENSOR_TEMP,
-				    strlen(PRIV_CMD_GET_SENSOR_TEMP)) == 0) {
-			/* Get SOC temperature */
-			len = woal_priv_get_sensor_temp(priv, buf,
-							priv_cmd.total_len);
-			goto handled;
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
 #if defined(STA_CFG80211) || defined(UAP_CFG80211)
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DFS_OFFLOAD,
@@ -17612,45 +17323,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 			goto handled;
 #endif
 #endif
-#if defined(UAP_SUPPORT)
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_EXTEND_CHAN_SWITCH,
-				    strlen(PRIV_CMD_EXTEND_CHAN_SWITCH)) == 0) {
-			/* Extended channel switch */
-			len = woal_priv_extend_channel_switch(
-				priv, buf, priv_cmd.total_len);
-			goto handled;
-#endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DYN_BW,
-				    strlen(PRIV_CMD_DYN_BW)) == 0) {
-			/* Set/Get dynamic bandwidth */
-			len = woal_priv_config_dyn_bw(priv, buf,
-						      priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_IND_RST_CFG,
-				    strlen(PRIV_CMD_IND_RST_CFG)) == 0) {
-			/* Set/Get out band independent reset */
-			len = woal_priv_ind_rst_cfg(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_PER_PKT_CFG,
-				    strlen(PRIV_CMD_PER_PKT_CFG)) == 0) {
-			/* Get/Set per packet Txctl and Rxinfo configuration */
-			len = woal_priv_per_pkt_cfg(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_DEAUTH_CTRL,
-				    strlen(PRIV_CMD_DEAUTH_CTRL)) == 0) {
-			len = woal_priv_deauth_ctrl(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP),
-				    PRIV_CMD_GET_CORRELATED_TIME,
-				    strlen(PRIV_CMD_GET_CORRELATED_TIME)) ==
-			   0) {
-			len = woal_get_correlated_time(priv, buf,
-						       priv_cmd.total_len);
-			goto handled;
 		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_11AXCFG,
 				    strlen(PRIV_CMD_11AXCFG)) == 0) {
 			pdata = buf + strlen(CMD_NXP) +
@@ -17697,16 +17369,6 @@ int woal_android_priv_cmd(struct net_device *dev, struct ifreq *req)
 				      1;
 			goto handled;
 #endif
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_LPM,
-				    strlen(PRIV_CMD_LPM)) == 0) {
-			/* Set/Get low power mode */
-			len = woal_priv_set_get_lpm(priv, buf,
-						    priv_cmd.total_len);
-			goto handled;
-		} else if (strnicmp(buf + strlen(CMD_NXP), PRIV_CMD_IPS_CFG,
-				    strlen(PRIV_CMD_IPS_CFG)) == 0) {
-			len = woal_priv_ips_cfg(priv, buf, priv_cmd.total_len);
-			goto handled;
 		} else {
 			PRINTM(MERROR,
 			       "Unknown NXP PRIVATE command %s, ignored\n",
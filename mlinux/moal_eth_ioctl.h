@@ -296,6 +296,29 @@ typedef struct _chan_stats {
 #define PRIV_CMD_DOT11MC_UNASSOC_FTM_CFG "dot11mc_unassoc_ftm_cfg"
 #define PRIV_CMD_HAL_PHY_CFG "hal_phy_cfg"
 #define PRIV_CMD_IPS_CFG "ips_cfg"
+/** Private command: list the NXP private commands */
+#define PRIV_CMD_CMDLIST "cmdlist"
+/** Private command: binary TLV stats query */
+#define PRIV_CMD_STATS_TLV "statstlv"
+
+/** statstlv TLV type: mlan_ds_get_signal */
+#define STATS_TLV_SIGNAL 1
+/** statstlv TLV type: mlan_ds_get_stats, same as getlog */
+#define STATS_TLV_GETLOG 2
+/** statstlv TLV type: mlan_data_rate, same as getdatarate */
+#define STATS_TLV_DATARATE 3
+/** Number of statstlv TLV types */
+#define STATS_TLV_MAX 3
+
+/** statstlv response TLV */
+typedef struct _woal_stats_tlv {
+	/** TLV type, STATS_TLV_* */
+	t_u16 type;
+	/** Length of value */
+	t_u16 len;
+	/** Value */
+	t_u8 value[];
+} __ATTRIB_PACK__ woal_stats_tlv;
 
 /** Private command ID for Android default commands */
 #define WOAL_ANDROID_DEF_CMD (SIOCDEVPRIVATE + 1)
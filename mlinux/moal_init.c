@@ -134,6 +134,8 @@ static int shutdown_hs;
 static int slew_rate = 3;
 static int rps = 0;
 static int tx_skb_clone = 0;
+static int tx_stage = 0;
+static int main_thread = 0;
 #ifdef IMX_SUPPORT
 static int pmqos = 1;
 #else
@@ -187,6 +189,33 @@ static int wq_sched_prio;
 static int wq_sched_policy = SCHED_NORMAL;
 /** rx_work flag */
 static int rx_work;
+/** TX timestamp clock: 0 precise, 1 coarse (jiffies) */
+static int tx_tstamp = TX_TSTAMP_PRECISE;
+/** CPU the main process thread is bound to, -1 for none */
+static int main_thread_cpu = -1;
+/** CPU the rx process thread is bound to, -1 for none */
+static int rx_thread_cpu = -1;
+/** Event ring size in KB, 0 to disable */
+static int evt_ring;
+/** Period in ms of the firmware station list refresh for sta_stats, 0 to
+ * disable */
+static int sta_stats_refresh;
+/** Lifetime in ms of cached firmware command responses, 0 to disable */
+static int cmd_cache_ttl;
+/** Max interrupt status polls after an SDIO interrupt, 0 to disable */
+static int int_poll_budget;
+/** Delay in us before each interrupt status poll */
+static int int_poll_window;
+/** Trace ring records per CPU, 0 to disable */
+static int trace_ring;
+/** Monitor capture ring size in KB, 0 to disable */
+static int mon_ring;
+/** CSI ring size in KB, 0 to disable */
+static int csi_ring;
+/** Max sleep confirm hold-off in ms after recent traffic, 0 to disable */
+static int ps_hold_max;
+/** Keep interfaces up and replay cached settings on fw reload */
+static int fast_reload;
 
 static int hw_test;
 
@@ -251,6 +280,17 @@ static t_u16 inact_tmo;
 #define DEFAULT_DEBUG_MASK (MMSG | MFATAL | MERROR | MREG_D)
 #endif /* DEBUG_LEVEL2 */
 t_u32 drvdbg = DEFAULT_DEBUG_MASK;
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 3, 0)
+/** Patched in while a trace ring records events */
+DEFINE_STATIC_KEY_FALSE(woal_trace_key);
+/** Patched in while a data path debug level is set */
+DEFINE_STATIC_KEY_FALSE(woal_dbg_data_key);
+#else
+/** Set while a trace ring records events */
+t_u8 woal_trace_enabled;
+/** Set while a data path debug level is set */
+t_u8 woal_dbg_data_enabled;
+#endif
 
 #endif /* DEBUG_LEVEL1 */
 
@@ -842,6 +882,98 @@ static mlan_status parse_cfg_read_block(t_u8 *data, t_u32 size,
 				goto err;
 			params->rx_work = out_data;
 			PRINTM(MMSG, "rx_work=0x%x\n", params->rx_work);
+		} else if (strncmp(line, "tx_tstamp", strlen("tx_tstamp")) ==
+			   0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->tx_tstamp = out_data;
+			PRINTM(MMSG, "tx_tstamp=%d\n", params->tx_tstamp);
+		} else if (strncmp(line, "main_thread_cpu",
+				   strlen("main_thread_cpu")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->main_thread_cpu = out_data;
+			PRINTM(MMSG, "main_thread_cpu=%d\n",
+			       params->main_thread_cpu);
+		} else if (strncmp(line, "rx_thread_cpu",
+				   strlen("rx_thread_cpu")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->rx_thread_cpu = out_data;
+			PRINTM(MMSG, "rx_thread_cpu=%d\n", params->rx_thread_cpu);
+		} else if (strncmp(line, "evt_ring", strlen("evt_ring")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->evt_ring = out_data;
+			PRINTM(MMSG, "evt_ring=%d\n", params->evt_ring);
+		} else if (strncmp(line, "sta_stats_refresh",
+				   strlen("sta_stats_refresh")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->sta_stats_refresh = out_data;
+			PRINTM(MMSG, "sta_stats_refresh=%d\n",
+			       params->sta_stats_refresh);
+		} else if (strncmp(line, "cmd_cache_ttl",
+				   strlen("cmd_cache_ttl")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->cmd_cache_ttl = out_data;
+			PRINTM(MMSG, "cmd_cache_ttl=%d\n", params->cmd_cache_ttl);
+		} else if (strncmp(line, "int_poll_budget",
+				   strlen("int_poll_budget")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->int_poll_budget = out_data;
+			PRINTM(MMSG, "int_poll_budget=%d\n",
+			       params->int_poll_budget);
+		} else if (strncmp(line, "int_poll_window",
+				   strlen("int_poll_window")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->int_poll_window = out_data;
+			PRINTM(MMSG, "int_poll_window=%d\n",
+			       params->int_poll_window);
+		} else if (strncmp(line, "trace_ring",
+				   strlen("trace_ring")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->trace_ring = out_data;
+			PRINTM(MMSG, "trace_ring=%d\n", params->trace_ring);
+		} else if (strncmp(line, "mon_ring", strlen("mon_ring")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->mon_ring = out_data;
+			PRINTM(MMSG, "mon_ring=%d\n", params->mon_ring);
+		} else if (strncmp(line, "csi_ring", strlen("csi_ring")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->csi_ring = out_data;
+			PRINTM(MMSG, "csi_ring=%d\n", params->csi_ring);
+		} else if (strncmp(line, "ps_hold_max",
+				   strlen("ps_hold_max")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->ps_hold_max = out_data;
+			PRINTM(MMSG, "ps_hold_max=%d\n", params->ps_hold_max);
+		} else if (strncmp(line, "fast_reload",
+				   strlen("fast_reload")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			params->fast_reload = out_data;
+			PRINTM(MMSG, "fast_reload=%d\n", params->fast_reload);
 		} else if (strncmp(line, "wakelock_timeout",
 				   strlen("wakelock_timeout")) == 0) {
 			if (parse_line_read_int(line, &out_data) !=
@@ -1015,6 +1147,30 @@ static mlan_status parse_cfg_read_block(t_u8 *data, t_u32 size,
 			       moal_extflg_isset(handle, EXT_TX_SKB_CLONE) ?
 				       "on" :
 				       "off");
+		} else if (strncmp(line, "tx_stage", strlen("tx_stage")) == 0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			if (out_data)
+				moal_extflg_set(handle, EXT_TX_STAGE);
+			else
+				moal_extflg_clear(handle, EXT_TX_STAGE);
+			PRINTM(MMSG, "tx_stage %s\n",
+			       moal_extflg_isset(handle, EXT_TX_STAGE) ? "on" :
+									 "off");
+		} else if (strncmp(line, "main_thread", strlen("main_thread")) ==
+			   0) {
+			if (parse_line_read_int(line, &out_data) !=
+			    MLAN_STATUS_SUCCESS)
+				goto err;
+			if (out_data)
+				moal_extflg_set(handle, EXT_MAIN_THREAD);
+			else
+				moal_extflg_clear(handle, EXT_MAIN_THREAD);
+			PRINTM(MMSG, "main_thread %s\n",
+			       moal_extflg_isset(handle, EXT_MAIN_THREAD) ?
+				       "on" :
+				       "off");
 		} else if (strncmp(line, "pmqos", strlen("pmqos")) == 0) {
 			if (parse_line_read_int(line, &out_data) !=
 			    MLAN_STATUS_SUCCESS)
@@ -1371,10 +1527,36 @@ static void woal_setup_module_param(moal_handle *handle, moal_mod_para *params)
 	handle->params.wq_sched_prio = wq_sched_prio;
 	handle->params.wq_sched_policy = wq_sched_policy;
 	handle->params.rx_work = rx_work;
+	handle->params.tx_tstamp = tx_tstamp;
+	handle->params.main_thread_cpu = main_thread_cpu;
+	handle->params.rx_thread_cpu = rx_thread_cpu;
+	handle->params.evt_ring = evt_ring;
+	handle->params.sta_stats_refresh = sta_stats_refresh;
+	handle->params.cmd_cache_ttl = cmd_cache_ttl;
+	handle->params.int_poll_budget = int_poll_budget;
+	handle->params.int_poll_window = int_poll_window;
+	handle->params.trace_ring = trace_ring;
+	handle->params.mon_ring = mon_ring;
+	handle->params.csi_ring = csi_ring;
+	handle->params.ps_hold_max = ps_hold_max;
+	handle->params.fast_reload = fast_reload;
 	if (params) {
 		handle->params.wq_sched_prio = params->wq_sched_prio;
 		handle->params.wq_sched_policy = params->wq_sched_policy;
 		handle->params.rx_work = params->rx_work;
+		handle->params.tx_tstamp = params->tx_tstamp;
+		handle->params.main_thread_cpu = params->main_thread_cpu;
+		handle->params.rx_thread_cpu = params->rx_thread_cpu;
+		handle->params.evt_ring = params->evt_ring;
+		handle->params.sta_stats_refresh = params->sta_stats_refresh;
+		handle->params.cmd_cache_ttl = params->cmd_cache_ttl;
+		handle->params.int_poll_budget = params->int_poll_budget;
+		handle->params.int_poll_window = params->int_poll_window;
+		handle->params.trace_ring = params->trace_ring;
+		handle->params.mon_ring = params->mon_ring;
+		handle->params.csi_ring = params->csi_ring;
+		handle->params.ps_hold_max = params->ps_hold_max;
+		handle->params.fast_reload = params->fast_reload;
 	}
 
 	handle->params.wakelock_timeout = wakelock_timeout;
@@ -1426,6 +1608,10 @@ static void woal_setup_module_param(moal_handle *handle, moal_mod_para *params)
 		moal_extflg_set(handle, EXT_RPS);
 	if (tx_skb_clone)
 		moal_extflg_set(handle, EXT_TX_SKB_CLONE);
+	if (tx_stage)
+		moal_extflg_set(handle, EXT_TX_STAGE);
+	if (main_thread)
+		moal_extflg_set(handle, EXT_MAIN_THREAD);
 	if (pmqos)
 		moal_extflg_set(handle, EXT_PMQOS);
 
@@ -2204,7 +2390,42 @@ MODULE_PARM_DESC(nan_name, "NAN interface name");
 module_param(max_nan_bss, int, 0);
 MODULE_PARM_DESC(max_nan_bss, "Number of NAN interfaces (1)");
 #ifdef DEBUG_LEVEL1
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 36)
+/**
+ *  @brief This function sets drvdbg from sysfs and switches the debug
+ *  static keys to match
+ *
+ *  @param val      Parameter string
+ *  @param kp       A pointer to kernel_param structure
+ *
+ *  @return         0 or error code
+ */
+static int woal_set_drvdbg_param(const char *val,
+				 const struct kernel_param *kp)
+{
+	int ret = param_set_uint(val, kp);
+	int i;
+
+	if (ret)
+		return ret;
+	/* The keys are set up at card init, only follow later writes */
+	for (i = 0; i < MAX_MLAN_ADAPTER; i++) {
+		if (m_handle[i]) {
+			woal_update_dbg_keys(drvdbg);
+			break;
+		}
+	}
+	return 0;
+}
+
+static const struct kernel_param_ops woal_drvdbg_ops = {
+	.set = woal_set_drvdbg_param,
+	.get = param_get_uint,
+};
+module_param_cb(drvdbg, &woal_drvdbg_ops, &drvdbg, 0660);
+#else
 module_param(drvdbg, uint, 0660);
+#endif
 MODULE_PARM_DESC(drvdbg, "Driver debug");
 #endif /* DEBUG_LEVEL1 */
 module_param(auto_ds, int, 0660);
@@ -2259,6 +2480,12 @@ MODULE_PARM_DESC(rps, "1: Enable rps; 0: Disable rps");
 module_param(tx_skb_clone, uint, 0660);
 MODULE_PARM_DESC(tx_skb_clone,
 		 "1: Enable tx_skb_clone; 0: Disable tx_skb_clone");
+module_param(tx_stage, uint, 0);
+MODULE_PARM_DESC(tx_stage, "1: Enable TX staging; 0: Disable TX staging");
+module_param(main_thread, uint, 0);
+MODULE_PARM_DESC(
+	main_thread,
+	"1: Run main and rx process in dedicated threads; 0: Use work queues");
 module_param(pmqos, uint, 0660);
 MODULE_PARM_DESC(pmqos, "1: Enable pmqos; 0: Disable pmqos");
 
@@ -2300,6 +2527,55 @@ module_param(rx_work, int, 0);
 MODULE_PARM_DESC(
 	rx_work,
 	"0: default; 1: Enable rx_work_queue; 2: Disable rx_work_queue");
+module_param(tx_tstamp, int, 0);
+MODULE_PARM_DESC(
+	tx_tstamp,
+	"0: Precise clock for TX timestamps (default); 1: Coarse (jiffies) clock for TX timestamps");
+module_param(main_thread_cpu, int, 0);
+MODULE_PARM_DESC(main_thread_cpu,
+		 "CPU to bind the main process thread to, -1: no binding");
+module_param(rx_thread_cpu, int, 0);
+MODULE_PARM_DESC(rx_thread_cpu,
+		 "CPU to bind the rx process thread to, -1: no binding");
+module_param(evt_ring, int, 0);
+MODULE_PARM_DESC(
+	evt_ring,
+	"Size in KB of the event ring read through /proc/mwlan/adapterX/event_ring, 0: disabled (default)");
+module_param(sta_stats_refresh, int, 0);
+MODULE_PARM_DESC(
+	sta_stats_refresh,
+	"Period in ms of the firmware station list refresh for sta_stats proc, 0: disabled (default)");
+module_param(cmd_cache_ttl, int, 0);
+MODULE_PARM_DESC(
+	cmd_cache_ttl,
+	"Lifetime in ms of cached responses to read-only firmware commands, 0: disabled (default)");
+module_param(int_poll_budget, int, 0);
+MODULE_PARM_DESC(
+	int_poll_budget,
+	"Max interrupt status polls after an SDIO interrupt while the card has work, 0: disabled (default)");
+module_param(int_poll_window, int, 0);
+MODULE_PARM_DESC(int_poll_window,
+		 "Delay in us before each interrupt status poll, 0: no delay");
+module_param(trace_ring, int, 0);
+MODULE_PARM_DESC(
+	trace_ring,
+	"Trace ring records per CPU, recorded while drvdbg has MTRACE_D set, 0: disabled (default)");
+module_param(mon_ring, int, 0);
+MODULE_PARM_DESC(
+	mon_ring,
+	"Size in KB of the monitor capture ring mapped through /proc/mwlan/adapterX/mon_ring, 0: disabled (default)");
+module_param(csi_ring, int, 0);
+MODULE_PARM_DESC(
+	csi_ring,
+	"Size in KB of the CSI report ring mapped through /proc/mwlan/adapterX/csi_ring, 0: disabled (default)");
+module_param(ps_hold_max, int, 0);
+MODULE_PARM_DESC(
+	ps_hold_max,
+	"Max time in ms to hold off the sleep confirm while traffic bursts are expected, 0: disabled (default)");
+module_param(fast_reload, int, 0);
+MODULE_PARM_DESC(
+	fast_reload,
+	"1: Keep interfaces up and the scan table, replay only cached settings on fw reload (other MLAN state is reset); 0: reset all interfaces (default)");
 
 module_param(wakelock_timeout, int, 0);
 MODULE_PARM_DESC(wakelock_timeout, "set wakelock_timeout value (ms)");
@@ -424,7 +424,16 @@ static inline void woal_fill_wait_queue(moal_private *priv, wait_queue *wait,
 		init_waitqueue_head(&wait->wait);
 		wait->wait_timeout = MTRUE;
 		break;
+	case MOAL_IOCTL_ASYNC:
+		/* Keep the callback; without one the request is collected
+		 * later by woal_wait_ioctl_complete(), as the batch does */
+		init_waitqueue_head(&wait->wait);
+		wait->wait_timeout = MTRUE;
+		LEAVE();
+		return;
 	}
+	wait->callback = NULL;
+	wait->ctx = NULL;
 	LEAVE();
 	return;
 }
@@ -785,16 +794,18 @@ mlan_status woal_request_ioctl(moal_private *priv, mlan_ioctl_req *req,
 	case MLAN_STATUS_PENDING:
 		if (wait_option == MOAL_NO_WAIT)
 			PRINTM(MIOCTL, "IOCTL MOAL_NO_WAIT: %p\n", req);
+		else if (wait_option == MOAL_IOCTL_ASYNC)
+			PRINTM(MIOCTL, "IOCTL MOAL_IOCTL_ASYNC: %p\n", req);
 		else
 			PRINTM(MIOCTL,
 			       "IOCTL pending: %p id=0x%x, sub_id=0x%x wait_option=%d, action=%d\n",
 			       req, req->req_id, (*(t_u32 *)req->pbuf),
 			       wait_option, (int)req->action);
 		/* Status pending, wake up main process */
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 
 		/* Wait for completion */
-		if (wait_option)
+		if (wait_option && wait_option != MOAL_IOCTL_ASYNC)
 			status = woal_wait_ioctl_complete(priv, req,
 							  wait_option);
 		break;
@@ -818,6 +829,96 @@ done:
 	return status;
 }
 
+/**
+ *  @brief Send ioctl request to MLAN without waiting for it
+ *
+ *  If MLAN accepts the request as pending, callback is invoked from the
+ *  main process once the request completes and owns req from then on.
+ *  Any other return status means the request finished (or failed)
+ *  synchronously and callback is never invoked.
+ *
+ *  @param priv          A pointer to moal_private structure
+ *  @param req           A pointer to mlan_ioctl_req buffer
+ *  @param callback      Completion callback, must not sleep
+ *  @param ctx           Context passed to callback
+ *
+ *  @return              MLAN_STATUS_PENDING -- callback will be invoked,
+ *                          otherwise final status of the request
+ */
+mlan_status woal_request_ioctl_async(moal_private *priv, mlan_ioctl_req *req,
+				     moal_ioctl_cb callback, void *ctx)
+{
+	wait_queue *wait = NULL;
+	mlan_status status;
+	unsigned long flags;
+
+	ENTER();
+
+	if (!priv || !priv->phandle || !req || !req->reserved_1 || !callback) {
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
+	}
+
+	wait = (wait_queue *)req->reserved_1;
+	wait->callback = callback;
+	wait->ctx = ctx;
+	status = woal_request_ioctl(priv, req, MOAL_IOCTL_ASYNC);
+	if (status != MLAN_STATUS_PENDING) {
+		spin_lock_irqsave(&priv->phandle->driver_lock, flags);
+		wait->callback = NULL;
+		wait->ctx = NULL;
+		spin_unlock_irqrestore(&priv->phandle->driver_lock, flags);
+	}
+
+	LEAVE();
+	return status;
+}
+
+/**
+ *  @brief Send a batch of ioctl requests to MLAN and wait for all of them
+ *
+ *  All requests are queued before the first wait, so the main process
+ *  can issue the firmware commands back to back instead of waking the
+ *  caller between every round trip. Completed GET requests get the same
+ *  response handling as MOAL_NO_WAIT ones. A request whose status is
+ *  MLAN_STATUS_PENDING on return was not waited for to the end and is
+ *  freed on completion; the caller frees all other requests as usual.
+ *
+ *  @param priv          A pointer to moal_private structure
+ *  @param reqs          Array of mlan_ioctl_req pointers
+ *  @param num           Number of requests
+ *  @param wait_option   MOAL_IOCTL_WAIT or MOAL_IOCTL_WAIT_TIMEOUT
+ *  @param status        Array receiving per-request status
+ *
+ *  @return              MLAN_STATUS_SUCCESS -- all requests succeeded,
+ *                          otherwise MLAN_STATUS_FAILURE
+ */
+mlan_status woal_request_ioctl_batch(moal_private *priv, mlan_ioctl_req **reqs,
+				     int num, t_u8 wait_option,
+				     mlan_status *status)
+{
+	mlan_status ret = MLAN_STATUS_SUCCESS;
+	int i;
+
+	ENTER();
+
+	for (i = 0; i < num; i++)
+		status[i] = woal_request_ioctl(priv, reqs[i], MOAL_IOCTL_ASYNC);
+
+	for (i = 0; i < num; i++) {
+		if (status[i] == MLAN_STATUS_PENDING)
+			status[i] = woal_wait_ioctl_complete(priv, reqs[i],
+							     wait_option);
+		if (status[i] != MLAN_STATUS_SUCCESS)
+			ret = MLAN_STATUS_FAILURE;
+		else if (reqs[i]->action == MLAN_ACT_GET)
+			woal_process_ioctl_resp(priv, reqs[i]);
+	}
+
+	LEAVE();
+	return ret;
+}
+
 /**
  *  @brief Send set MAC address request to MLAN
  *
@@ -2736,7 +2837,7 @@ int woal_send_host_packet(struct net_device *dev, struct ifreq *req)
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		woal_free_mlan_buffer(priv->phandle, pmbuf);
@@ -3935,6 +4036,7 @@ int woal_enable_hs(moal_private *priv)
 #endif
 	pmlan_ds_misc_keep_alive keep_alive = NULL;
 	t_u8 media_connected = MFALSE;
+	t_u64 hs_start_us;
 
 	ENTER();
 
@@ -4079,6 +4181,7 @@ int woal_enable_hs(moal_private *priv)
 		}
 	}
 	/* Enable Host Sleep */
+	hs_start_us = ktime_to_us(ktime_get());
 	handle->hs_activate_wait_q_woken = MFALSE;
 	memset(&hscfg, 0, sizeof(mlan_ds_hs_cfg));
 	hscfg.is_invoke_hostcmd = MTRUE;
@@ -4090,6 +4193,7 @@ int woal_enable_hs(moal_private *priv)
 	timeout = wait_event_timeout(handle->hs_activate_wait_q,
 				     handle->hs_activate_wait_q_woken,
 				     HS_ACTIVE_TIMEOUT);
+	handle->suspend_hs_us = (t_u32)(ktime_to_us(ktime_get()) - hs_start_us);
 	if (IS_SD(handle->card_type)) {
 		sdio_claim_host(((struct sdio_mmc_card *)handle->card)->func);
 	}
@@ -4393,6 +4497,7 @@ int woal_set_drvdbg(moal_private *priv, t_u32 drv_dbg)
 	req->req_id = MLAN_IOCTL_MISC_CFG;
 	req->action = MLAN_ACT_SET;
 	misc->param.drvdbg = drv_dbg;
+	woal_update_dbg_keys(drv_dbg);
 
 	ret = woal_request_ioctl(priv, req, MOAL_IOCTL_WAIT);
 
@@ -4455,6 +4560,74 @@ int woal_reg_rx_mgmt_ind(moal_private *priv, t_u16 action,
 	return ret;
 }
 
+/**
+ *  @brief Completion of an asynchronous mgmt frame forward registration
+ *
+ *  @param priv         A pointer to moal_private structure
+ *  @param req          A pointer to mlan_ioctl_req structure
+ *  @param status       Completion status
+ *  @param ctx          Not used
+ *
+ *  @return             N/A
+ */
+static void woal_reg_rx_mgmt_ind_done(moal_private *priv, mlan_ioctl_req *req,
+				      mlan_status status, void *ctx)
+{
+	mlan_ds_misc_cfg *misc = (mlan_ds_misc_cfg *)req->pbuf;
+
+	if (status != MLAN_STATUS_SUCCESS) {
+		PRINTM(MERROR, "%s: mgmt frame registration 0x%x failed\n",
+		       priv->netdev->name, misc->param.mgmt_subtype_mask);
+		/* Firmware did not take the mask, do not replay it after a
+		 * reset and let the next registration update send it again */
+		if (priv->mgmt_subtype_mask == misc->param.mgmt_subtype_mask)
+			priv->mgmt_subtype_mask = 0;
+	}
+	kfree(req);
+}
+
+/**
+ *  @brief Mgmt frame forward registration without waiting for firmware
+ *
+ *  cfg80211 updates the registration from a context that may not sleep,
+ *  the result is checked on completion.
+ *
+ *  @param priv         A pointer to moal_private structure
+ *  @param mgmt_subtype_mask    Mgmt frame subtype mask
+ *
+ *  @return             0 --success, otherwise fail
+ */
+int woal_reg_rx_mgmt_ind_async(moal_private *priv, t_u32 mgmt_subtype_mask)
+{
+	mlan_ioctl_req *req = NULL;
+	mlan_ds_misc_cfg *misc = NULL;
+	mlan_status status;
+
+	ENTER();
+
+	req = woal_alloc_mlan_ioctl_req(sizeof(mlan_ds_misc_cfg));
+	if (req == NULL) {
+		LEAVE();
+		return -ENOMEM;
+	}
+
+	misc = (mlan_ds_misc_cfg *)req->pbuf;
+	misc->sub_command = MLAN_OID_MISC_RX_MGMT_IND;
+	req->req_id = MLAN_IOCTL_MISC_CFG;
+	req->action = MLAN_ACT_SET;
+	misc->param.mgmt_subtype_mask = mgmt_subtype_mask;
+
+	status = woal_request_ioctl_async(priv, req, woal_reg_rx_mgmt_ind_done,
+					  NULL);
+	if (status != MLAN_STATUS_PENDING) {
+		/* Finished synchronously, the callback is not invoked */
+		woal_reg_rx_mgmt_ind_done(priv, req, status, NULL);
+	}
+
+	LEAVE();
+	return (status == MLAN_STATUS_FAILURE) ? -EFAULT : 0;
+}
+
 /**
  *  @brief Set/Get Transmit beamforming capabilities
  *
@@ -157,6 +157,7 @@ static mlan_callbacks woal_callbacks = {
 	.moal_usleep_range = moal_usleep_range,
 	.moal_get_system_time = moal_get_system_time,
 	.moal_get_boot_ktime = moal_get_boot_ktime,
+	.moal_get_tx_tstamp = moal_get_tx_tstamp,
 	.moal_init_timer = moal_init_timer,
 	.moal_free_timer = moal_free_timer,
 	.moal_start_timer = moal_start_timer,
@@ -168,6 +169,7 @@ static mlan_callbacks woal_callbacks = {
 	.moal_print = moal_print,
 	.moal_print_netintf = moal_print_netintf,
 	.moal_assert = moal_assert,
+	.moal_trace = moal_trace,
 	.moal_hist_data_add = moal_hist_data_add,
 	.moal_updata_peer_signal = moal_updata_peer_signal,
 	.moal_get_host_time_ns = moal_get_host_time_ns,
@@ -700,6 +702,43 @@ BOOLEAN woal_ssid_valid(mlan_802_11_ssid *pssid)
 	return MTRUE;
 }
 
+#if defined(SDIO_SUSPEND_RESUME)
+/**
+ *  @brief Attach the interfaces held detached since resume
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @return         N/A
+ */
+void woal_resume_traffic(moal_handle *handle)
+{
+	int i;
+
+	if (!handle->resume_gated)
+		return;
+	handle->resume_gated = MFALSE;
+	woal_cancel_timer(&handle->resume_gate_timer);
+	handle->resume_ack_us =
+		(t_u32)(ktime_to_us(ktime_get()) - handle->resume_start_us);
+	PRINTM(MCMND, "Resume traffic after %u us\n", handle->resume_ack_us);
+	for (i = 0; i < handle->priv_num; i++)
+		netif_device_attach(handle->priv[i]->netdev);
+}
+
+/**
+ *  @brief Host sleep cancel timeout function
+ *
+ *  @param context  A pointer to context
+ *  @return         N/A
+ */
+static void woal_resume_gate_timer_func(void *context)
+{
+	moal_handle *handle = (moal_handle *)context;
+
+	PRINTM(MERROR, "Host sleep cancel not acked, resume traffic\n");
+	woal_resume_traffic(handle);
+}
+#endif
+
 #if defined(STA_CFG80211) || defined(UAP_CFG80211)
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(2, 6, 39)
 /**
@@ -1292,6 +1331,9 @@ mlan_status woal_init_sw(moal_handle *handle)
 #endif
 
 	init_waitqueue_head(&handle->hs_activate_wait_q);
+	handle->resume_gated = MFALSE;
+	woal_initialize_timer(&handle->resume_gate_timer,
+			      woal_resume_gate_timer_func, handle);
 #endif
 
 	/* Initialize measurement wait queue */
@@ -1434,6 +1476,10 @@ mlan_status woal_init_sw(moal_handle *handle)
 	device.multi_dtim = handle->params.multi_dtim;
 
 	device.inact_tmo = handle->params.inact_tmo;
+	if (handle->params.cmd_cache_ttl > 0)
+		device.cmd_cache_ttl = (t_u32)handle->params.cmd_cache_ttl;
+	if (handle->params.ps_hold_max > 0)
+		device.ps_hold_max = (t_u32)handle->params.ps_hold_max;
 #ifdef UAP_SUPPORT
 	device.uap_max_sta = handle->params.uap_max_sta;
 #endif
@@ -1502,6 +1548,10 @@ void woal_free_moal_handle(moal_handle *handle)
 #else
 	netlink_kernel_release(handle->nl_sk);
 #endif
+	woal_evt_ring_free(handle);
+	woal_trace_ring_free(handle);
+	woal_mmap_ring_free(&handle->mon_ring, "Monitor");
+	woal_mmap_ring_free(&handle->csi_ring, "CSI");
 
 	if (handle->pmlan_adapter) {
 		mlan_unregister(handle->pmlan_adapter);
@@ -1978,6 +2028,39 @@ done:
 	return ret;
 }
 
+/** Number of host commands from a config file sent as one batch */
+#define HOSTCMD_CFG_BATCH 8
+
+/**
+ *    @brief Send the host commands collected from a config file
+ *
+ *    @param handle       MOAL handle
+ *    @param reqs         Array of ioctl requests
+ *    @param num          A pointer to number of requests, reset to 0
+ *
+ *    @return             N/A
+ */
+static void woal_hostcmd_cfg_flush(moal_handle *handle, mlan_ioctl_req **reqs,
+				   int *num)
+{
+	mlan_status status[HOSTCMD_CFG_BATCH];
+	int i;
+
+	if (!*num)
+		return;
+	woal_request_ioctl_batch(handle->priv[0], reqs, *num,
+				 MOAL_IOCTL_WAIT, status);
+	for (i = 0; i < *num; i++) {
+		if (status[i] != MLAN_STATUS_SUCCESS)
+			PRINTM(MERROR, "hostcmd cfg: cmd %d failed status=%d\n",
+			       i, status[i]);
+		if (status[i] != MLAN_STATUS_PENDING)
+			kfree(reqs[i]);
+		reqs[i] = NULL;
+	}
+	*num = 0;
+}
+
 /**
  *    @brief WOAL parse ASCII format raw data to hex format
  *
@@ -1998,6 +2081,10 @@ static t_u32 woal_process_hostcmd_cfg(moal_handle *handle, t_u8 *data,
 	t_u32 cmd_len = 0;
 	t_u8 start_raw = MFALSE;
 	gfp_t flag;
+	mlan_ioctl_req *reqs[HOSTCMD_CFG_BATCH];
+	mlan_ioctl_req *req = NULL;
+	mlan_ds_misc_cfg *misc_cfg = NULL;
+	int num_req = 0;
 
 #define CMD_STR "MRVL_CMDhostcmd"
 #define CMD_BUF_LEN 2048
@@ -2034,8 +2121,37 @@ static t_u32 woal_process_hostcmd_cfg(moal_handle *handle, t_u8 *data,
 					CMD_BUF_LEN - strlen(CMD_STR));
 
 			/* fire the hostcommand from here */
-			woal_priv_hostcmd(handle->priv[0], buf, CMD_BUF_LEN,
-					  wait_option);
+			if (wait_option == MOAL_NO_WAIT) {
+				woal_priv_hostcmd(handle->priv[0], buf,
+						  CMD_BUF_LEN, wait_option);
+			} else if (woal_le16_to_cpu((t_u16)cmd_len) <=
+				   MRVDRV_SIZE_OF_CMD_BUFFER) {
+				/* Queue it, sent together with the next
+				 * ones */
+				req = woal_alloc_mlan_ioctl_req(
+					sizeof(mlan_ds_misc_cfg));
+				if (req) {
+					misc_cfg = (mlan_ds_misc_cfg *)req->pbuf;
+					misc_cfg->sub_command =
+						MLAN_OID_MISC_HOST_CMD;
+					req->req_id = MLAN_IOCTL_MISC_CFG;
+					req->action = MLAN_ACT_SET;
+					misc_cfg->param.hostcmd.len =
+						woal_le16_to_cpu(
+							(t_u16)cmd_len);
+					moal_memcpy_ext(
+						handle,
+						misc_cfg->param.hostcmd.cmd,
+						buf + strlen(CMD_STR) +
+							sizeof(t_u32),
+						misc_cfg->param.hostcmd.len,
+						MRVDRV_SIZE_OF_CMD_BUFFER);
+					reqs[num_req++] = req;
+				}
+				if (num_req == HOSTCMD_CFG_BATCH)
+					woal_hostcmd_cfg_flush(handle, reqs,
+							       &num_req);
+			}
 			memset(buf + strlen(CMD_STR), 0,
 			       CMD_BUF_LEN - strlen(CMD_STR));
 			ptr = buf + strlen(CMD_STR) + sizeof(t_u32);
@@ -2071,6 +2187,7 @@ static t_u32 woal_process_hostcmd_cfg(moal_handle *handle, t_u8 *data,
 			}
 		}
 	}
+	woal_hostcmd_cfg_flush(handle, reqs, &num_req);
 
 done:
 	kfree(buf);
@@ -2674,7 +2791,13 @@ static mlan_status woal_req_dpd_data(moal_handle *handle,
 
 	if (dpd_data_cfg && strncmp(dpd_data_cfg, "none", strlen("none"))) {
 		PRINTM(MMSG, "Request firmware: %s\n", dpd_data_cfg);
-		if (req_fw_nowait) {
+		if (handle->init_data_prefetch) {
+			PRINTM(MINFO, "DPD data requested during FW download\n");
+			if (test_bit(INIT_DATA_DPD, &handle->init_data_err)) {
+				ret = MLAN_STATUS_FAILURE;
+				goto done;
+			}
+		} else if (req_fw_nowait) {
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0)
 			if ((request_firmware_nowait(
 				    THIS_MODULE, FW_ACTION_UEVENT, dpd_data_cfg,
@@ -2754,7 +2877,13 @@ static mlan_status woal_req_txpwr_data(moal_handle *handle,
 	if (txpwrlimit_cfg && strncmp(txpwrlimit_cfg, "none", strlen("none"))) {
 		PRINTM(MMSG, "Download txpwrlimit_cfg=%s\n",
 		       handle->params.txpwrlimit_cfg);
-		if (req_fw_nowait) {
+		if (handle->init_data_prefetch) {
+			PRINTM(MINFO, "txpwrlimit requested during FW download\n");
+			if (test_bit(INIT_DATA_TXPWR, &handle->init_data_err)) {
+				ret = MLAN_STATUS_FAILURE;
+				goto done;
+			}
+		} else if (req_fw_nowait) {
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0)
 			if ((request_firmware_nowait(
 				    THIS_MODULE, FW_ACTION_UEVENT,
@@ -2837,7 +2966,13 @@ static mlan_status woal_req_cal_data(moal_handle *handle,
 	/** Cal data request */
 	if (cal_data_cfg && strncmp(cal_data_cfg, "none", strlen("none"))) {
 		PRINTM(MMSG, "Request firmware: %s\n", cal_data_cfg);
-		if (req_fw_nowait) {
+		if (handle->init_data_prefetch) {
+			PRINTM(MINFO, "Cal data requested during FW download\n");
+			if (test_bit(INIT_DATA_CAL, &handle->init_data_err)) {
+				ret = MLAN_STATUS_FAILURE;
+				goto done;
+			}
+		} else if (req_fw_nowait) {
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0)
 			if ((request_firmware_nowait(
 				    THIS_MODULE, FW_ACTION_UEVENT, cal_data_cfg,
@@ -2901,6 +3036,197 @@ done:
 	return ret;
 }
 
+/**
+ * @brief Account one prefetched init data file as delivered
+ *
+ * @param handle    A pointer to moal_handle structure
+ *
+ * @return        N/A
+ */
+static void woal_init_data_done(moal_handle *handle)
+{
+	if (atomic_dec_and_test(&handle->init_data_pending))
+		wake_up(&handle->init_user_conf_wait_q);
+}
+
+/**
+ * @brief Prefetched dpd data callback
+ *        This function is invoked by request_firmware_nowait system call
+ *
+ * @param firmware  A pointer to firmware image
+ * @param context   A pointer to moal_handle structure
+ *
+ * @return          N/A
+ */
+static void woal_prefetch_dpd_callback(const struct firmware *firmware,
+				       void *context)
+{
+	moal_handle *handle = (moal_handle *)context;
+
+	/* A missing DPD file is not an error, as with request_firmware() */
+	if (firmware)
+		handle->dpd_data = firmware;
+	else
+		PRINTM(MERROR, "DPD data request firmware failed\n");
+	woal_init_data_done(handle);
+}
+
+/**
+ * @brief Prefetched txpwrlimit data callback
+ *        This function is invoked by request_firmware_nowait system call
+ *
+ * @param firmware  A pointer to firmware image
+ * @param context   A pointer to moal_handle structure
+ *
+ * @return          N/A
+ */
+static void woal_prefetch_txpwr_callback(const struct firmware *firmware,
+					 void *context)
+{
+	moal_handle *handle = (moal_handle *)context;
+
+	if (firmware) {
+		handle->txpwr_data = firmware;
+	} else {
+		PRINTM(MERROR, "txpwrlimit data request firmware failed\n");
+		set_bit(INIT_DATA_TXPWR, &handle->init_data_err);
+	}
+	woal_init_data_done(handle);
+}
+
+/**
+ * @brief Prefetched cal data callback
+ *        This function is invoked by request_firmware_nowait system call
+ *
+ * @param firmware  A pointer to firmware image
+ * @param context   A pointer to moal_handle structure
+ *
+ * @return          N/A
+ */
+static void woal_prefetch_cal_callback(const struct firmware *firmware,
+				       void *context)
+{
+	moal_handle *handle = (moal_handle *)context;
+
+	if (firmware) {
+		handle->user_data = firmware;
+	} else {
+		PRINTM(MERROR, "Cal data request firmware failed\n");
+		set_bit(INIT_DATA_CAL, &handle->init_data_err);
+	}
+	woal_init_data_done(handle);
+}
+
+/**
+ * @brief Request one init data file without waiting for it
+ *
+ * @param handle    A pointer to moal_handle structure
+ * @param name      File name, "none" or NULL to skip
+ * @param file      INIT_DATA_* number of the file
+ * @param cont      Callback invoked with the file
+ *
+ * @return        N/A
+ */
+static void woal_prefetch_one(moal_handle *handle, char *name, t_u8 file,
+			      void (*cont)(const struct firmware *, void *))
+{
+	int err;
+
+	if (!name || !strncmp(name, "none", strlen("none")))
+		return;
+	atomic_inc(&handle->init_data_pending);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 14, 0)
+	err = request_firmware_nowait(THIS_MODULE, FW_ACTION_UEVENT, name,
+				      handle->hotplug_device, GFP_KERNEL,
+				      handle, cont);
+#else
+#if LINUX_VERSION_CODE > KERNEL_VERSION(2, 6, 32)
+	err = request_firmware_nowait(THIS_MODULE, FW_ACTION_HOTPLUG, name,
+				      handle->hotplug_device, GFP_KERNEL,
+				      handle, cont);
+#else
+#if LINUX_VERSION_CODE > KERNEL_VERSION(2, 6, 13)
+	err = request_firmware_nowait(THIS_MODULE, FW_ACTION_HOTPLUG, name,
+				      handle->hotplug_device, handle, cont);
+#else
+	err = request_firmware_nowait(THIS_MODULE, name,
+				      handle->hotplug_device, handle, cont);
+#endif
+#endif
+#endif
+	if (err < 0) {
+		PRINTM(MERROR, "%s request_firmware_nowait() failed\n", name);
+		set_bit(file, &handle->init_data_err);
+		atomic_dec(&handle->init_data_pending);
+	}
+}
+
+/**
+ * @brief Request dpd, txpwrlimit and cal data in parallel
+ *
+ * The files are loaded while the firmware image downloads, instead
+ * of one after another once it is active.
+ *
+ * @param handle    A pointer to moal_handle structure
+ *
+ * @return        N/A
+ */
+static void woal_prefetch_init_data(moal_handle *handle)
+{
+	ENTER();
+
+	if (!moal_extflg_isset(handle, EXT_REQ_FW_NOWAIT)) {
+		LEAVE();
+		return;
+	}
+	atomic_set(&handle->init_data_pending, 0);
+	handle->init_data_err = 0;
+	woal_prefetch_one(handle, handle->params.dpd_data_cfg, INIT_DATA_DPD,
+			  woal_prefetch_dpd_callback);
+	woal_prefetch_one(handle, handle->params.txpwrlimit_cfg,
+			  INIT_DATA_TXPWR, woal_prefetch_txpwr_callback);
+	woal_prefetch_one(handle, handle->params.cal_data_cfg, INIT_DATA_CAL,
+			  woal_prefetch_cal_callback);
+	handle->init_data_prefetch = MTRUE;
+	LEAVE();
+}
+
+/**
+ * @brief Wait for the files requested by woal_prefetch_init_data
+ *
+ * @param handle    A pointer to moal_handle structure
+ *
+ * @return        N/A
+ */
+static void woal_wait_init_data(moal_handle *handle)
+{
+	if (!handle->init_data_prefetch)
+		return;
+	/* Callbacks always arrive and write into handle; do not bail out
+	 * early */
+	wait_event(handle->init_user_conf_wait_q,
+		   !atomic_read(&handle->init_data_pending));
+}
+
+/**
+ * @brief Record the duration of a boot phase which ends now
+ *
+ * @param handle    A pointer to moal_handle structure
+ * @param phase     Boot phase
+ *
+ * @return        N/A
+ */
+static void woal_boot_phase_end(moal_handle *handle, t_u8 phase)
+{
+	t_u64 now = ktime_to_ns(ktime_get());
+
+	if (handle->fw_reload)
+		return;
+	handle->boot_phase[phase] =
+		(t_u32)moal_do_div(now - handle->boot_mark, 1000);
+	handle->boot_mark = now;
+}
+
 /**
  * @brief Download and Initialize firmware DPC
  *
@@ -2916,6 +3242,8 @@ static mlan_status woal_init_fw_dpc(moal_handle *handle)
 
 	ENTER();
 
+	woal_boot_phase_end(handle, BOOT_PHASE_FW_REQUEST);
+	woal_prefetch_init_data(handle);
 	if (handle->firmware) {
 		memset(&fw, 0, sizeof(mlan_fw_image));
 		fw.pfw_buf = (t_u8 *)handle->firmware->data;
@@ -2936,6 +3264,10 @@ static mlan_status woal_init_fw_dpc(moal_handle *handle)
 			goto done;
 		}
 		wifi_status = 0;
+		woal_boot_phase_end(handle, BOOT_PHASE_FW_READY);
+		handle->boot_phase[BOOT_PHASE_FW_DNLD] = fw.dnld_time;
+		if (handle->boot_phase[BOOT_PHASE_FW_READY] > fw.dnld_time)
+			handle->boot_phase[BOOT_PHASE_FW_READY] -= fw.dnld_time;
 
 		PRINTM(MMSG, "WLAN FW is active\n");
 		if (!handle->fw_reload)
@@ -2948,6 +3280,7 @@ static mlan_status woal_init_fw_dpc(moal_handle *handle)
 	/** data request */
 	memset(&param, 0, sizeof(mlan_init_param));
 
+	woal_wait_init_data(handle);
 	ret = woal_req_dpd_data(handle, &param);
 	if (ret != MLAN_STATUS_SUCCESS)
 		goto done;
@@ -2959,10 +3292,12 @@ static mlan_status woal_init_fw_dpc(moal_handle *handle)
 	ret = woal_req_cal_data(handle, &param);
 	if (ret != MLAN_STATUS_SUCCESS)
 		goto done;
+	woal_boot_phase_end(handle, BOOT_PHASE_INIT_DATA);
 
 	handle->hardware_status = HardwareStatusFwReady;
 	ret = mlan_set_init_param(handle->pmlan_adapter, &param);
 	if (handle->fw_reload) {
+		handle->init_data_prefetch = MFALSE;
 		LEAVE();
 		return ret;
 	}
@@ -2986,6 +3321,11 @@ static mlan_status woal_init_fw_dpc(moal_handle *handle)
 	}
 	ret = MLAN_STATUS_SUCCESS;
 done:
+	if (ret == MLAN_STATUS_SUCCESS)
+		woal_boot_phase_end(handle, BOOT_PHASE_INIT_CMD);
+	/* Download failure skips the wait above */
+	woal_wait_init_data(handle);
+	handle->init_data_prefetch = MFALSE;
 	if (handle->dpd_data) {
 		release_firmware(handle->dpd_data);
 		handle->dpd_data = NULL;
@@ -3043,6 +3383,16 @@ static mlan_status woal_request_fw_dpc(moal_handle *handle,
 	ret = woal_add_card_dpc(handle);
 	if (ret)
 		goto done;
+	woal_boot_phase_end(handle, BOOT_PHASE_INTF_UP);
+	PRINTM(MMSG,
+	       "wlan: boot probe=%u fw_req=%u dnld=%u ready=%u data=%u init=%u intf=%u us\n",
+	       handle->boot_phase[BOOT_PHASE_PROBE],
+	       handle->boot_phase[BOOT_PHASE_FW_REQUEST],
+	       handle->boot_phase[BOOT_PHASE_FW_DNLD],
+	       handle->boot_phase[BOOT_PHASE_FW_READY],
+	       handle->boot_phase[BOOT_PHASE_INIT_DATA],
+	       handle->boot_phase[BOOT_PHASE_INIT_CMD],
+	       handle->boot_phase[BOOT_PHASE_INTF_UP]);
 
 done:
 	/* We should hold the semaphore until callback finishes execution */
@@ -3165,6 +3515,7 @@ mlan_status woal_init_fw(moal_handle *handle)
 
 	ENTER();
 
+	woal_boot_phase_end(handle, BOOT_PHASE_PROBE);
 	woal_get_monotonic_time(&handle->req_fw_time);
 	ret = woal_request_fw(handle);
 	if (ret == MLAN_STATUS_FAILURE) {
@@ -3186,7 +3537,6 @@ mlan_status woal_init_fw(moal_handle *handle)
 void woal_fill_mlan_buffer(moal_private *priv, mlan_buffer *pmbuf,
 			   struct sk_buff *skb)
 {
-	wifi_timeval tstamp;
 	struct ethhdr *eth;
 	dot11_txcontrol *txcontrol;
 	t_u8 tx_ctrl_flag = MFALSE;
@@ -3252,23 +3602,18 @@ void woal_fill_mlan_buffer(moal_private *priv, mlan_buffer *pmbuf,
 		}
 	}
 
-	/* Record the current time the packet was queued; used to determine
-	 *   the amount of time the packet was queued in the driver before it
-	 *   was sent to the firmware.  The delay is then sent along with the
-	 *   packet to the firmware for aggregate delay calculation for stats
-	 *   and MSDU lifetime expiry.
-	 */
-	woal_get_monotonic_time(&tstamp);
-	skb->tstamp = ktime_get_real();
-
 	pmbuf->pdesc = skb;
 	pmbuf->pbuf = skb->head + sizeof(mlan_buffer);
 	pmbuf->data_offset = skb->data - (skb->head + sizeof(mlan_buffer));
 	pmbuf->data_len = skb->len;
 	pmbuf->priority = skb->priority;
 	pmbuf->buf_type = 0;
-	pmbuf->in_ts_sec = tstamp.time_sec;
-	pmbuf->in_ts_usec = tstamp.time_usec;
+	/* Record the time the packet was queued only when packet fate or
+	 *   latency trace needs it; mlan stamps on its own for admission
+	 *   control.
+	 */
+	if (woal_tx_tstamp_needed(priv))
+		moal_get_tx_tstamp(priv->phandle, &pmbuf->in_ts_nsec);
 
 	LEAVE();
 	return;
@@ -4043,6 +4388,11 @@ moal_private *woal_add_interface(moal_handle *handle, t_u8 bss_index,
 		goto error;
 	}
 	MLAN_INIT_WORK(&priv->mclist_work, woal_mclist_work_queue);
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+	woal_cfg80211_csi_dump_init(priv);
+#endif
+#endif
 
 	INIT_DELAYED_WORK(&priv->scan_deferred_work,
 			  woal_scan_deferred_work_queue);
@@ -4260,6 +4610,7 @@ void woal_remove_interface(moal_handle *handle, t_u8 bss_index)
 #endif
 #if defined(STA_CFG80211) || defined(UAP_CFG80211)
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+	woal_cfg80211_csi_dump_stop(priv);
 	if (GET_BSS_ROLE(priv) == MLAN_BSS_ROLE_STA ||
 	    GET_BSS_ROLE(priv) == MLAN_BSS_ROLE_UAP)
 		woal_deinit_wifi_hal(priv);
@@ -4521,8 +4872,10 @@ void woal_flush_workqueue(moal_handle *handle)
 	ENTER();
 
 	/* Terminate main workqueue */
+	woal_flush_worker(&handle->main_thread);
 	if (handle->workqueue)
 		flush_workqueue(handle->workqueue);
+	woal_flush_worker(&handle->rx_thread);
 	if (handle->rx_workqueue)
 		flush_workqueue(handle->rx_workqueue);
 	if (handle->evt_workqueue)
@@ -4543,11 +4896,14 @@ void woal_terminate_workqueue(moal_handle *handle)
 	ENTER();
 
 	/* Terminate main workqueue */
+	woal_stop_worker(&handle->main_thread);
 	if (handle->workqueue) {
 		flush_workqueue(handle->workqueue);
 		destroy_workqueue(handle->workqueue);
 		handle->workqueue = NULL;
 	}
+	woal_tx_stage_free(handle);
+	woal_stop_worker(&handle->rx_thread);
 	if (handle->rx_workqueue) {
 		flush_workqueue(handle->rx_workqueue);
 		destroy_workqueue(handle->rx_workqueue);
@@ -5668,8 +6024,7 @@ static void woal_tcp_ack_timer_func(void *context)
 			    MAX_TX_PENDING)
 				woal_stop_queue(priv->netdev);
 #endif /*#if LINUX_VERSION_CODE > KERNEL_VERSION(2,6,29)*/
-			queue_work(priv->phandle->workqueue,
-				   &priv->phandle->main_work);
+			woal_queue_main_work(priv->phandle);
 			break;
 		case MLAN_STATUS_SUCCESS:
 			priv->stats.tx_packets++;
@@ -5730,7 +6085,7 @@ static void woal_send_tcp_ack(moal_private *priv, struct tcp_sess *tcp_session)
 		if (atomic_read(&priv->phandle->tx_pending) >= MAX_TX_PENDING)
 			woal_stop_queue(priv->netdev);
 #endif /*#if LINUX_VERSION_CODE > KERNEL_VERSION(2,6,29)*/
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		priv->stats.tx_packets++;
@@ -5899,6 +6254,114 @@ done:
 	return ret;
 }
 
+/**
+ *  @brief This function stages a TX packet
+ *
+ *  The packet is pushed lock-free to the staging list of its TX queue,
+ *  so packets of one flow keep their order whichever CPU sends them.
+ *  The main work is kicked only once until it drains the staging lists.
+ *
+ *  @param priv    A pointer to moal_private structure
+ *  @param pmbuf   A pointer to mlan_buffer
+ *  @param index   TX queue index
+ *
+ *  @return        N/A
+ */
+static void woal_tx_stage_packet(moal_private *priv, mlan_buffer *pmbuf,
+				 t_u32 index)
+{
+	moal_handle *handle = priv->phandle;
+
+	/* Account the packet before the drain can complete it */
+	if (is_zero_timeval(handle->tx_time_start))
+		woal_get_monotonic_time(&handle->tx_time_start);
+	atomic_inc(&handle->tx_pending);
+#if LINUX_VERSION_CODE > KERNEL_VERSION(2, 6, 29)
+	atomic_inc(&priv->wmm_tx_pending[index]);
+	if (atomic_read(&priv->wmm_tx_pending[index]) >= MAX_TX_PENDING) {
+		struct netdev_queue *txq =
+			netdev_get_tx_queue(priv->netdev, index);
+		netif_tx_stop_queue(txq);
+		PRINTM(MINFO, "Stop Kernel Queue : %d\n", index);
+	}
+#else
+	if (atomic_read(&handle->tx_pending) >= MAX_TX_PENDING)
+		woal_stop_queue(priv->netdev);
+#endif /*#if LINUX_VERSION_CODE > KERNEL_VERSION(2,6,29)*/
+
+	llist_add(woal_tx_stage_node(pmbuf), &handle->tx_stage[index]);
+	atomic_inc(&handle->tx_stage_pkts);
+
+	if (!atomic_xchg(&handle->tx_stage_kick, 1)) {
+		atomic_inc(&handle->tx_stage_kicks);
+		woal_queue_main_work(handle);
+	}
+}
+
+/**
+ *  @brief This function drains the TX staging lists to MLAN
+ *
+ *  @param handle  A pointer to moal_handle structure
+ *
+ *  @return        N/A
+ */
+static void woal_tx_stage_drain(moal_handle *handle)
+{
+	struct llist_node *node, *next;
+	pmlan_buffer pmbuf;
+	mlan_status status;
+	int i;
+
+	/* Re-arm the kick before draining so later packets queue the work */
+	atomic_set(&handle->tx_stage_kick, 0);
+	for (i = 0; i < TX_STAGE_NUM; i++) {
+		/* Restore arrival order */
+		node = llist_reverse_order(llist_del_all(&handle->tx_stage[i]));
+		while (node) {
+			next = node->next;
+			pmbuf = woal_tx_stage_buf(node);
+			pmbuf->pnext = NULL;
+			status = mlan_send_packet(handle->pmlan_adapter, pmbuf);
+			if (status != MLAN_STATUS_PENDING)
+				moal_send_packet_complete(handle, pmbuf,
+							  status);
+			node = next;
+		}
+	}
+	handle->tx_stage_drains++;
+}
+
+/**
+ *  @brief This function drops the packets in the TX staging lists
+ *
+ *  The packets complete as failed, which also releases the per queue
+ *  pending counts they hold and wakes stopped queues.
+ *
+ *  @param handle  A pointer to moal_handle structure
+ *
+ *  @return        N/A
+ */
+void woal_tx_stage_free(moal_handle *handle)
+{
+	struct llist_node *node, *next;
+	pmlan_buffer pmbuf;
+	int i;
+
+	/* Re-arm the kick so packets staged later are dropped as well */
+	atomic_set(&handle->tx_stage_kick, 0);
+	for (i = 0; i < TX_STAGE_NUM; i++) {
+		node = llist_del_all(&handle->tx_stage[i]);
+		while (node) {
+			next = node->next;
+			pmbuf = woal_tx_stage_buf(node);
+			pmbuf->pnext = NULL;
+			moal_send_packet_complete(handle, pmbuf,
+						  MLAN_STATUS_FAILURE);
+			node = next;
+		}
+	}
+}
+
 /**
  *  @brief This function handles packet transmission
  *
@@ -5912,9 +6375,7 @@ static int woal_start_xmit(moal_private *priv, struct sk_buff *skb)
 	mlan_buffer *pmbuf = NULL;
 	mlan_status status;
 	struct sk_buff *new_skb = NULL;
-#if LINUX_VERSION_CODE > KERNEL_VERSION(2, 6, 29)
 	t_u32 index = 0;
-#endif
 	int ret = 0;
 
 	ENTER();
@@ -5975,14 +6436,15 @@ static int woal_start_xmit(moal_private *priv, struct sk_buff *skb)
 	index = skb_get_queue_mapping(skb);
 #endif
 
+	if (moal_extflg_isset(priv->phandle, EXT_TX_STAGE)) {
+		woal_tx_stage_packet(priv, pmbuf, index);
+		goto done;
+	}
 	status = mlan_send_packet(priv->phandle->pmlan_adapter, pmbuf);
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		if (is_zero_timeval(priv->phandle->tx_time_start)) {
-			priv->phandle->tx_time_start.time_sec =
-				pmbuf->in_ts_sec;
-			priv->phandle->tx_time_start.time_usec =
-				pmbuf->in_ts_usec;
+			woal_get_monotonic_time(&priv->phandle->tx_time_start);
 			PRINTM(MINFO, "%s : start_timeval=%d:%d \n", __func__,
 			       priv->phandle->tx_time_start.time_sec,
 			       priv->phandle->tx_time_start.time_usec);
@@ -6004,8 +6466,7 @@ static int woal_start_xmit(moal_private *priv, struct sk_buff *skb)
 #endif /*#if LINUX_VERSION_CODE > KERNEL_VERSION(2,6,29)*/
 
 		if (!mlan_is_main_process_running(priv->phandle->pmlan_adapter))
-			queue_work(priv->phandle->workqueue,
-				   &priv->phandle->main_work);
+			woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		priv->stats.tx_packets++;
@@ -6741,60 +7202,430 @@ static int woal_get_card_info(moal_handle *phandle)
 #endif /* STA_SUPPORT */
 
 /**
- *  @brief This function handles events generated by firmware
+ *  @brief This function allocates the event ring
  *
- *  @param priv     A pointer to moal_private structure
- *  @param payload  A pointer to payload buffer
- *  @param len      Length of the payload
- *  @return         MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ *  @param handle   A pointer to moal_handle structure
+ *
+ *  @return         N/A
  */
-mlan_status woal_broadcast_event(moal_private *priv, t_u8 *payload, t_u32 len)
+void woal_evt_ring_init(moal_handle *handle)
 {
-	mlan_status ret = MLAN_STATUS_SUCCESS;
-	struct sk_buff *skb = NULL;
-	struct nlmsghdr *nlh = NULL;
-	moal_handle *handle = priv->phandle;
-	struct net_device *netdev = priv->netdev;
-	struct sock *sk = handle->nl_sk;
+	moal_evt_ring *ring = &handle->evt_ring;
+	t_u32 size;
 
 	ENTER();
+	spin_lock_init(&ring->lock);
+	MOAL_INIT_SEMAPHORE(&ring->read_sem);
+	init_waitqueue_head(&ring->wait_q);
+	if (handle->params.evt_ring <= 0)
+		goto done;
 
-	/* interface name to be prepended to event */
-	if ((len + IFNAMSIZ) > NL_MAX_PAYLOAD
-#ifdef WIFI_DIRECT_SUPPORT
-				       * 2
-#endif
-	) {
-		PRINTM(MERROR, "event size is too big, len=%d\n", (int)len);
-		ret = MLAN_STATUS_FAILURE;
+	size = MIN(handle->params.evt_ring, EVT_RING_MAX_KB) * 1024;
+	ring->size = 1024;
+	while (ring->size < size)
+		ring->size <<= 1;
+	/* Readers copy whole padded records to user space */
+	ring->buf = vzalloc(ring->size);
+	if (!ring->buf) {
+		PRINTM(MERROR, "Failed to allocate event ring\n");
+		ring->size = 0;
 		goto done;
 	}
-	if (sk) {
-		/* Allocate skb */
-#ifdef WIFI_DIRECT_SUPPORT
-		if ((len + IFNAMSIZ) > NL_MAX_PAYLOAD) {
-			skb = alloc_skb(NLMSG_SPACE(NL_MAX_PAYLOAD * 2),
-					GFP_ATOMIC);
-			if (!skb) {
-				PRINTM(MERROR,
-				       "Could not allocate skb for netlink\n");
-				ret = MLAN_STATUS_FAILURE;
-				goto done;
-			}
-		} else {
+	PRINTM(MMSG, "Event ring: %u bytes\n", ring->size);
+done:
+	LEAVE();
+}
+
+/**
+ *  @brief This function frees the event ring
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *
+ *  @return         N/A
+ */
+void woal_evt_ring_free(moal_handle *handle)
+{
+	moal_evt_ring *ring = &handle->evt_ring;
+
+	ENTER();
+	if (ring->buf) {
+		PRINTM(MMSG, "Event ring: seq=%u lost=%u\n", ring->seq,
+		       ring->total_lost);
+		vfree(ring->buf);
+		ring->buf = NULL;
+		ring->size = 0;
+	}
+	LEAVE();
+}
+
+/**
+ *  @brief This function allocates the per-CPU trace ring
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *
+ *  @return         N/A
+ */
+void woal_trace_ring_init(moal_handle *handle)
+{
+	t_u32 num = 1;
+	int cpu;
+
+	ENTER();
+	if (handle->params.trace_ring <= 0)
+		goto done;
+
+	while (num < MIN(handle->params.trace_ring, TRACE_RING_MAX_REC))
+		num <<= 1;
+	handle->trace_ring = (moal_trace_ring __percpu *)__alloc_percpu(
+		sizeof(moal_trace_ring) + num * sizeof(moal_trace_rec),
+		sizeof(t_u64));
+	if (!handle->trace_ring) {
+		PRINTM(MERROR, "Failed to allocate trace ring\n");
+		goto done;
+	}
+	for_each_possible_cpu (cpu)
+		per_cpu_ptr(handle->trace_ring, cpu)->head = 0;
+	handle->trace_ring_size = num;
+	PRINTM(MMSG, "Trace ring: %u records per CPU\n", num);
+done:
+	LEAVE();
+}
+
+/**
+ *  @brief This function frees the per-CPU trace ring
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *
+ *  @return         N/A
+ */
+void woal_trace_ring_free(moal_handle *handle)
+{
+	ENTER();
+	if (handle->trace_ring) {
+		free_percpu(handle->trace_ring);
+		handle->trace_ring = NULL;
+		handle->trace_ring_size = 0;
+	}
+	LEAVE();
+}
+
+/**
+ *  @brief This function allocates an mmap ring, a control page followed
+ *  by the data area, both mappable by user space
+ *
+ *  @param ring     A pointer to moal_mmap_ring structure
+ *  @param size_kb  Size of the data area in KB, 0: disabled
+ *  @param name     Ring name for the log
+ *
+ *  @return         N/A
+ */
+void woal_mmap_ring_init(moal_mmap_ring *ring, int size_kb, char *name)
+{
+	t_u32 size;
+
+	ENTER();
+	spin_lock_init(&ring->lock);
+	init_waitqueue_head(&ring->wait_q);
+	atomic_set(&ring->users, 0);
+	if (size_kb <= 0)
+		goto done;
+
+	size = MIN(size_kb, MMAP_RING_MAX_KB) * 1024;
+	ring->size = PAGE_SIZE;
+	while (ring->size < size)
+		ring->size <<= 1;
+	ring->ctrl = vmalloc_user(PAGE_SIZE + ring->size);
+	if (!ring->ctrl) {
+		PRINTM(MERROR, "Failed to allocate %s ring\n", name);
+		ring->size = 0;
+		goto done;
+	}
+	ring->data = (t_u8 *)ring->ctrl + PAGE_SIZE;
+	ring->ctrl->size = ring->size;
+	PRINTM(MMSG, "%s ring: %u bytes\n", name, ring->size);
+done:
+	LEAVE();
+}
+
+/**
+ *  @brief This function frees an mmap ring. Pages still mapped by user
+ *  space are released on unmap.
+ *
+ *  @param ring     A pointer to moal_mmap_ring structure
+ *  @param name     Ring name for the log
+ *
+ *  @return         N/A
+ */
+void woal_mmap_ring_free(moal_mmap_ring *ring, char *name)
+{
+	ENTER();
+	if (ring->ctrl) {
+		PRINTM(MMSG, "%s ring: packets=%u dropped=%u\n", name,
+		       ring->ctrl->packets, ring->ctrl->dropped);
+		vfree(ring->ctrl);
+		ring->ctrl = NULL;
+		ring->data = NULL;
+		ring->size = 0;
+	}
+	LEAVE();
+}
+
+/**
+ *  @brief This function reserves a record in an mmap ring. On success
+ *  the ring lock is held until woal_mmap_ring_commit, the caller fills
+ *  the time stamp and the payload following the header. A full ring
+ *  drops the record, its sequence number is skipped.
+ *
+ *  @param ring     A pointer to moal_mmap_ring structure
+ *  @param len      Length of the payload
+ *  @param flags    Saved interrupt flags, passed to commit
+ *
+ *  @return         Record header, NULL if the ring is full
+ */
+moal_mmap_rec *woal_mmap_ring_reserve(moal_mmap_ring *ring, t_u32 len,
+				      unsigned long *flags)
+{
+	moal_mmap_ring_ctrl *ctrl = ring->ctrl;
+	moal_mmap_rec *rec;
+	t_u32 rec_len = ALIGN_SZ(sizeof(*rec) + len, MMAP_REC_ALIGN);
+	t_u32 used, off, pad;
+
+	spin_lock_irqsave(&ring->lock, *flags);
+	/* Pairs with the reader's barrier before it advances rp */
+	smp_mb();
+	used = ring->wp - ctrl->rp;
+	off = ring->wp & (ring->size - 1);
+	/* Records do not wrap, pad to the end of the data area instead */
+	pad = (rec_len > ring->size - off) ? ring->size - off : 0;
+	if (len > 0xffff || used > ring->size ||
+	    rec_len + pad > ring->size - used) {
+		ring->seq++;
+		ctrl->dropped++;
+		spin_unlock_irqrestore(&ring->lock, *flags);
+		return NULL;
+	}
+	if (pad) {
+		rec = (moal_mmap_rec *)(ring->data + off);
+		memset(rec, 0, sizeof(*rec));
+		rec->flags = MMAP_REC_PAD;
+		ring->wp += pad;
+		off = 0;
+	}
+	rec = (moal_mmap_rec *)(ring->data + off);
+	rec->len = len;
+	rec->flags = 0;
+	rec->seq = ring->seq++;
+	return rec;
+}
+
+/**
+ *  @brief This function publishes the record reserved last and wakes
+ *  the reader once wake_batch records are queued or the ring is half
+ *  full
+ *
+ *  @param ring     A pointer to moal_mmap_ring structure
+ *  @param flags    Interrupt flags saved by reserve
+ *
+ *  @return         N/A
+ */
+void woal_mmap_ring_commit(moal_mmap_ring *ring, unsigned long flags)
+{
+	moal_mmap_ring_ctrl *ctrl = ring->ctrl;
+	moal_mmap_rec *rec =
+		(moal_mmap_rec *)(ring->data + (ring->wp & (ring->size - 1)));
+	t_u32 batch = ctrl->wake_batch;
+	t_u8 wake = MFALSE;
+
+	ring->wp += ALIGN_SZ(sizeof(*rec) + rec->len, MMAP_REC_ALIGN);
+	/* Publish the record before the write offset */
+	smp_wmb();
+	ctrl->wp = ring->wp;
+	ctrl->packets++;
+	if (++ring->pending >= batch ||
+	    ring->wp - ctrl->rp >= ring->size / 2) {
+		ring->pending = 0;
+		wake = MTRUE;
+	}
+	spin_unlock_irqrestore(&ring->lock, flags);
+
+	if (wake)
+		wake_up_interruptible(&ring->wait_q);
+}
+
+#ifdef DEBUG_LEVEL1
+/**
+ *  @brief This function switches the debug static keys to match
+ *  the debug level
+ *
+ *  @param level    Debug level
+ *
+ *  @return         N/A
+ */
+void woal_update_dbg_keys(t_u32 level)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 3, 0)
+	if (level & MTRACE_D)
+		static_branch_enable(&woal_trace_key);
+	else
+		static_branch_disable(&woal_trace_key);
+	if (level & DBG_DATA_LEVELS)
+		static_branch_enable(&woal_dbg_data_key);
+	else
+		static_branch_disable(&woal_dbg_data_key);
+#else
+	woal_trace_enabled = (level & MTRACE_D) ? MTRUE : MFALSE;
+	woal_dbg_data_enabled = (level & DBG_DATA_LEVELS) ? MTRUE : MFALSE;
 #endif
-			skb = alloc_skb(NLMSG_SPACE(NL_MAX_PAYLOAD),
-					GFP_ATOMIC);
-			if (!skb) {
-				PRINTM(MERROR,
-				       "Could not allocate skb for netlink\n");
-				ret = MLAN_STATUS_FAILURE;
-				goto done;
-			}
+}
+
+/**
+ *  @brief This function records an event in the trace ring of the
+ *  current CPU
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param event    Event id, see mlan_trace_event
+ *  @param arg0     Event argument 0
+ *  @param arg1     Event argument 1
+ *
+ *  @return         N/A
+ */
+void woal_trace_record(moal_handle *handle, t_u32 event, t_u32 arg0,
+		       t_u32 arg1)
+{
+	moal_trace_ring *ring;
+	moal_trace_rec *rec;
+	unsigned long flags;
+	t_u32 seq;
+
+	if (!handle || !handle->trace_ring)
+		return;
+	local_irq_save(flags);
+	ring = this_cpu_ptr(handle->trace_ring);
+	seq = ring->head++;
+	rec = &ring->rec[seq & (handle->trace_ring_size - 1)];
+	rec->ts = local_clock();
+	rec->seq = seq;
+	rec->event = (t_u16)event;
+	rec->cpu = (t_u16)smp_processor_id();
+	rec->arg0 = arg0;
+	rec->arg1 = arg1;
+	local_irq_restore(flags);
+}
+#endif
+
+/**
+ *  @brief This function copies data into the event ring, wrapping at
+ *  the end of the buffer
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param pos      Free running write offset
+ *  @param data     A pointer to data buffer
+ *  @param len      Length of data
+ *
+ *  @return         Write offset after the data
+ */
+static t_u32 woal_evt_ring_copy(moal_handle *handle, t_u32 pos, t_u8 *data,
+				t_u32 len)
+{
+	moal_evt_ring *ring = &handle->evt_ring;
+	t_u32 off = pos & (ring->size - 1);
+	t_u32 n = MIN(len, ring->size - off);
+
+	moal_memcpy_ext(handle, ring->buf + off, data, n, ring->size - off);
+	if (n < len)
+		moal_memcpy_ext(handle, ring->buf, data + n, len - n,
+				ring->size);
+	return pos + len;
+}
+
+/**
+ *  @brief This function queues an event record in the event ring and
+ *  wakes up readers. The event is dropped and counted when the ring
+ *  is full.
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param name     Interface name, IFNAMSIZ bytes
+ *  @param payload  A pointer to payload buffer
+ *  @param len      Length of the payload
+ *
+ *  @return         N/A
+ */
+static void woal_evt_ring_put(moal_handle *handle, char *name, t_u8 *payload,
+			      t_u32 len)
+{
+	moal_evt_ring *ring = &handle->evt_ring;
+	static const t_u8 pad[EVT_REC_ALIGN];
+	moal_evt_rec rec;
+	unsigned long flags;
+	t_u32 rec_len;
+	t_u32 pos;
+
+	if (!ring->buf)
+		return;
+	rec.len = IFNAMSIZ + len;
+	rec_len = ALIGN_SZ(sizeof(rec) + rec.len, EVT_REC_ALIGN);
+
+	spin_lock_irqsave(&ring->lock, flags);
+	rec.seq = ring->seq++;
+	if (rec_len > ring->size - (ring->wp - ring->rp)) {
+		ring->lost++;
+		ring->total_lost++;
+		spin_unlock_irqrestore(&ring->lock, flags);
+		return;
+	}
+	rec.lost = MIN(ring->lost, 0xffff);
+	ring->lost = 0;
+	pos = woal_evt_ring_copy(handle, ring->wp, (t_u8 *)&rec, sizeof(rec));
+	pos = woal_evt_ring_copy(handle, pos, (t_u8 *)name, IFNAMSIZ);
+	pos = woal_evt_ring_copy(handle, pos, payload, len);
+	/* The ring wraps over older records, clear the pad every time */
+	woal_evt_ring_copy(handle, pos, (t_u8 *)pad,
+			   ring->wp + rec_len - pos);
+	ring->wp += rec_len;
+	spin_unlock_irqrestore(&ring->lock, flags);
+
+	wake_up_interruptible(&ring->wait_q);
+}
+
+/**
+ *  @brief This function handles events generated by firmware
+ *
+ *  @param priv     A pointer to moal_private structure
+ *  @param payload  A pointer to payload buffer
+ *  @param len      Length of the payload
+ *  @return         MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+mlan_status woal_broadcast_event(moal_private *priv, t_u8 *payload, t_u32 len)
+{
+	mlan_status ret = MLAN_STATUS_SUCCESS;
+	struct sk_buff *skb = NULL;
+	struct nlmsghdr *nlh = NULL;
+	moal_handle *handle = priv->phandle;
+	struct net_device *netdev = priv->netdev;
+	struct sock *sk = handle->nl_sk;
+
+	ENTER();
+
+	/* interface name to be prepended to event */
+	if ((len + IFNAMSIZ) > NL_MAX_PAYLOAD
 #ifdef WIFI_DIRECT_SUPPORT
-		}
+				       * 2
 #endif
-		memset(skb->data, 0, NLMSG_SPACE(NL_MAX_PAYLOAD));
+	) {
+		PRINTM(MERROR, "event size is too big, len=%d\n", (int)len);
+		ret = MLAN_STATUS_FAILURE;
+		goto done;
+	}
+	woal_evt_ring_put(handle, netdev->name, payload, len);
+	if (sk) {
+		/* Allocate skb */
+		skb = alloc_skb(NLMSG_SPACE(len + IFNAMSIZ), GFP_ATOMIC);
+		if (!skb) {
+			PRINTM(MERROR, "Could not allocate skb for netlink\n");
+			ret = MLAN_STATUS_FAILURE;
+			goto done;
+		}
+		memset(skb->data, 0, NLMSG_SPACE(len + IFNAMSIZ));
 
 		nlh = (struct nlmsghdr *)skb->data;
 		nlh->nlmsg_len = NLMSG_SPACE(len + IFNAMSIZ);
@@ -7700,6 +8531,9 @@ static int woal_dump_moal_drv_info(moal_handle *phandle, t_u8 *buf)
 #if defined(SDIO_SUSPEND_RESUME)
 	ptr += sprintf(ptr, "hs_skip_count = %u\n", phandle->hs_skip_count);
 	ptr += sprintf(ptr, "hs_force_count = %u\n", phandle->hs_force_count);
+	ptr += sprintf(ptr, "suspend_us = %u resume_us = %u resume_ack_us = %u\n",
+		       phandle->suspend_us, phandle->resume_us,
+		       phandle->resume_ack_us);
 #endif
 
 	ptr += woal_dump_priv_drv_info(phandle, ptr);
@@ -8196,8 +9030,7 @@ void woal_moal_debug_info(moal_private *priv, moal_handle *handle, u8 flag)
 			if (drvdbg & (MREG_D | MFW_D)) {
 				if (!phandle->event_fw_dump) {
 					phandle->reg_dbg = MTRUE;
-					queue_work(phandle->workqueue,
-						   &phandle->main_work);
+					woal_queue_main_work(phandle);
 				}
 			}
 		}
@@ -8206,7 +9039,7 @@ void woal_moal_debug_info(moal_private *priv, moal_handle *handle, u8 flag)
 	if (drvdbg & MFW_D) {
 		drvdbg &= ~MFW_D;
 		phandle->fw_dbg = MTRUE;
-		queue_work(phandle->workqueue, &phandle->main_work);
+		woal_queue_main_work(phandle);
 	}
 #endif
 	LEAVE();
@@ -8512,15 +9345,14 @@ t_void woal_evt_work_queue(struct work_struct *work)
 	LEAVE();
 }
 /**
- *  @brief This workqueue function handles rx_process
+ *  @brief This function handles rx_process
  *
- *  @param work    A pointer to work_struct
+ *  @param handle  A pointer to moal_handle
  *
  *  @return        N/A
  */
-t_void woal_rx_work_queue(struct work_struct *work)
+static t_void woal_rx_process(moal_handle *handle)
 {
-	moal_handle *handle = container_of(work, moal_handle, rx_work);
 #ifdef STA_CFG80211
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 2, 0)
 #if CFG80211_VERSION_CODE < KERNEL_VERSION(3, 14, 6)
@@ -8559,22 +9391,34 @@ t_void woal_rx_work_queue(struct work_struct *work)
 }
 
 /**
- *  @brief This workqueue function handles main_process
+ *  @brief This workqueue function handles rx_process
  *
  *  @param work    A pointer to work_struct
  *
  *  @return        N/A
  */
-t_void woal_main_work_queue(struct work_struct *work)
+t_void woal_rx_work_queue(struct work_struct *work)
 {
-	moal_handle *handle = container_of(work, moal_handle, main_work);
-#if LINUX_VERSION_CODE < KERNEL_VERSION(2, 6, 36)
-	struct sched_param sp = {.sched_priority = wq_sched_prio};
-#endif
+	moal_handle *handle = container_of(work, moal_handle, rx_work);
+
+	woal_rx_process(handle);
+}
 
+/**
+ *  @brief This function handles main_process
+ *
+ *  @param handle  A pointer to moal_handle
+ *
+ *  @return        N/A
+ */
+static t_void woal_main_process(moal_handle *handle)
+{
 	ENTER();
 
 	if (handle->surprise_removed == MTRUE) {
+		/* The card is gone, do not leave staged packets behind */
+		if (moal_extflg_isset(handle, EXT_TX_STAGE))
+			woal_tx_stage_free(handle);
 		LEAVE();
 		return;
 	}
@@ -8586,10 +9430,37 @@ t_void woal_main_work_queue(struct work_struct *work)
 	if (handle->fw_dbg == MTRUE) {
 		handle->fw_dbg = MFALSE;
 		handle->ops.dump_fw_info(handle);
+		/* Hand staged packets to MLAN and re-arm the kick */
+		if (moal_extflg_isset(handle, EXT_TX_STAGE))
+			woal_tx_stage_drain(handle);
 		LEAVE();
 		return;
 	}
+
+	handle->main_state = MOAL_ENTER_WORK_QUEUE;
+	if (moal_extflg_isset(handle, EXT_TX_STAGE))
+		woal_tx_stage_drain(handle);
+	handle->main_state = MOAL_START_MAIN_PROCESS;
+	/* Call MLAN main process */
+	mlan_main_process(handle->pmlan_adapter);
+	handle->main_state = MOAL_END_MAIN_PROCESS;
+
+	LEAVE();
+}
+
+/**
+ *  @brief This workqueue function handles main_process
+ *
+ *  @param work    A pointer to work_struct
+ *
+ *  @return        N/A
+ */
+t_void woal_main_work_queue(struct work_struct *work)
+{
+	moal_handle *handle = container_of(work, moal_handle, main_work);
 #if LINUX_VERSION_CODE < KERNEL_VERSION(2, 6, 36)
+	struct sched_param sp = {.sched_priority = wq_sched_prio};
+
 	/* Change the priority and scheduling policy of main work queue
 	 */
 	if ((handle->params.wq_sched_prio != current->rt_priority) ||
@@ -8603,13 +9474,159 @@ t_void woal_main_work_queue(struct work_struct *work)
 	}
 #endif
 
-	handle->main_state = MOAL_ENTER_WORK_QUEUE;
-	handle->main_state = MOAL_START_MAIN_PROCESS;
-	/* Call MLAN main process */
-	mlan_main_process(handle->pmlan_adapter);
-	handle->main_state = MOAL_END_MAIN_PROCESS;
+	woal_main_process(handle);
+}
+
+/**
+ *  @brief Worker thread loop for main or rx process
+ *
+ *  @param data    A pointer to moal_worker
+ *
+ *  @return        0
+ */
+static int woal_worker_thread(void *data)
+{
+	moal_worker *worker = (moal_worker *)data;
+	t_u64 start_ns, lat;
+
+	while (!kthread_should_stop()) {
+		wait_event_interruptible(worker->wait_q,
+					 atomic_read(&worker->pending) ||
+						 kthread_should_stop());
+		if (kthread_should_stop())
+			break;
+		/* Mark running before clearing pending so flush never sees
+		 * both clear while a request is being served */
+		atomic_set(&worker->running, MTRUE);
+		/* The exchange orders the wake_ns read after pending */
+		if (!atomic_xchg(&worker->pending, 0)) {
+			atomic_set(&worker->running, MFALSE);
+			continue;
+		}
+		start_ns = ktime_to_ns(ktime_get());
+		if (start_ns > worker->wake_ns) {
+			lat = moal_do_div(start_ns - worker->wake_ns, 1000);
+			worker->wake_lat += lat;
+			if (lat > worker->wake_lat_max)
+				worker->wake_lat_max = (t_u32)lat;
+		}
+		worker->process(worker->handle);
+		lat = moal_do_div(ktime_to_ns(ktime_get()) - start_ns, 1000);
+		worker->run_time += lat;
+		worker->runs++;
+		atomic_set(&worker->running, MFALSE);
+		wake_up_all(&worker->idle_q);
+	}
+	return 0;
+}
+
+/**
+ *  @brief Check whether a worker thread has no pending or running work
+ *
+ *  @param worker  A pointer to moal_worker
+ *
+ *  @return        MTRUE or MFALSE
+ */
+static t_u8 woal_worker_idle(moal_worker *worker)
+{
+	if (atomic_read(&worker->pending))
+		return MFALSE;
+	smp_rmb();
+	return atomic_read(&worker->running) ? MFALSE : MTRUE;
+}
+
+/**
+ *  @brief Wait until a worker thread has served all requests
+ *
+ *  @param worker  A pointer to moal_worker
+ *
+ *  @return        N/A
+ */
+void woal_flush_worker(moal_worker *worker)
+{
+	if (!worker->task || worker->task == current)
+		return;
+	wait_event(worker->idle_q, woal_worker_idle(worker));
+}
+
+/**
+ *  @brief Create a worker thread, bind it to a CPU and set its
+ *  scheduling policy from wq_sched_policy/wq_sched_prio
+ *
+ *  @param handle  A pointer to moal_handle
+ *  @param worker  A pointer to moal_worker
+ *  @param process Process function run by the thread
+ *  @param cpu     CPU to bind to, negative for no binding
+ *  @param name    Thread name
+ *
+ *  @return        MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+static mlan_status woal_start_worker(moal_handle *handle, moal_worker *worker,
+				     void (*process)(moal_handle *handle),
+				     int cpu, char *name)
+{
+	struct task_struct *task;
+#if LINUX_VERSION_CODE < KERNEL_VERSION(5, 9, 0)
+	struct sched_param sp = {.sched_priority =
+					 handle->params.wq_sched_prio};
+#endif
+
+	ENTER();
+
+	memset(worker, 0, sizeof(moal_worker));
+	init_waitqueue_head(&worker->wait_q);
+	init_waitqueue_head(&worker->idle_q);
+	atomic_set(&worker->pending, 0);
+	atomic_set(&worker->running, 0);
+	atomic_set(&worker->wakeups, 0);
+	worker->process = process;
+	worker->handle = handle;
+
+	task = kthread_create(woal_worker_thread, worker, "%s", name);
+	if (IS_ERR(task)) {
+		PRINTM(MERROR, "Fail to create thread %s\n", name);
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
+	}
+	if (cpu >= 0) {
+		if (cpu < nr_cpu_ids && cpu_online(cpu))
+			kthread_bind(task, cpu);
+		else
+			PRINTM(MERROR, "%s: invalid cpu %d, not bound\n", name,
+			       cpu);
+	}
+	if (handle->params.wq_sched_policy != SCHED_NORMAL) {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 9, 0)
+		/* Only the default RT priority can be set from modules */
+		sched_set_fifo(task);
+#else
+		sched_setscheduler(task, handle->params.wq_sched_policy, &sp);
+#endif
+	}
+	worker->task = task;
+	wake_up_process(task);
+	PRINTM(MMSG, "Start %s cpu=%d policy=%d prio=%d\n", name, cpu,
+	       handle->params.wq_sched_policy, handle->params.wq_sched_prio);
 
 	LEAVE();
+	return MLAN_STATUS_SUCCESS;
+}
+
+/**
+ *  @brief Stop a worker thread
+ *
+ *  @param worker  A pointer to moal_worker
+ *
+ *  @return        N/A
+ */
+void woal_stop_worker(moal_worker *worker)
+{
+	if (!worker->task)
+		return;
+	kthread_stop(worker->task);
+	worker->task = NULL;
+	atomic_set(&worker->pending, 0);
+	wake_up_all(&worker->idle_q);
 }
 
 #ifdef IMX_SUPPORT
@@ -8772,6 +9789,8 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 	mlan_status status = MLAN_STATUS_SUCCESS;
 	int netlink_num = NETLINK_NXP;
 	int index = 0;
+	int i;
+	char thread_name[16];
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 6, 0)
 	struct netlink_kernel_cfg cfg = {
 		.groups = NL_MULTICAST_GROUP,
@@ -8799,6 +9818,7 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 
 	/* Init moal_handle */
 	handle->card = card;
+	handle->boot_mark = ktime_to_ns(ktime_get());
 
 	/* Save the handle */
 	m_handle[index] = handle;
@@ -8822,6 +9842,7 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 
 #ifdef DEBUG_LEVEL1
 	drvdbg = handle->params.drvdbg;
+	woal_update_dbg_keys(drvdbg);
 #endif
 
 	if (handle->params.mac_addr
@@ -8898,6 +9919,11 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 		       "Could not initialize netlink event passing mechanism!\n");
 		goto err_kmalloc;
 	}
+	woal_evt_ring_init(handle);
+	woal_trace_ring_init(handle);
+	woal_mmap_ring_init(&handle->mon_ring, handle->params.mon_ring,
+			    "Monitor");
+	woal_mmap_ring_init(&handle->csi_ring, handle->params.csi_ring, "CSI");
 
 	/* Create workqueue for main process */
 #if LINUX_VERSION_CODE < KERNEL_VERSION(2, 6, 14)
@@ -8916,6 +9942,15 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 		goto err_kmalloc;
 
 	MLAN_INIT_WORK(&handle->main_work, woal_main_work_queue);
+	if (moal_extflg_isset(handle, EXT_MAIN_THREAD)) {
+		snprintf(thread_name, sizeof(thread_name), "woal_main_%d",
+			 handle->handle_idx);
+		woal_start_worker(handle, &handle->main_thread,
+				  woal_main_process,
+				  handle->params.main_thread_cpu, thread_name);
+	}
+	for (i = 0; i < TX_STAGE_NUM; i++)
+		init_llist_head(&handle->tx_stage[i]);
 
 	/* Create workqueue for event process */
 #if LINUX_VERSION_CODE < KERNEL_VERSION(2, 6, 14)
@@ -8972,6 +10007,14 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 			goto err_kmalloc;
 		}
 		MLAN_INIT_WORK(&handle->rx_work, woal_rx_work_queue);
+		if (moal_extflg_isset(handle, EXT_MAIN_THREAD)) {
+			snprintf(thread_name, sizeof(thread_name),
+				 "woal_rx_%d", handle->handle_idx);
+			woal_start_worker(handle, &handle->rx_thread,
+					  woal_rx_process,
+					  handle->params.rx_thread_cpu,
+					  thread_name);
+		}
 	}
 #define NAPI_BUDGET 64
 	if (moal_extflg_isset(handle, EXT_NAPI)) {
@@ -9143,6 +10186,9 @@ mlan_status woal_remove_card(void *card)
 #if IS_ENABLED(CONFIG_IPV6)
 	unregister_inet6addr_notifier(&handle->woal_inet6_notifier);
 #endif
+#if defined(SDIO_SUSPEND_RESUME)
+	woal_cancel_timer(&handle->resume_gate_timer);
+#endif
 
 #if defined(STA_CFG80211) || defined(UAP_CFG80211)
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(2, 6, 39)
@@ -9319,6 +10365,7 @@ mlan_status woal_switch_drv_mode(moal_handle *handle, t_u32 mode)
 
 	handle->priv_num = 0;
 	handle->params.drv_mode = mode;
+	handle->boot_mark = ktime_to_ns(ktime_get());
 	/* Init SW */
 	if (woal_init_sw(handle)) {
 		PRINTM(MFATAL, "Software Init Failed\n");
@@ -9442,14 +10489,20 @@ done:
 	return ret;
 }
 
+/** Poll period in ms for pending commands on a fast fw reload */
+#define FAST_RELOAD_POLL 100
+/** Max polls for pending commands on a fast fw reload */
+#define FAST_RELOAD_POLL_TRIES 50
+
 /**
  *  @brief This function handle the pre_reset
  *
  *  @param handle   A pointer to moal_handle structure
+ *  @param fast     MTRUE to keep the interfaces attached
  *
  *  @return        NULL;
  */
-static void woal_pre_reset(moal_handle *handle)
+static void woal_pre_reset(moal_handle *handle, t_u8 fast)
 {
 	int intf_num;
 	t_u8 driver_status = handle->driver_status;
@@ -9457,18 +10510,20 @@ static void woal_pre_reset(moal_handle *handle)
 	moal_private *priv = woal_get_priv(handle, MLAN_BSS_ROLE_STA);
 	mlan_debug_info *info = &(handle->debug_info);
 	int ioctl_pending = 0;
+	int tries = fast ? FAST_RELOAD_POLL_TRIES : 5;
+	t_u32 poll = fast ? FAST_RELOAD_POLL : MOAL_TIMER_1S;
 
 	ENTER();
 	if (!driver_status && priv)
 		woal_cancel_scan(priv, MOAL_IOCTL_WAIT);
 	handle->driver_status = MTRUE;
 
-	if (!driver_status)
+	if (!driver_status && !fast)
 		woal_sched_timeout_uninterruptible(MOAL_TIMER_1S);
 
 	// wait for IOCTL return
 	if (!driver_status && priv) {
-		for (i = 0; i < 5; i++) {
+		for (i = 0; i < tries; i++) {
 			woal_get_debug_info(priv, MOAL_IOCTL_WAIT, info);
 			ioctl_pending = atomic_read(&handle->ioctl_pending);
 			if (!info->pending_cmd && !ioctl_pending) {
@@ -9476,14 +10531,17 @@ static void woal_pre_reset(moal_handle *handle)
 				       "fw_reload: No pending command and IOCTL\n");
 				break;
 			}
-			woal_sched_timeout_uninterruptible(MOAL_TIMER_1S);
+			woal_sched_timeout_uninterruptible(poll);
 		}
 	}
-	/** detach network interface */
+	/** detach network interface, or only stop the queues so TX is held
+	 * in the qdisc until the firmware is back */
 	for (intf_num = 0; intf_num < handle->priv_num; intf_num++) {
 		if (handle->priv[intf_num]) {
 			woal_stop_queue(handle->priv[intf_num]->netdev);
-			netif_device_detach(handle->priv[intf_num]->netdev);
+			if (!fast)
+				netif_device_detach(
+					handle->priv[intf_num]->netdev);
 		}
 	}
 	/** mask host interrupt from firmware */
@@ -9497,14 +10555,73 @@ static void woal_pre_reset(moal_handle *handle)
 	LEAVE();
 }
 
+/**
+ *  @brief This function brings an interface back after a fast fw reload
+ *
+ *  The net devices and the moal side interface state are kept. MLAN
+ *  keeps its scan table but otherwise starts over as on a full reload,
+ *  dropping the station, BA and other per association tables together
+ *  with the association itself. Report the disconnect or the stopped
+ *  AP, forget the custom IE slots and replay the interface address and
+ *  the mgmt frame registrations.
+ *
+ *  @param priv     A pointer to moal_private structure
+ *
+ *  @return         N/A
+ */
+static void woal_recover_priv(moal_private *priv)
+{
+	ENTER();
+#ifdef STA_SUPPORT
+	if (GET_BSS_ROLE(priv) == MLAN_BSS_ROLE_STA && priv->media_connected)
+		woal_send_disconnect_to_system(priv, DEF_DEAUTH_REASON_CODE);
+#endif
+#ifdef UAP_SUPPORT
+	if (GET_BSS_ROLE(priv) == MLAN_BSS_ROLE_UAP) {
+#if defined(UAP_CFG80211)
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(4, 11, 0)
+		/* The AP is gone with the firmware, let hostapd restart it */
+		if (priv->bss_started && priv->wdev &&
+		    IS_UAP_CFG80211(priv->phandle->params.cfg80211_wext))
+			cfg80211_stop_iface(priv->phandle->wiphy, priv->wdev,
+					    GFP_KERNEL);
+#endif
+#endif
+		priv->bss_started = MFALSE;
+		priv->media_connected = MFALSE;
+	}
+#endif
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+	priv->probereq_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->beacon_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->proberesp_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->assocresp_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->beacon_wps_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->proberesp_p2p_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->assocresp_qos_map_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+	priv->beacon_vendor_index = MLAN_CUSTOM_IE_AUTO_IDX_MASK;
+#endif
+	if (priv->bss_type != MLAN_BSS_TYPE_DFS)
+		woal_request_set_mac_address(priv, MOAL_IOCTL_WAIT);
+#if defined(STA_CFG80211) || defined(UAP_CFG80211)
+	/* Replay the mgmt frame registrations userspace made */
+	if (priv->mgmt_subtype_mask &&
+	    woal_reg_rx_mgmt_ind(priv, MLAN_ACT_SET, &priv->mgmt_subtype_mask,
+				 MOAL_IOCTL_WAIT))
+		PRINTM(MERROR, "Fail to register mgmt frame after reload\n");
+#endif
+	LEAVE();
+}
+
 /**
  *  @brief This function handle pose_reset
  *
  *  @param handle   A pointer to moal_handle structure
+ *  @param fast     MTRUE to keep host side interface state
  *
  *  @return        NULL;
  */
-static void woal_post_reset(moal_handle *handle)
+static void woal_post_reset(moal_handle *handle, t_u8 fast)
 {
 	mlan_ioctl_req *req = NULL;
 	mlan_ds_misc_cfg *misc = NULL;
@@ -9529,7 +10646,7 @@ static void woal_post_reset(moal_handle *handle)
 	if (req) {
 		misc = (mlan_ds_misc_cfg *)req->pbuf;
 		misc->sub_command = MLAN_OID_MISC_WARM_RESET;
-		misc->param.fw_reload = MTRUE;
+		misc->param.fw_reload = fast ? MLAN_FW_RELOAD_KEEP_SCAN : MTRUE;
 		req->req_id = MLAN_IOCTL_MISC_CFG;
 		req->action = MLAN_ACT_SET;
 		if (MLAN_STATUS_SUCCESS !=
@@ -9542,16 +10659,22 @@ static void woal_post_reset(moal_handle *handle)
 	}
 #ifdef DEBUG_LEVEL1
 	drvdbg = handle->params.drvdbg;
+	woal_update_dbg_keys(drvdbg);
 #endif
 	handle->driver_status = MFALSE;
 	handle->hardware_status = HardwareStatusReady;
 	/* Reset all interfaces */
-	woal_reset_intf(woal_get_priv(handle, MLAN_BSS_ROLE_ANY),
-			MOAL_IOCTL_WAIT, MTRUE);
+	if (!fast)
+		woal_reset_intf(woal_get_priv(handle, MLAN_BSS_ROLE_ANY),
+				MOAL_IOCTL_WAIT, MTRUE);
 	/* Initialize private structures */
 	for (intf_num = 0; intf_num < handle->priv_num; intf_num++) {
 		if (handle->priv[intf_num]) {
-			woal_init_priv(handle->priv[intf_num], MOAL_IOCTL_WAIT);
+			if (fast)
+				woal_recover_priv(handle->priv[intf_num]);
+			else
+				woal_init_priv(handle->priv[intf_num],
+					       MOAL_IOCTL_WAIT);
 #ifdef WIFI_DIRECT_SUPPORT
 #if defined(STA_SUPPORT) && defined(UAP_SUPPORT)
 #if defined(STA_WEXT) || defined(UAP_WEXT)
@@ -9630,6 +10753,8 @@ done:
 void woal_request_fw_reload(moal_handle *phandle, t_u8 mode)
 {
 	int ret = 0;
+	t_u8 fast = MFALSE;
+	t_u64 start_us;
 
 	moal_handle *handle = phandle;
 
@@ -9641,7 +10766,17 @@ void woal_request_fw_reload(moal_handle *phandle, t_u8 mode)
 		LEAVE();
 		return;
 	}
-	woal_pre_reset(handle);
+	start_us = ktime_to_us(ktime_get());
+	handle->reload_start_us = 0;
+	handle->reload_first_pkt_us = 0;
+	if (handle->params.fast_reload)
+		fast = MTRUE;
+#if defined(STA_CFG80211) && defined(UAP_CFG80211)
+	/* Only the full reset tears down the monitor interface */
+	if (handle->mon_if)
+		fast = MFALSE;
+#endif
+	woal_pre_reset(handle, fast);
 	if (mode == FW_RELOAD_NO_EMULATION) {
 		ret = woal_reload_fw(handle);
 	} else if ((mode == FW_RELOAD_SDIO_INBAND_RESET ||
@@ -9654,7 +10789,11 @@ void woal_request_fw_reload(moal_handle *phandle, t_u8 mode)
 		PRINTM(MERROR, "FW reload fail\n");
 		goto done;
 	}
-	woal_post_reset(handle);
+	woal_post_reset(handle, fast);
+	handle->reload_us = (t_u32)(ktime_to_us(ktime_get()) - start_us);
+	PRINTM(MMSG, "FW reload done in %u us%s\n", handle->reload_us,
+	       fast ? " (fast)" : "");
+	handle->reload_start_us = start_us;
 done:
 	LEAVE();
 	return;
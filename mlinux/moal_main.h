@@ -57,7 +57,17 @@ Change log:
 #include <linux/namei.h>
 #include <linux/fs.h>
 #endif
+#include <linux/poll.h>
 #include <linux/of.h>
+#include <linux/percpu.h>
+#include <linux/kthread.h>
+#include <linux/llist.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 3, 0)
+#include <linux/jump_label.h>
+#endif
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 11, 0)
+#include <linux/sched/clock.h>
+#endif
 
 #if LINUX_VERSION_CODE < KERNEL_VERSION(2, 6, 18)
 #include <linux/config.h>
@@ -297,6 +307,151 @@ typedef struct _moal_private moal_private, *pmoal_private;
 /** Handle data structure for MOAL  */
 typedef struct _moal_handle moal_handle, *pmoal_handle;
 
+/** Boot phases reported in the boot_timeline proc file */
+enum { BOOT_PHASE_PROBE,
+       BOOT_PHASE_FW_REQUEST,
+       BOOT_PHASE_FW_DNLD,
+       BOOT_PHASE_FW_READY,
+       BOOT_PHASE_INIT_DATA,
+       BOOT_PHASE_INIT_CMD,
+       BOOT_PHASE_INTF_UP,
+       BOOT_PHASE_MAX };
+
+/** Event ring record header, followed by interface name and event */
+typedef struct _moal_evt_rec {
+	/** Length of interface name and event */
+	t_u16 len;
+	/** Events dropped on overflow just before this one */
+	t_u16 lost;
+	/** Event sequence number */
+	t_u32 seq;
+} moal_evt_rec;
+
+/** Prefetched init data files, bit numbers in init_data_err */
+#define INIT_DATA_DPD 0
+#define INIT_DATA_TXPWR 1
+#define INIT_DATA_CAL 2
+
+/** Event ring records are padded to this alignment */
+#define EVT_REC_ALIGN 4
+/** Largest event ring size (KB) */
+#define EVT_RING_MAX_KB 1024
+
+/** Event ring, read in batches through the event_ring proc file */
+typedef struct _moal_evt_ring {
+	/** Ring buffer, NULL when disabled */
+	t_u8 *buf;
+	/** Ring size, power of 2 */
+	t_u32 size;
+	/** Write offset, free running */
+	t_u32 wp;
+	/** Read offset, free running */
+	t_u32 rp;
+	/** Serializes writers */
+	spinlock_t lock;
+	/** Serializes readers */
+	struct semaphore read_sem;
+	/** Readers wait here for new records */
+	wait_queue_head_t wait_q;
+	/** Set when the proc file goes away, readers return */
+	t_u8 shutdown;
+	/** Next event sequence number */
+	t_u32 seq;
+	/** Events dropped since the last queued record */
+	t_u32 lost;
+	/** Events dropped in total */
+	t_u32 total_lost;
+} moal_evt_ring;
+
+/** mmap ring control page, shared with user space */
+typedef struct _moal_mmap_ring_ctrl {
+	/** Size of the data area following the control page, power of 2 */
+	t_u32 size;
+	/** Write offset, free running, advanced by the driver */
+	t_u32 wp;
+	/** Read offset, free running, advanced by user space */
+	t_u32 rp;
+	/** Records stored in the ring */
+	t_u32 packets;
+	/** Records dropped because the ring was full */
+	t_u32 dropped;
+	/** Records to queue before waking the reader, set by user space */
+	t_u32 wake_batch;
+} moal_mmap_ring_ctrl;
+
+/** mmap ring record header, followed by the payload */
+typedef struct _moal_mmap_rec {
+	/** Length of the payload */
+	t_u16 len;
+	/** Record flags */
+	t_u16 flags;
+	/** Sequence number, dropped records leave a gap */
+	t_u32 seq;
+	/** Receive time, seconds */
+	t_u32 ts_sec;
+	/** Receive time, microseconds */
+	t_u32 ts_usec;
+} moal_mmap_rec;
+
+/** mmap ring record flag: padding up to the end of the data area */
+#define MMAP_REC_PAD MBIT(0)
+/** mmap ring records are padded to this alignment, the size of the
+ *  record header so a padding record always fits before the wrap */
+#define MMAP_REC_ALIGN 16
+/** Largest mmap ring size (KB) */
+#define MMAP_RING_MAX_KB 16384
+
+/** Ring of records mapped by user space through a proc file */
+typedef struct _moal_mmap_ring {
+	/** Control page followed by the data area, NULL when disabled */
+	moal_mmap_ring_ctrl *ctrl;
+	/** Data area */
+	t_u8 *data;
+	/** Size of the data area, power of 2 */
+	t_u32 size;
+	/** Write offset, the copy in the control page is not trusted */
+	t_u32 wp;
+	/** Sequence number of the next record */
+	t_u32 seq;
+	/** Records queued since the reader was last woken */
+	t_u32 pending;
+	/** Serializes writers */
+	spinlock_t lock;
+	/** Pollers wait here for new records */
+	wait_queue_head_t wait_q;
+	/** Number of opens of the proc file, records are queued if set */
+	atomic_t users;
+} moal_mmap_ring;
+
+/** Trace ring record, read raw from the trace proc file */
+typedef struct _moal_trace_rec {
+	/** local_clock() time in ns */
+	t_u64 ts;
+	/** Per-CPU sequence number */
+	t_u32 seq;
+	/** Event id, see mlan_trace_event */
+	t_u16 event;
+	/** CPU the event was recorded on */
+	t_u16 cpu;
+	/** Event argument 0 */
+	t_u32 arg0;
+	/** Event argument 1 */
+	t_u32 arg1;
+} moal_trace_rec;
+
+/** Largest number of trace records per CPU */
+#define TRACE_RING_MAX_REC 1024
+
+/** Per-CPU trace ring, written with local interrupts off, no lock */
+typedef struct _moal_trace_ring {
+	/** Next sequence number, free running */
+	t_u32 head;
+	/** Reserved */
+	t_u32 reserved;
+	/** Records, trace_ring_size entries */
+	moal_trace_rec rec[];
+} moal_trace_ring;
+
 /** Hardware status codes */
 typedef enum _MOAL_HARDWARE_STATUS {
 	HardwareStatusReady,
@@ -317,7 +472,10 @@ typedef enum _MOAL_HARDWARE_STATUS {
 #define FW_CAPINFO_80211BGA (MBIT(8) | MBIT(9) | MBIT(10))
 
 /** moal_wait_option */
-enum { MOAL_NO_WAIT, MOAL_IOCTL_WAIT, MOAL_IOCTL_WAIT_TIMEOUT };
+enum { MOAL_NO_WAIT,
+       MOAL_IOCTL_WAIT,
+       MOAL_IOCTL_WAIT_TIMEOUT,
+       MOAL_IOCTL_ASYNC };
 
 /** moal_main_state */
 enum { MOAL_STATE_IDLE,
@@ -514,8 +672,6 @@ static inline void woal_cancel_timer(moal_drv_timer *timer)
  * OS Thread Specific
  */
 
-#include <linux/kthread.h>
-
 /** Kernel thread structure */
 typedef struct _moal_thread {
 	/** Task control structrue */
@@ -571,6 +727,36 @@ static inline void woal_create_thread(int (*threadfunc)(void *),
 }
 #endif /* REASSOCIATION */
 
+/** Dedicated worker thread running main or rx process */
+typedef struct _moal_worker {
+	/** Task control structure, NULL when the workqueue is used */
+	struct task_struct *task;
+	/** Wait queue the thread sleeps on */
+	wait_queue_head_t wait_q;
+	/** Wait queue for flush */
+	wait_queue_head_t idle_q;
+	/** Work pending flag */
+	atomic_t pending;
+	/** Process function is running */
+	atomic_t running;
+	/** Time of the wakeup request in ns */
+	t_u64 wake_ns;
+	/** Process function */
+	void (*process)(moal_handle *handle);
+	/** Pointer to moal_handle */
+	moal_handle *handle;
+	/** Number of wakeups */
+	atomic_t wakeups;
+	/** Number of process runs */
+	t_u32 runs;
+	/** Total run time in us */
+	t_u64 run_time;
+	/** Total wakeup latency in us */
+	t_u64 wake_lat;
+	/** Max wakeup latency in us */
+	t_u32 wake_lat_max;
+} moal_worker;
+
 /* The following macros are neccessary to retain compatibility
  * around the workqueue chenges happened in kernels >= 2.6.20:
  * - INIT_WORK changed to take 2 arguments and let the work function
@@ -889,6 +1075,8 @@ void woal_process_chan_event(moal_private *priv, t_u8 type, t_u8 channel,
 #define FW_DEBUG_INFO "EVENT=FW_DEBUG_INFO"
 
 #define CUS_EVT_CSI "EVENT=MLAN_CSI"
+/** Length of the CSI dump file path */
+#define CSI_DUMP_PATH_LEN 64
 
 /** 10 seconds */
 #define MOAL_TIMER_10S 10000
@@ -937,6 +1125,14 @@ void woal_process_chan_event(moal_private *priv, t_u8 type, t_u8 channel,
 /** LOW Tx Pending count */
 #define LOW_TX_PENDING 380
 
+/** Number of TX staging lists, one per netdev TX queue */
+#define TX_STAGE_NUM 4
+/** A staged packet is linked through the pnext slot of its mlan_buffer */
+#define woal_tx_stage_node(pmbuf) ((struct llist_node *)&(pmbuf)->pnext)
+/** mlan_buffer of a staged packet */
+#define woal_tx_stage_buf(node)                                                \
+	container_of((t_void *)(node), mlan_buffer, pnext)
+
 /** Offset for subcommand */
 #define SUBCMD_OFFSET 4
 
@@ -947,6 +1143,10 @@ void woal_process_chan_event(moal_private *priv, t_u8 type, t_u8 channel,
 
 /** max retry count for wait_event_interupptible_xx while loop */
 #define MAX_RETRY_CNT 100
+/** Completion callback of an asynchronous ioctl request */
+typedef void (*moal_ioctl_cb)(moal_private *priv, mlan_ioctl_req *req,
+			      mlan_status status, void *ctx);
+
 /** wait_queue structure */
 typedef struct _wait_queue {
 	/** wait_queue_head */
@@ -961,6 +1161,10 @@ typedef struct _wait_queue {
 	t_u8 wait_timeout;
 	/** retry count */
 	t_u8 retry;
+	/** completion callback for MOAL_IOCTL_ASYNC */
+	moal_ioctl_cb callback;
+	/** callback context */
+	void *ctx;
 } wait_queue, *pwait_queue;
 
 /** Auto Rate */
@@ -1398,6 +1602,8 @@ struct _moal_private {
 	BOOLEAN skip_cac;
 	/** tx block flag */
 	BOOLEAN uap_tx_blocked;
+	/** jiffies of the last firmware station list refresh */
+	unsigned long sta_stats_jiffies;
 #if defined(DFS_TESTING_SUPPORT)
 	/** user cac period */
 	t_u32 user_cac_period_msec;
@@ -1703,7 +1909,13 @@ struct _moal_private {
 	/** total length of csi dump */
 	t_u32 csi_dump_len;
 	/** path name of csi dump */
-	char csi_dump_path[64];
+	char csi_dump_path[CSI_DUMP_PATH_LEN];
+	/** CSI reports waiting to be written to the dump file */
+	struct sk_buff_head csi_dump_q;
+	/** work writing CSI reports to the dump file */
+	struct work_struct csi_dump_work;
+	/** CSI dump file, kept open across reports */
+	struct file *csi_dump_file;
 	/** CSI config */
 	mlan_ds_csi_params csi_config;
 #if defined(DRV_EMBEDDED_AUTHENTICATOR) || defined(DRV_EMBEDDED_SUPPLICANT)
@@ -2003,6 +2215,12 @@ typedef struct _monitor_iface {
 	netmon_band_chan_cfg band_chan_cfg;
 	/** Monitor device statistics structure */
 	struct net_device_stats stats;
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 8, 0)
+	/** Radiotap header template for rt_tmpl_chan */
+	struct radiotap_header rt_tmpl;
+	/** Channel of the radiotap template, 0: rebuild */
+	t_u8 rt_tmpl_chan;
+#endif
 } monitor_iface;
 #endif
 
@@ -2064,6 +2282,8 @@ enum ext_mod_params {
 	EXT_TX_SKB_CLONE,
 	EXT_PMQOS,
 	EXT_CHAN_TRACK,
+	EXT_TX_STAGE,
+	EXT_MAIN_THREAD,
 	EXT_MAX_PARAM,
 };
 
@@ -2128,6 +2348,19 @@ typedef struct _moal_mod_para {
 	int wq_sched_prio;
 	int wq_sched_policy;
 	int rx_work;
+	int tx_tstamp;
+	int main_thread_cpu;
+	int rx_thread_cpu;
+	int evt_ring;
+	int sta_stats_refresh;
+	int cmd_cache_ttl;
+	int int_poll_budget;
+	int int_poll_window;
+	int trace_ring;
+	int mon_ring;
+	int csi_ring;
+	int ps_hold_max;
+	int fast_reload;
 	int wakelock_timeout;
 	unsigned int dev_cap_mask;
 	int pmic;
@@ -2177,6 +2410,10 @@ struct _moal_handle {
 	const struct firmware *firmware;
 	/** Firmware request start time */
 	wifi_timeval req_fw_time;
+	/** End of the last finished boot phase (ns) */
+	t_u64 boot_mark;
+	/** Boot phase durations (us) */
+	t_u32 boot_phase[BOOT_PHASE_MAX];
 	/** Init config file */
 	const struct firmware *init_cfg_data;
 	/** Init config file */
@@ -2189,11 +2426,33 @@ struct _moal_handle {
 	const struct firmware *dpd_data;
 	/** txpwr data file */
 	const struct firmware *txpwr_data;
+	/** dpd/txpwr/cal files requested during FW download */
+	t_u8 init_data_prefetch;
+	/** Prefetched files that failed, callbacks may run concurrently */
+	unsigned long init_data_err;
+	/** Number of prefetched files not yet delivered */
+	atomic_t init_data_pending;
+	/** Event ring */
+	moal_evt_ring evt_ring;
+	/** Monitor capture ring */
+	moal_mmap_ring mon_ring;
+	/** CSI report ring */
+	moal_mmap_ring csi_ring;
+	/** Per-CPU trace rings, NULL when disabled */
+	moal_trace_ring __percpu *trace_ring;
+	/** Trace records per CPU, power of 2 */
+	t_u32 trace_ring_size;
 	/** Hotplug device */
 	struct device *hotplug_device;
 	/** STATUS variables */
 	MOAL_HARDWARE_STATUS hardware_status;
 	BOOLEAN fw_reload;
+	/** Time stamp in us of the last fw reload, 0 once a packet moved */
+	t_u64 reload_start_us;
+	/** Time in us the last fw reload took */
+	t_u32 reload_us;
+	/** Time in us from the last fw reload to the first data packet */
+	t_u32 reload_first_pkt_us;
 	/** POWER MANAGEMENT AND PnP SUPPORT */
 	BOOLEAN surprise_removed;
 	/** Firmware release number */
@@ -2270,6 +2529,22 @@ struct _moal_handle {
 	t_u32 hs_force_count;
 	/** suspend_fail flag */
 	BOOLEAN suspend_fail;
+	/** Data path held detached until host sleep is cancelled */
+	BOOLEAN resume_gated;
+	/** Timer releasing the data path if the cancel is not acked */
+	moal_drv_timer resume_gate_timer __ATTRIB_ALIGN__;
+	/** Time stamp in us of the last resume */
+	t_u64 resume_start_us;
+	/** Time in us waiting for suspend to be allowed */
+	t_u32 suspend_wait_us;
+	/** Time in us from host sleep request to activation */
+	t_u32 suspend_hs_us;
+	/** Time in us spent in the last suspend */
+	t_u32 suspend_us;
+	/** Time in us spent in the last resume */
+	t_u32 resume_us;
+	/** Time in us from resume to host sleep cancel ack */
+	t_u32 resume_ack_us;
 #endif
 #ifdef REASSOCIATION
 	/** Re-association thread */
@@ -2291,6 +2566,18 @@ struct _moal_handle {
 	struct workqueue_struct *workqueue;
 	/** main work */
 	struct work_struct main_work;
+	/** TX staging lists, one per TX queue */
+	struct llist_head tx_stage[TX_STAGE_NUM];
+	/** Main work kicked for staged TX packets */
+	atomic_t tx_stage_kick;
+	/** Number of TX packets staged */
+	atomic_t tx_stage_pkts;
+	/** Number of main work kicks from TX staging */
+	atomic_t tx_stage_kicks;
+	/** Number of staging drain passes */
+	t_u32 tx_stage_drains;
+	/** Main process thread */
+	moal_worker main_thread;
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 8, 0)
 	/** host_mlme_priv */
 	moal_private *host_mlme_priv;
@@ -2301,6 +2588,8 @@ struct _moal_handle {
 	struct workqueue_struct *rx_workqueue;
 	/** main work */
 	struct work_struct rx_work;
+	/** Rx process thread */
+	moal_worker rx_thread;
 	/** Driver event workqueue */
 	struct workqueue_struct *evt_workqueue;
 	/** event  work */
@@ -2575,6 +2864,53 @@ static inline t_u8 moal_extflg_isset(moal_handle *handle,
 	return (ext_fbyte & MBIT(idx % 8)) != 0;
 }
 
+/**
+ *  @brief Wake up a worker thread, coalescing requests while one is pending
+ *
+ *  @param worker	A pointer to moal_worker structure
+ *  @return			N/A
+ */
+static inline void woal_wakeup_worker(moal_worker *worker)
+{
+	if (atomic_read(&worker->pending))
+		return;
+	worker->wake_ns = ktime_to_ns(ktime_get());
+	/* The thread reads wake_ns once it sees pending set */
+	smp_wmb();
+	if (!atomic_xchg(&worker->pending, 1)) {
+		atomic_inc(&worker->wakeups);
+		wake_up_interruptible(&worker->wait_q);
+	}
+}
+
+/**
+ *  @brief Schedule main process on the main thread or main work
+ *
+ *  @param handle	A pointer to moal_handle structure
+ *  @return			N/A
+ */
+static inline void woal_queue_main_work(moal_handle *handle)
+{
+	if (handle->main_thread.task)
+		woal_wakeup_worker(&handle->main_thread);
+	else
+		queue_work(handle->workqueue, &handle->main_work);
+}
+
+/**
+ *  @brief Schedule rx process on the rx thread or rx work
+ *
+ *  @param handle	A pointer to moal_handle structure
+ *  @return			N/A
+ */
+static inline void woal_queue_rx_work(moal_handle *handle)
+{
+	if (handle->rx_thread.task)
+		woal_wakeup_worker(&handle->rx_thread);
+	else
+		queue_work(handle->rx_workqueue, &handle->rx_work);
+}
+
 /**
  *  @brief set trans_start for each TX queue.
  *
@@ -2665,6 +3001,36 @@ static inline void woal_wake_queue(struct net_device *dev)
 #ifdef DEBUG_LEVEL1
 extern t_u32 drvdbg;
 
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 3, 0)
+DECLARE_STATIC_KEY_FALSE(woal_trace_key);
+DECLARE_STATIC_KEY_FALSE(woal_dbg_data_key);
+/** Trace ring is recording */
+#define woal_trace_on() static_branch_unlikely(&woal_trace_key)
+/** A data path debug level is set */
+#define woal_dbg_data_on() static_branch_unlikely(&woal_dbg_data_key)
+#else
+extern t_u8 woal_trace_enabled;
+extern t_u8 woal_dbg_data_enabled;
+/** Trace ring is recording */
+#define woal_trace_on() unlikely(woal_trace_enabled)
+/** A data path debug level is set */
+#define woal_dbg_data_on() unlikely(woal_dbg_data_enabled)
+#endif
+
+/** Debug levels printed from the data path */
+#define DBG_DATA_LEVELS (MDATA | MINTR | MDAT_D | MIF_D)
+
+void woal_update_dbg_keys(t_u32 level);
+void woal_trace_record(moal_handle *handle, t_u32 event, t_u32 arg0,
+		       t_u32 arg1);
+
+/** Record a binary event in the trace ring */
+#define WOAL_TRACE(handle, event, arg0, arg1)                                  \
+	do {                                                                   \
+		if (woal_trace_on())                                           \
+			woal_trace_record(handle, event, arg0, arg1);          \
+	} while (0)
+
 #define LOG_CTRL(level) (0)
 
 #ifdef DEBUG_LEVEL2
@@ -2713,13 +3079,13 @@ extern t_u32 drvdbg;
 #define PRINTM_MDAT_D(level, msg...)                                           \
 	do {                                                                   \
 		woal_print(level, msg);                                        \
-		if (drvdbg & MDAT_D)                                           \
+		if (woal_dbg_data_on() && (drvdbg & MDAT_D))                   \
 			printk(KERN_DEBUG msg);                                \
 	} while (0)
 #define PRINTM_MIF_D(level, msg...)                                            \
 	do {                                                                   \
 		woal_print(level, msg);                                        \
-		if (drvdbg & MIF_D)                                            \
+		if (woal_dbg_data_on() && (drvdbg & MIF_D))                    \
 			printk(KERN_DEBUG msg);                                \
 	} while (0)
 
@@ -2732,7 +3098,7 @@ extern t_u32 drvdbg;
 #define PRINTM_MINTR(level, msg...)                                            \
 	do {                                                                   \
 		woal_print(level, msg);                                        \
-		if (drvdbg & MINTR)                                            \
+		if (woal_dbg_data_on() && (drvdbg & MINTR))                    \
 			printk(KERN_DEBUG msg);                                \
 	} while (0)
 #define PRINTM_MEVENT(level, msg...)                                           \
@@ -2750,7 +3116,7 @@ extern t_u32 drvdbg;
 #define PRINTM_MDATA(level, msg...)                                            \
 	do {                                                                   \
 		woal_print(level, msg);                                        \
-		if (drvdbg & MDATA)                                            \
+		if (woal_dbg_data_on() && (drvdbg & MDATA))                    \
 			printk(KERN_DEBUG msg);                                \
 	} while (0)
 #define PRINTM_MERROR(level, msg...)                                           \
@@ -2784,6 +3150,10 @@ static inline void woal_print(t_u32 level, char *fmt, ...)
 	do {                                                                   \
 	} while (0)
 
+#define WOAL_TRACE(handle, event, arg0, arg1)                                  \
+	do {                                                                   \
+	} while (0)
+
 #endif /* DEBUG_LEVEL1 */
 
 /** Wait until a condition becomes true */
@@ -2992,6 +3362,48 @@ static inline void woal_get_monotonic_time(wifi_timeval *tv)
 	}
 }
 
+/** TX timestamp from the raw monotonic clock */
+#define TX_TSTAMP_PRECISE 0
+/** TX timestamp from jiffies */
+#define TX_TSTAMP_COARSE 1
+
+/**
+ *  @brief Check if a TX packet needs a queue timestamp in moal
+ *
+ *  mlan stamps on its own when WMM admission control needs the delay.
+ *
+ *  @param priv     A pointer to moal_private structure
+ *
+ *  @return         MTRUE or MFALSE
+ */
+static inline t_u8 woal_tx_tstamp_needed(moal_private *priv)
+{
+	if (priv->pkt_fate_monitor_enable)
+		return MTRUE;
+#ifdef DEBUG_LEVEL1
+	/* TX latency trace */
+	if (drvdbg & MDAT_D)
+		return MTRUE;
+#endif
+	return MFALSE;
+}
+
+/**
+ *  @brief Record the time to the first data packet after a fw reload
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *
+ *  @return         N/A
+ */
+static inline void woal_reload_note_packet(moal_handle *handle)
+{
+	if (unlikely(handle->reload_start_us)) {
+		handle->reload_first_pkt_us = (t_u32)(ktime_to_us(ktime_get()) -
+						      handle->reload_start_us);
+		handle->reload_start_us = 0;
+	}
+}
+
 /* CAC Measure report default time 60 seconds */
 #define MEAS_REPORT_TIME (60 * HZ)
 
@@ -3123,7 +3535,10 @@ mlan_status woal_init_sw(moal_handle *handle);
 void woal_update_firmware_name(moal_handle *handle);
 /** cancel all works in the queue */
 void woal_terminate_workqueue(moal_handle *handle);
+void woal_tx_stage_free(moal_handle *handle);
 void woal_flush_workqueue(moal_handle *handle);
+void woal_flush_worker(moal_worker *worker);
+void woal_stop_worker(moal_worker *worker);
 /** initializes firmware */
 mlan_status woal_init_fw(moal_handle *handle);
 /** frees the structure of moal_handle */
@@ -3166,6 +3581,15 @@ moal_handle *woal_add_card(void *card, struct device *dev, moal_if_ops *if_ops,
 /** Remove card */
 mlan_status woal_remove_card(void *card);
 /** broadcast event */
+void woal_evt_ring_init(moal_handle *handle);
+void woal_evt_ring_free(moal_handle *handle);
+void woal_trace_ring_init(moal_handle *handle);
+void woal_trace_ring_free(moal_handle *handle);
+void woal_mmap_ring_init(moal_mmap_ring *ring, int size_kb, char *name);
+void woal_mmap_ring_free(moal_mmap_ring *ring, char *name);
+moal_mmap_rec *woal_mmap_ring_reserve(moal_mmap_ring *ring, t_u32 len,
+				      unsigned long *flags);
+void woal_mmap_ring_commit(moal_mmap_ring *ring, unsigned long flags);
 mlan_status woal_broadcast_event(moal_private *priv, t_u8 *payload, t_u32 len);
 #ifdef CONFIG_PROC_FS
 /** switch driver mode */
@@ -3186,6 +3610,8 @@ t_u8 woal_check_driver_status(moal_handle *handle);
 /** Mgmt frame forward registration */
 int woal_reg_rx_mgmt_ind(moal_private *priv, t_u16 action,
 			 t_u32 *pmgmt_subtype_mask, t_u8 wait_option);
+/** Mgmt frame forward registration from atomic context */
+int woal_reg_rx_mgmt_ind_async(moal_private *priv, t_u32 mgmt_subtype_mask);
 #ifdef DEBUG_LEVEL1
 /** Set driver debug bit masks */
 int woal_set_drvdbg(moal_private *priv, t_u32 drv_dbg);
@@ -3204,6 +3630,13 @@ void woal_request_set_multicast_list(moal_private *priv,
 /** Request IOCTL action */
 mlan_status woal_request_ioctl(moal_private *priv, mlan_ioctl_req *req,
 			       t_u8 wait_option);
+/** Submit IOCTL and get completion through callback */
+mlan_status woal_request_ioctl_async(moal_private *priv, mlan_ioctl_req *req,
+				     moal_ioctl_cb callback, void *ctx);
+/** Submit a batch of IOCTLs and wait for all of them */
+mlan_status woal_request_ioctl_batch(moal_private *priv, mlan_ioctl_req **reqs,
+				     int num, t_u8 wait_option,
+				     mlan_status *status);
 /** Set/Get generic element */
 mlan_status woal_set_get_gen_ie(moal_private *priv, t_u32 action, t_u8 *ie,
 				int *ie_len, t_u8 wait_option);
@@ -3249,6 +3682,14 @@ mlan_status woal_cancel_hs(moal_private *priv, t_u8 wait_option);
 int woal_enable_hs(moal_private *priv);
 /** hs active timeout 2 second */
 #define HS_ACTIVE_TIMEOUT (2 * HZ)
+/** Max time in ms to hold the data path after resume */
+#define HS_CANCEL_TIMEOUT 1000
+/** Poll period in ms while waiting for suspend to be allowed */
+#define SUSPEND_POLL_PERIOD 10
+/** Max time in ms to wait for suspend to be allowed */
+#define SUSPEND_POLL_TIMEOUT 800
+/** Release the data path held after resume */
+void woal_resume_traffic(moal_handle *handle);
 #endif
 /** Get wakeup reason */
 mlan_status woal_get_wakeup_reason(moal_private *priv,
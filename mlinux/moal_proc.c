@@ -302,6 +302,87 @@ static const struct file_operations info_proc_fops = {
 };
 #endif
 
+#ifdef UAP_SUPPORT
+/**
+ *  @brief Proc read function for per-station statistics
+ *
+ *  @param sfp      pointer to seq_file structure
+ *  @param data
+ *
+ *  @return         0
+ */
+static int woal_sta_stats_proc_read(struct seq_file *sfp, void *data)
+{
+	struct net_device *netdev = (struct net_device *)sfp->private;
+	moal_private *priv = (moal_private *)netdev_priv(netdev);
+	mlan_ds_sta_stats *sta_stats = NULL;
+	sta_stats_data *entry = NULL;
+	int i;
+
+	ENTER();
+
+	if (!MODULE_GET) {
+		LEAVE();
+		return 0;
+	}
+
+	sta_stats = kzalloc(sizeof(mlan_ds_sta_stats), GFP_KERNEL);
+	if (!sta_stats)
+		goto done;
+	if (MLAN_STATUS_SUCCESS !=
+	    woal_uap_get_sta_stats(priv, MOAL_IOCTL_WAIT, sta_stats)) {
+		PRINTM(MERROR, "Get sta_stats failed!\n");
+		goto done;
+	}
+	seq_printf(sfp, "sta_count = %u\n", sta_stats->sta_count);
+	for (i = 0; i < sta_stats->sta_count && i < MAX_NUM_CLIENTS; i++) {
+		entry = &sta_stats->info[i];
+		seq_printf(sfp,
+			   FULL_MACSTR
+			   " rssi=%d snr=%d nf=%d rx_rate=%u rate_info=0x%x rx_pkts=%llu rx_bytes=%llu tx_pkts=%llu tx_bytes=%llu last_rx_ms=%llu\n",
+			   FULL_MAC2STR(entry->mac_address),
+			   entry->traffic.fw_rssi, entry->snr, entry->nf,
+			   entry->traffic.rx_rate, entry->traffic.rx_rate_info,
+			   entry->traffic.rx_packets, entry->traffic.rx_bytes,
+			   entry->traffic.tx_packets, entry->traffic.tx_bytes,
+			   entry->last_rx_in_msec);
+	}
+done:
+	kfree(sta_stats);
+	MODULE_PUT;
+	LEAVE();
+	return 0;
+}
+
+static int woal_sta_stats_proc_open(struct inode *inode, struct file *file)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	return single_open(file, woal_sta_stats_proc_read, pde_data(inode));
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	return single_open(file, woal_sta_stats_proc_read, PDE_DATA(inode));
+#else
+	return single_open(file, woal_sta_stats_proc_read, PDE(inode)->data);
+#endif
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops sta_stats_proc_fops = {
+	.proc_open = woal_sta_stats_proc_open,
+	.proc_read = seq_read,
+	.proc_lseek = seq_lseek,
+	.proc_release = single_release,
+};
+#else
+static const struct file_operations sta_stats_proc_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_sta_stats_proc_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+#endif
+#endif
+
 #define CMD52_STR_LEN 50
 /*
  *  @brief Parse cmd52 string
@@ -682,6 +763,566 @@ static const struct file_operations fw_dump_fops = {
 };
 #endif
 
+/**
+ *  @brief Print the counters of one worker thread
+ *
+ *  @param sfp      pointer to seq_file structure
+ *  @param name     thread name
+ *  @param worker   pointer to moal_worker structure
+ *
+ *  @return         N/A
+ */
+static void woal_thread_stats_show(struct seq_file *sfp, char *name,
+				   moal_worker *worker)
+{
+	t_u64 lat_avg = 0;
+
+	if (!worker->task) {
+		seq_printf(sfp, "%s: off\n", name);
+		return;
+	}
+	if (worker->runs)
+		lat_avg = moal_do_div(worker->wake_lat, worker->runs);
+	seq_printf(sfp,
+		   "%s: pid=%d cpu=%d wakeups=%u runs=%u run_time_us=%llu wake_lat_avg_us=%llu wake_lat_max_us=%u\n",
+		   name, worker->task->pid, task_cpu(worker->task),
+		   atomic_read(&worker->wakeups), worker->runs,
+		   worker->run_time, lat_avg, worker->wake_lat_max);
+}
+
+/**
+ *  @brief thread_stats proc read function
+ *
+ *  @param sfp      pointer to seq_file structure
+ *  @param data
+ *
+ *  @return         0
+ */
+static int woal_thread_stats_read(struct seq_file *sfp, void *data)
+{
+	moal_handle *handle = (moal_handle *)sfp->private;
+
+	ENTER();
+
+	if (MODULE_GET == 0) {
+		LEAVE();
+		return 0;
+	}
+
+	if (!handle) {
+		PRINTM(MERROR, "handle is NULL!\n");
+		goto done;
+	}
+	woal_thread_stats_show(sfp, "main", &handle->main_thread);
+	woal_thread_stats_show(sfp, "rx", &handle->rx_thread);
+done:
+	MODULE_PUT;
+	LEAVE();
+	return 0;
+}
+
+static int woal_thread_stats_proc_open(struct inode *inode, struct file *file)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	return single_open(file, woal_thread_stats_read, pde_data(inode));
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	return single_open(file, woal_thread_stats_read, PDE_DATA(inode));
+#else
+	return single_open(file, woal_thread_stats_read, PDE(inode)->data);
+#endif
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops thread_stats_fops = {
+	.proc_open = woal_thread_stats_proc_open,
+	.proc_read = seq_read,
+	.proc_lseek = seq_lseek,
+	.proc_release = single_release,
+};
+#else
+static const struct file_operations thread_stats_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_thread_stats_proc_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+#endif
+
+/**
+ *  @brief boot_timeline proc read function
+ *
+ *  @param sfp      pointer to seq_file structure
+ *  @param data
+ *
+ *  @return         0
+ */
+static int woal_boot_timeline_read(struct seq_file *sfp, void *data)
+{
+	moal_handle *handle = (moal_handle *)sfp->private;
+	static const char *const phase_name[BOOT_PHASE_MAX] = {
+		"probe",     "fw_request", "fw_download", "fw_ready",
+		"init_data", "init_cmd",   "interface_up"};
+	t_u32 total = 0;
+	int i;
+
+	ENTER();
+
+	if (MODULE_GET == 0) {
+		LEAVE();
+		return 0;
+	}
+
+	if (!handle) {
+		PRINTM(MERROR, "handle is NULL!\n");
+		goto done;
+	}
+	for (i = 0; i < BOOT_PHASE_MAX; i++) {
+		seq_printf(sfp, "%s=%u\n", phase_name[i],
+			   handle->boot_phase[i]);
+		total += handle->boot_phase[i];
+	}
+	seq_printf(sfp, "total=%u\n", total);
+done:
+	MODULE_PUT;
+	LEAVE();
+	return 0;
+}
+
+static int woal_boot_timeline_proc_open(struct inode *inode,
+					struct file *file)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	return single_open(file, woal_boot_timeline_read, pde_data(inode));
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	return single_open(file, woal_boot_timeline_read, PDE_DATA(inode));
+#else
+	return single_open(file, woal_boot_timeline_read, PDE(inode)->data);
+#endif
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops boot_timeline_fops = {
+	.proc_open = woal_boot_timeline_proc_open,
+	.proc_read = seq_read,
+	.proc_lseek = seq_lseek,
+	.proc_release = single_release,
+};
+#else
+static const struct file_operations boot_timeline_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_boot_timeline_proc_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+#endif
+
+/** event_ring is read through woal_evt_ring_read, not seq_read */
+static int woal_evt_ring_show(struct seq_file *sfp, void *data)
+{
+	return 0;
+}
+
+static int woal_evt_ring_proc_open(struct inode *inode, struct file *file)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	return single_open(file, woal_evt_ring_show, pde_data(inode));
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	return single_open(file, woal_evt_ring_show, PDE_DATA(inode));
+#else
+	return single_open(file, woal_evt_ring_show, PDE(inode)->data);
+#endif
+}
+
+/**
+ *  @brief Copy data out of the event ring, wrapping at the end of the
+ *  buffer
+ *
+ *  @param ring     pointer to moal_evt_ring
+ *  @param pos      free running read offset
+ *  @param buf      pointer to user buffer
+ *  @param len      length of data
+ *
+ *  @return         0 or -EFAULT
+ */
+static int woal_evt_ring_copy_out(moal_evt_ring *ring, t_u32 pos,
+				  char __user *buf, t_u32 len)
+{
+	t_u32 off = pos & (ring->size - 1);
+	t_u32 n = MIN(len, ring->size - off);
+
+	if (copy_to_user(buf, ring->buf + off, n))
+		return -EFAULT;
+	if (n < len && copy_to_user(buf + n, ring->buf, len - n))
+		return -EFAULT;
+	return 0;
+}
+
+/**
+ *  @brief event_ring proc read function, returns as many whole event
+ *  records as fit in the user buffer. Blocks until an event is queued
+ *  unless the file is opened with O_NONBLOCK.
+ *
+ *  @param file     file pointer
+ *  @param buf      pointer to user buffer
+ *  @param count    size of user buffer
+ *  @param ppos     offset (not used)
+ *
+ *  @return         number of bytes read or error code
+ */
+static ssize_t woal_evt_ring_read(struct file *file, char __user *buf,
+				  size_t count, loff_t *ppos)
+{
+	struct seq_file *sfp = file->private_data;
+	moal_handle *handle = (moal_handle *)sfp->private;
+	moal_evt_ring *ring = &handle->evt_ring;
+	moal_evt_rec rec;
+	unsigned long flags;
+	t_u32 off, n, rec_len;
+	t_u32 rp, wp;
+	ssize_t copied = 0;
+	ssize_t ret = 0;
+
+	ENTER();
+	if (!ring->buf) {
+		LEAVE();
+		return -ENODEV;
+	}
+	if (MOAL_ACQ_SEMAPHORE_BLOCK(&ring->read_sem)) {
+		LEAVE();
+		return -ERESTARTSYS;
+	}
+	while (MTRUE) {
+		spin_lock_irqsave(&ring->lock, flags);
+		wp = ring->wp;
+		spin_unlock_irqrestore(&ring->lock, flags);
+		if (wp != ring->rp || ring->shutdown)
+			break;
+		if (file->f_flags & O_NONBLOCK) {
+			ret = -EAGAIN;
+			goto done;
+		}
+		if (wait_event_interruptible(ring->wait_q,
+					     ring->wp != ring->rp ||
+						     ring->shutdown)) {
+			ret = -ERESTARTSYS;
+			goto done;
+		}
+	}
+
+	rp = ring->rp;
+	while (rp != wp) {
+		/* Record header may wrap too */
+		off = rp & (ring->size - 1);
+		n = MIN(sizeof(rec), ring->size - off);
+		moal_memcpy_ext(handle, &rec, ring->buf + off, n, sizeof(rec));
+		if (n < sizeof(rec))
+			moal_memcpy_ext(handle, (t_u8 *)&rec + n, ring->buf,
+					sizeof(rec) - n, sizeof(rec) - n);
+		rec_len = ALIGN_SZ(sizeof(rec) + rec.len, EVT_REC_ALIGN);
+		if (copied + rec_len > count)
+			break;
+		if (woal_evt_ring_copy_out(ring, rp, buf + copied, rec_len)) {
+			if (!copied)
+				ret = -EFAULT;
+			break;
+		}
+		copied += rec_len;
+		rp += rec_len;
+	}
+	if (copied) {
+		spin_lock_irqsave(&ring->lock, flags);
+		ring->rp = rp;
+		spin_unlock_irqrestore(&ring->lock, flags);
+		ret = copied;
+	} else if (!ret && rp != wp) {
+		/* User buffer can't hold the first record */
+		ret = -EINVAL;
+	}
+done:
+	MOAL_REL_SEMAPHORE(&ring->read_sem);
+	LEAVE();
+	return ret;
+}
+
+/**
+ *  @brief event_ring proc poll function
+ *
+ *  @param file     file pointer
+ *  @param wait     poll table
+ *
+ *  @return         poll mask
+ */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 16, 0)
+static __poll_t woal_evt_ring_poll(struct file *file, poll_table *wait)
+#else
+static unsigned int woal_evt_ring_poll(struct file *file, poll_table *wait)
+#endif
+{
+	struct seq_file *sfp = file->private_data;
+	moal_handle *handle = (moal_handle *)sfp->private;
+	moal_evt_ring *ring = &handle->evt_ring;
+	unsigned int mask = 0;
+
+	if (!ring->buf)
+		return POLLERR;
+	poll_wait(file, &ring->wait_q, wait);
+	if (ring->wp != ring->rp)
+		mask |= POLLIN | POLLRDNORM;
+	if (ring->shutdown)
+		mask |= POLLHUP;
+	return mask;
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops evt_ring_fops = {
+	.proc_open = woal_evt_ring_proc_open,
+	.proc_read = woal_evt_ring_read,
+	.proc_poll = woal_evt_ring_poll,
+	.proc_release = single_release,
+};
+#else
+static const struct file_operations evt_ring_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_evt_ring_proc_open,
+	.read = woal_evt_ring_read,
+	.poll = woal_evt_ring_poll,
+	.release = single_release,
+};
+#endif
+
+/**
+ *  @brief Trace ring proc read function, dumps the binary records of
+ *  every CPU for mlanutl --trace
+ *
+ *  @param sfp      pointer to seq_file structure
+ *  @param data
+ *
+ *  @return         Number of output data or MLAN_STATUS_FAILURE
+ */
+static int woal_trace_ring_show(struct seq_file *sfp, void *data)
+{
+	moal_handle *handle = (moal_handle *)sfp->private;
+	moal_trace_ring *ring;
+	t_u32 head, seq, num;
+	int cpu;
+
+	ENTER();
+	if (!handle || !handle->trace_ring) {
+		LEAVE();
+		return 0;
+	}
+	for_each_possible_cpu (cpu) {
+		ring = per_cpu_ptr(handle->trace_ring, cpu);
+		head = ring->head;
+		num = MIN(head, handle->trace_ring_size);
+		for (seq = head - num; seq != head; seq++)
+			seq_write(sfp,
+				  &ring->rec[seq & (handle->trace_ring_size -
+						    1)],
+				  sizeof(moal_trace_rec));
+	}
+	LEAVE();
+	return 0;
+}
+
+static int woal_trace_ring_proc_open(struct inode *inode, struct file *file)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	return single_open(file, woal_trace_ring_show, pde_data(inode));
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	return single_open(file, woal_trace_ring_show, PDE_DATA(inode));
+#else
+	return single_open(file, woal_trace_ring_show, PDE(inode)->data);
+#endif
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops trace_ring_fops = {
+	.proc_open = woal_trace_ring_proc_open,
+	.proc_read = seq_read,
+	.proc_lseek = seq_lseek,
+	.proc_release = single_release,
+};
+#else
+static const struct file_operations trace_ring_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_trace_ring_proc_open,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = single_release,
+};
+#endif
+
+/** mmap rings are mapped through woal_mmap_ring_mmap, not seq_read */
+static int woal_mmap_ring_show(struct seq_file *sfp, void *data)
+{
+	return 0;
+}
+
+/**
+ *  @brief mmap ring proc open function, only one reader may map a ring
+ *  at a time. The ring is emptied on open.
+ *
+ *  @param file     file pointer
+ *  @param ring     pointer to moal_mmap_ring
+ *
+ *  @return         0 or error code
+ */
+static int woal_mmap_ring_open(struct file *file, moal_mmap_ring *ring)
+{
+	unsigned long flags;
+	int ret;
+
+	if (!ring->ctrl)
+		return -ENODEV;
+	if (atomic_inc_return(&ring->users) > 1) {
+		atomic_dec(&ring->users);
+		return -EBUSY;
+	}
+	ret = single_open(file, woal_mmap_ring_show, ring);
+	if (ret) {
+		atomic_dec(&ring->users);
+		return ret;
+	}
+	spin_lock_irqsave(&ring->lock, flags);
+	ring->wp = 0;
+	ring->seq = 0;
+	ring->pending = 0;
+	ring->ctrl->wp = 0;
+	ring->ctrl->rp = 0;
+	ring->ctrl->packets = 0;
+	ring->ctrl->dropped = 0;
+	ring->ctrl->wake_batch = 0;
+	spin_unlock_irqrestore(&ring->lock, flags);
+	return 0;
+}
+
+/**
+ *  @brief mmap ring proc release function
+ *
+ *  @param inode    pointer to inode
+ *  @param file     file pointer
+ *
+ *  @return         0
+ */
+static int woal_mmap_ring_release(struct inode *inode, struct file *file)
+{
+	struct seq_file *sfp = file->private_data;
+	moal_mmap_ring *ring = (moal_mmap_ring *)sfp->private;
+
+	atomic_dec(&ring->users);
+	return single_release(inode, file);
+}
+
+/**
+ *  @brief mmap ring proc mmap function, maps the control page followed
+ *  by the record area
+ *
+ *  @param file     file pointer
+ *  @param vma      pointer to vm_area_struct
+ *
+ *  @return         0 or error code
+ */
+static int woal_mmap_ring_mmap(struct file *file, struct vm_area_struct *vma)
+{
+	struct seq_file *sfp = file->private_data;
+	moal_mmap_ring *ring = (moal_mmap_ring *)sfp->private;
+
+	if (!ring->ctrl || vma->vm_pgoff)
+		return -EINVAL;
+	return remap_vmalloc_range(vma, ring->ctrl, 0);
+}
+
+/**
+ *  @brief mmap ring proc poll function
+ *
+ *  @param file     file pointer
+ *  @param wait     poll table
+ *
+ *  @return         poll mask
+ */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 16, 0)
+static __poll_t woal_mmap_ring_poll(struct file *file, poll_table *wait)
+#else
+static unsigned int woal_mmap_ring_poll(struct file *file, poll_table *wait)
+#endif
+{
+	struct seq_file *sfp = file->private_data;
+	moal_mmap_ring *ring = (moal_mmap_ring *)sfp->private;
+	unsigned int mask = 0;
+
+	if (!ring->ctrl)
+		return POLLERR;
+	poll_wait(file, &ring->wait_q, wait);
+	if (ring->ctrl->wp != ring->ctrl->rp)
+		mask |= POLLIN | POLLRDNORM;
+	return mask;
+}
+
+static int woal_mon_ring_proc_open(struct inode *inode, struct file *file)
+{
+	moal_handle *handle;
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	handle = (moal_handle *)pde_data(inode);
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	handle = (moal_handle *)PDE_DATA(inode);
+#else
+	handle = (moal_handle *)PDE(inode)->data;
+#endif
+	return woal_mmap_ring_open(file, &handle->mon_ring);
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops mon_ring_fops = {
+	.proc_open = woal_mon_ring_proc_open,
+	.proc_mmap = woal_mmap_ring_mmap,
+	.proc_poll = woal_mmap_ring_poll,
+	.proc_release = woal_mmap_ring_release,
+};
+#else
+static const struct file_operations mon_ring_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_mon_ring_proc_open,
+	.mmap = woal_mmap_ring_mmap,
+	.poll = woal_mmap_ring_poll,
+	.release = woal_mmap_ring_release,
+};
+#endif
+
+static int woal_csi_ring_proc_open(struct inode *inode, struct file *file)
+{
+	moal_handle *handle;
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 16, 0)
+	handle = (moal_handle *)pde_data(inode);
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 10, 0)
+	handle = (moal_handle *)PDE_DATA(inode);
+#else
+	handle = (moal_handle *)PDE(inode)->data;
+#endif
+	return woal_mmap_ring_open(file, &handle->csi_ring);
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+static const struct proc_ops csi_ring_fops = {
+	.proc_open = woal_csi_ring_proc_open,
+	.proc_mmap = woal_mmap_ring_mmap,
+	.proc_poll = woal_mmap_ring_poll,
+	.proc_release = woal_mmap_ring_release,
+};
+#else
+static const struct file_operations csi_ring_fops = {
+	.owner = THIS_MODULE,
+	.open = woal_csi_ring_proc_open,
+	.mmap = woal_mmap_ring_mmap,
+	.poll = woal_mmap_ring_poll,
+	.release = woal_mmap_ring_release,
+};
+#endif
+
 /**
  *  @brief wifi status proc read function
  *
@@ -836,6 +1477,12 @@ void woal_proc_init(moal_handle *handle)
 	char config_proc_dir[20];
 	char drv_dump_dir[20];
 	char fw_dump_dir[20];
+	char thread_stats_dir[20];
+	char boot_timeline_dir[20];
+	char evt_ring_dir[20];
+	char trace_ring_dir[20];
+	char mon_ring_dir[20];
+	char csi_ring_dir[20];
 
 	ENTER();
 
@@ -919,6 +1566,91 @@ void woal_proc_init(moal_handle *handle)
 	if (!r)
 		PRINTM(MERROR, "Failed to create proc fw dump\n");
 
+	strcpy(thread_stats_dir, "thread_stats");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(thread_stats_dir, 0444, handle->proc_wlan,
+			     &thread_stats_fops, handle);
+#else
+	r = create_proc_entry(thread_stats_dir, 0444, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &thread_stats_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc thread stats\n");
+
+	strcpy(boot_timeline_dir, "boot_timeline");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(boot_timeline_dir, 0444, handle->proc_wlan,
+			     &boot_timeline_fops, handle);
+#else
+	r = create_proc_entry(boot_timeline_dir, 0444, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &boot_timeline_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc boot timeline\n");
+
+	handle->evt_ring.shutdown = MFALSE;
+	strcpy(evt_ring_dir, "event_ring");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(evt_ring_dir, 0444, handle->proc_wlan,
+			     &evt_ring_fops, handle);
+#else
+	r = create_proc_entry(evt_ring_dir, 0444, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &evt_ring_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc event ring\n");
+
+	strcpy(trace_ring_dir, "trace");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(trace_ring_dir, 0444, handle->proc_wlan,
+			     &trace_ring_fops, handle);
+#else
+	r = create_proc_entry(trace_ring_dir, 0444, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &trace_ring_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc trace ring\n");
+
+	strcpy(mon_ring_dir, "mon_ring");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(mon_ring_dir, 0600, handle->proc_wlan,
+			     &mon_ring_fops, handle);
+#else
+	r = create_proc_entry(mon_ring_dir, 0600, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &mon_ring_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc monitor ring\n");
+
+	strcpy(csi_ring_dir, "csi_ring");
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+	r = proc_create_data(csi_ring_dir, 0600, handle->proc_wlan,
+			     &csi_ring_fops, handle);
+#else
+	r = create_proc_entry(csi_ring_dir, 0600, handle->proc_wlan);
+	if (r) {
+		r->data = handle;
+		r->proc_fops = &csi_ring_fops;
+	}
+#endif
+	if (!r)
+		PRINTM(MERROR, "Failed to create proc CSI ring\n");
+
 done:
 	LEAVE();
 }
@@ -935,6 +1667,12 @@ void woal_proc_exit(moal_handle *handle)
 	char config_proc_dir[20];
 	char drv_dump_dir[20];
 	char fw_dump_dir[20];
+	char thread_stats_dir[20];
+	char boot_timeline_dir[20];
+	char evt_ring_dir[20];
+	char trace_ring_dir[20];
+	char mon_ring_dir[20];
+	char csi_ring_dir[20];
 
 	ENTER();
 
@@ -946,6 +1684,21 @@ void woal_proc_exit(moal_handle *handle)
 		remove_proc_entry(drv_dump_dir, handle->proc_wlan);
 		strcpy(fw_dump_dir, "fw_dump");
 		remove_proc_entry(fw_dump_dir, handle->proc_wlan);
+		strcpy(thread_stats_dir, "thread_stats");
+		remove_proc_entry(thread_stats_dir, handle->proc_wlan);
+		strcpy(boot_timeline_dir, "boot_timeline");
+		remove_proc_entry(boot_timeline_dir, handle->proc_wlan);
+		/* Let blocked readers return before the entry goes away */
+		handle->evt_ring.shutdown = MTRUE;
+		wake_up_interruptible(&handle->evt_ring.wait_q);
+		strcpy(evt_ring_dir, "event_ring");
+		remove_proc_entry(evt_ring_dir, handle->proc_wlan);
+		strcpy(trace_ring_dir, "trace");
+		remove_proc_entry(trace_ring_dir, handle->proc_wlan);
+		strcpy(mon_ring_dir, "mon_ring");
+		remove_proc_entry(mon_ring_dir, handle->proc_wlan);
+		strcpy(csi_ring_dir, "csi_ring");
+		remove_proc_entry(csi_ring_dir, handle->proc_wlan);
 
 #if LINUX_VERSION_CODE < KERNEL_VERSION(3, 10, 0)
 		/* Remove only if we are the only instance using this */
@@ -1060,6 +1813,25 @@ void woal_create_proc_entry(moal_private *priv)
 #endif
 			if (!r)
 				PRINTM(MMSG, "Fail to create proc info\n");
+#ifdef UAP_SUPPORT
+			if (priv->bss_type == MLAN_BSS_TYPE_UAP) {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(2, 6, 26)
+				r = proc_create_data("sta_stats", 0444,
+						     priv->proc_entry,
+						     &sta_stats_proc_fops, dev);
+#else
+				r = create_proc_entry("sta_stats", 0444,
+						      priv->proc_entry);
+				if (r) {
+					r->data = dev;
+					r->proc_fops = &sta_stats_proc_fops;
+				}
+#endif
+				if (!r)
+					PRINTM(MMSG,
+					       "Fail to create proc sta_stats\n");
+			}
+#endif
 		}
 	}
 
@@ -1078,6 +1850,10 @@ void woal_proc_remove(moal_private *priv)
 	ENTER();
 	if (priv->phandle->proc_wlan && priv->proc_entry) {
 		remove_proc_entry("info", priv->proc_entry);
+#ifdef UAP_SUPPORT
+		if (priv->bss_type == MLAN_BSS_TYPE_UAP)
+			remove_proc_entry("sta_stats", priv->proc_entry);
+#endif
 		remove_proc_entry(priv->proc_entry_name,
 				  priv->phandle->proc_wlan);
 #if LINUX_VERSION_CODE < KERNEL_VERSION(3, 10, 0)
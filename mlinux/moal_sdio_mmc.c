@@ -138,6 +138,41 @@ static void woal_dump_sdio_reg(moal_handle *handle)
 /********************************************************
 		Global Functions
 ********************************************************/
+/**
+ *  @brief This function keeps serving the card from the interrupt handler
+ *  while it has work, for up to int_poll_budget status polls, before the
+ *  SDIO interrupt is enabled again
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param func     A pointer to sdio_func structure
+ *
+ *  @return         N/A
+ */
+static void woal_sdio_int_poll(moal_handle *handle, struct sdio_func *func)
+{
+	int window = handle->params.int_poll_window;
+	int i;
+
+	for (i = 0; i < handle->params.int_poll_budget; i++) {
+		if (handle->surprise_removed == MTRUE ||
+		    handle->is_suspended == MTRUE)
+			break;
+		if (window > 0) {
+			/* Let other contexts use the bus during the window */
+			sdio_release_host(func);
+			usleep_range(window, window + (window >> 2) + 1);
+			sdio_claim_host(func);
+		}
+		if (mlan_interrupt_poll(handle->pmlan_adapter) !=
+		    MLAN_STATUS_SUCCESS)
+			break;
+		WOAL_TRACE(handle, MTRACE_SDIO_INT, MTRUE, i);
+		handle->main_state = MOAL_START_MAIN_PROCESS;
+		mlan_main_process(handle->pmlan_adapter);
+		handle->main_state = MOAL_END_MAIN_PROCESS;
+	}
+}
+
 /**
  *  @brief This function handles the interrupt.
  *
@@ -167,6 +202,7 @@ static void woal_sdio_interrupt(struct sdio_func *func)
 	handle->main_state = MOAL_RECV_INT;
 	PRINTM(MINFO, "*** IN SDIO IRQ ***\n");
 	PRINTM(MINTR, "*\n");
+	WOAL_TRACE(handle, MTRACE_SDIO_INT, MFALSE, 0);
 
 	/* call mlan_interrupt to read int status */
 	mlan_interrupt(0, handle->pmlan_adapter);
@@ -181,6 +217,8 @@ static void woal_sdio_interrupt(struct sdio_func *func)
 	/* Call MLAN main process */
 	mlan_main_process(handle->pmlan_adapter);
 	handle->main_state = MOAL_END_MAIN_PROCESS;
+	if (handle->params.int_poll_budget > 0)
+		woal_sdio_int_poll(handle, func);
 	LEAVE();
 }
 
@@ -432,10 +470,11 @@ int woal_sdio_suspend(struct device *dev)
 	mmc_pm_flag_t pm_flags = 0;
 	moal_handle *handle = NULL;
 	struct sdio_mmc_card *cardp;
-	int i, retry_num = 8;
+	int i, retry_num = SUSPEND_POLL_TIMEOUT / SUSPEND_POLL_PERIOD;
 	int ret = MLAN_STATUS_SUCCESS;
 	int hs_actived = 0;
 	mlan_ds_ps_info pm_info;
+	t_u64 start_us = ktime_to_us(ktime_get());
 
 	ENTER();
 	PRINTM(MCMND, "<--- Enter woal_sdio_suspend --->\n");
@@ -488,14 +527,19 @@ int woal_sdio_suspend(struct device *dev)
 				PRINTM(MMSG,
 				       "Suspend not allowed and retry again\n");
 		}
-		woal_sched_timeout(100);
+		woal_sched_timeout(SUSPEND_POLL_PERIOD);
 	}
+	handle->suspend_wait_us = (t_u32)(ktime_to_us(ktime_get()) - start_us);
 	if (pm_info.is_suspend_allowed == MFALSE) {
 		PRINTM(MMSG, "Suspend not allowed\n");
 		ret = -EBUSY;
 		goto done;
 	}
 
+	if (handle->resume_gated) {
+		woal_cancel_timer(&handle->resume_gate_timer);
+		handle->resume_gated = MFALSE;
+	}
 	for (i = 0; i < handle->priv_num; i++)
 		netif_device_detach(handle->priv[i]->netdev);
 
@@ -544,6 +588,7 @@ int woal_sdio_suspend(struct device *dev)
 #ifdef IMX_SUPPORT
 	woal_enable_oob_wakeup_irq(handle);
 #endif /* IMX_SUPPORT */
+	handle->suspend_us = (t_u32)(ktime_to_us(ktime_get()) - start_us);
 done:
 	PRINTM(MCMND, "<--- Leave woal_sdio_suspend --->\n");
 	LEAVE();
@@ -562,6 +607,7 @@ int woal_sdio_resume(struct device *dev)
 	moal_handle *handle = NULL;
 	struct sdio_mmc_card *cardp;
 	int i;
+	t_u64 start_us = ktime_to_us(ktime_get());
 
 	ENTER();
 	PRINTM(MCMND, "<--- Enter woal_sdio_resume --->\n");
@@ -587,14 +633,25 @@ int woal_sdio_resume(struct device *dev)
 		LEAVE();
 		return MLAN_STATUS_SUCCESS;
 	}
-	for (i = 0; i < handle->priv_num; i++)
-		netif_device_attach(handle->priv[i]->netdev);
+	/* Do not wait for the host sleep cancel to be acked; hold the data
+	 * path until firmware reports host sleep deactivated instead */
+	handle->resume_start_us = start_us;
+	if (handle->hs_activated) {
+		handle->resume_gated = MTRUE;
+		woal_mod_timer(&handle->resume_gate_timer, HS_CANCEL_TIMEOUT);
+	} else {
+		for (i = 0; i < handle->priv_num; i++)
+			netif_device_attach(handle->priv[i]->netdev);
+	}
 
 	/* Disable Host Sleep */
-	woal_cancel_hs(woal_get_priv(handle, MLAN_BSS_ROLE_ANY), MOAL_NO_WAIT);
+	if (woal_cancel_hs(woal_get_priv(handle, MLAN_BSS_ROLE_ANY),
+			   MOAL_NO_WAIT) == MLAN_STATUS_FAILURE)
+		woal_resume_traffic(handle);
 #ifdef IMX_SUPPORT
 	woal_disable_oob_wakeup_irq(handle);
 #endif /* IMX_SUPPORT */
+	handle->resume_us = (t_u32)(ktime_to_us(ktime_get()) - start_us);
 	PRINTM(MCMND, "<--- Leave woal_sdio_resume --->\n");
 	LEAVE();
 	return MLAN_STATUS_SUCCESS;
@@ -740,6 +797,8 @@ static mlan_status woal_sdio_rw_mb(moal_handle *handle, pmlan_buffer pmbuf_list,
 		PRINTM(MERROR, "ERROR: num_sg=%d", num_sg);
 		return MLAN_STATUS_FAILURE;
 	}
+	WOAL_TRACE(handle, write ? MTRACE_SDIO_WR_MB : MTRACE_SDIO_RD_MB, port,
+		   num_sg);
 	sg_init_table(sg_list, num_sg);
 	pmbuf = pmbuf_list->pnext;
 	for (i = 0; i < num_sg; i++) {
@@ -819,6 +878,7 @@ static mlan_status woal_sdiommc_write_data_sync(moal_handle *handle,
 	int status = 0;
 	if (pmbuf->use_count > 1)
 		return woal_sdio_rw_mb(handle, pmbuf, port, MTRUE);
+	WOAL_TRACE(handle, MTRACE_SDIO_WR, port, blkcnt * blksz);
 #ifdef SDIO_MMC_DEBUG
 	handle->cmd53w = 1;
 #endif
@@ -868,6 +928,7 @@ static mlan_status woal_sdiommc_read_data_sync(moal_handle *handle,
 	int status = 0;
 	if (pmbuf->use_count > 1)
 		return woal_sdio_rw_mb(handle, pmbuf, port, MFALSE);
+	WOAL_TRACE(handle, MTRACE_SDIO_RD, port, blkcnt * blksz);
 #ifdef SDIO_MMC_DEBUG
 	handle->cmd53r = 1;
 #endif
@@ -1161,6 +1222,8 @@ done:
 #define DEBUG_FW_DONE 0xFF
 #define DEBUG_MEMDUMP_FINISH 0xFE
 #define MAX_POLL_TRIES 100
+/** Max size of the fw dump register window */
+#define MAX_DUMP_REG_WINDOW 64
 
 typedef enum {
 	DUMP_TYPE_ITCM = 0,
@@ -1267,6 +1330,46 @@ static rdwr_status woal_cmd52_rdwr_firmware(moal_handle *phandle, t_u8 doneflag)
 	return RDWR_STATUS_SUCCESS;
 }
 
+/**
+ *  @brief This function reads the firmware dump register window
+ *
+ *  The whole window is fetched with one incrementing-address CMD53.
+ *  If that fails, *bulk is cleared and the window is read back with
+ *  CMD52 for the rest of the dump.
+ *
+ *  @param phandle   A pointer to moal_handle
+ *  @param reg_start First dump register
+ *  @param reg_end   Last dump register
+ *  @param buf       Buffer to receive reg_end - reg_start + 1 bytes
+ *  @param bulk      Pointer to CMD53 enable flag
+ *
+ *  @return         MLAN_STATUS_SUCCESS or MLAN_STATUS_FAILURE
+ */
+static mlan_status woal_sdio_read_dump_regs(moal_handle *phandle,
+					    t_u32 reg_start, t_u32 reg_end,
+					    t_u8 *buf, t_u8 *bulk)
+{
+	struct sdio_func *func = ((struct sdio_mmc_card *)phandle->card)->func;
+	t_u32 reg;
+	int status = 0;
+
+	if (*bulk) {
+		sdio_claim_host(func);
+		status = sdio_memcpy_fromio(func, buf, reg_start,
+					    reg_end - reg_start + 1);
+		sdio_release_host(func);
+		if (!status)
+			return MLAN_STATUS_SUCCESS;
+		PRINTM(MMSG, "Dump CMD53 read error=%d, use CMD52\n", status);
+		*bulk = MFALSE;
+	}
+	for (reg = reg_start; reg <= reg_end; reg++) {
+		if (woal_sdio_readb(phandle, reg, buf++))
+			return MLAN_STATUS_FAILURE;
+	}
+	return MLAN_STATUS_SUCCESS;
+}
+
 /**
  *  @brief This function dump firmware memory to file
  *
@@ -1291,6 +1394,10 @@ void woal_dump_firmware_info_v2(moal_handle *phandle)
 	t_u8 dbg_dump_start_reg = 0;
 	t_u8 dbg_dump_end_reg = 0;
 	t_u8 dbg_dump_ctrl_reg = 0;
+	t_u8 chunk[MAX_DUMP_REG_WINDOW];
+	t_u8 bulk = MTRUE;
+	t_u32 chunk_len = 0;
+	t_u32 j = 0;
 
 	if (!phandle) {
 		PRINTM(MERROR, "Could not dump firmwware info\n");
@@ -1300,6 +1407,12 @@ void woal_dump_firmware_info_v2(moal_handle *phandle)
 	dbg_dump_start_reg = phandle->card_info->dump_fw_start_reg;
 	dbg_dump_end_reg = phandle->card_info->dump_fw_end_reg;
 	dbg_dump_ctrl_reg = phandle->card_info->dump_fw_ctrl_reg;
+	chunk_len = dbg_dump_end_reg - dbg_dump_start_reg + 1;
+	if (dbg_dump_end_reg < dbg_dump_start_reg ||
+	    chunk_len > MAX_DUMP_REG_WINDOW) {
+		PRINTM(MERROR, "Invalid fw dump register window\n");
+		return;
+	}
 
 	if (!phandle->fw_dump_buf) {
 		ret = moal_vmalloc(phandle, FW_DUMP_INFO_LEN,
@@ -1378,12 +1491,14 @@ void woal_dump_firmware_info_v2(moal_handle *phandle)
 				goto done;
 			reg_start = dbg_dump_start_reg;
 			reg_end = dbg_dump_end_reg;
-			for (reg = reg_start; reg <= reg_end; reg++) {
-				ret = woal_sdio_readb(phandle, reg, dbg_ptr);
-				if (ret) {
-					PRINTM(MMSG, "SDIO READ ERR\n");
-					goto done;
-				}
+			ret = woal_sdio_read_dump_regs(phandle, reg_start,
+						       reg_end, chunk, &bulk);
+			if (ret) {
+				PRINTM(MMSG, "SDIO READ ERR\n");
+				goto done;
+			}
+			for (j = 0; j < chunk_len; j++) {
+				*dbg_ptr = chunk[j];
 				if (dbg_ptr < end_ptr)
 					dbg_ptr++;
 				else
@@ -1457,6 +1572,10 @@ void woal_dump_firmware_info_v3(moal_handle *phandle)
 	t_u8 dbg_dump_end_reg = 0;
 	memory_type_mapping *pmem_type_mapping_tbl =
 		&mem_type_mapping_tbl_8977_8997;
+	t_u8 chunk[MAX_DUMP_REG_WINDOW];
+	t_u8 bulk = MTRUE;
+	t_u32 chunk_len = 0;
+	t_u32 j = 0;
 
 	if (!phandle) {
 		PRINTM(MERROR, "Could not dump firmwware info\n");
@@ -1475,6 +1594,12 @@ void woal_dump_firmware_info_v3(moal_handle *phandle)
 
 	dbg_dump_start_reg = phandle->card_info->dump_fw_start_reg;
 	dbg_dump_end_reg = phandle->card_info->dump_fw_end_reg;
+	chunk_len = dbg_dump_end_reg - dbg_dump_start_reg + 1;
+	if (dbg_dump_end_reg < dbg_dump_start_reg ||
+	    chunk_len > MAX_DUMP_REG_WINDOW) {
+		PRINTM(MERROR, "Invalid fw dump register window\n");
+		return;
+	}
 
 	/* start dump fw memory */
 	moal_get_system_time(phandle, &sec, &usec);
@@ -1523,13 +1648,14 @@ void woal_dump_firmware_info_v3(moal_handle *phandle)
 			goto done;
 		reg_start = dbg_dump_start_reg;
 		reg_end = dbg_dump_end_reg;
-		for (reg = reg_start; reg <= reg_end; reg++) {
-			ret = woal_sdio_readb(phandle, reg, dbg_ptr);
-			if (ret) {
-				PRINTM(MMSG, "SDIO READ ERR\n");
-				goto done;
-			}
-			dbg_ptr++;
+		ret = woal_sdio_read_dump_regs(phandle, reg_start, reg_end,
+					       chunk, &bulk);
+		if (ret) {
+			PRINTM(MMSG, "SDIO READ ERR\n");
+			goto done;
+		}
+		for (j = 0; j < chunk_len; j++) {
+			*dbg_ptr++ = chunk[j];
 			if (dbg_ptr >= end_ptr) {
 				PRINTM(MMSG,
 				       "pre-allocced buf is not enough\n");
@@ -1689,7 +1815,7 @@ static void woal_sdiommc_dump_fw_info(moal_handle *phandle)
 		woal_dump_firmware_info_v3(phandle);
 		if (phandle->event_fw_dump) {
 			phandle->event_fw_dump = MFALSE;
-			queue_work(phandle->workqueue, &phandle->main_work);
+			woal_queue_main_work(phandle);
 			phandle->is_fw_dump_timer_set = MTRUE;
 			woal_mod_timer(&phandle->fw_dump_timer, MOAL_TIMER_5S);
 			return;
@@ -1699,7 +1825,7 @@ static void woal_sdiommc_dump_fw_info(moal_handle *phandle)
 		woal_get_priv(phandle, MLAN_BSS_ROLE_ANY));
 	phandle->fw_dump = MFALSE;
 	mlan_pm_wakeup_card(phandle->pmlan_adapter, MFALSE);
-	queue_work(phandle->workqueue, &phandle->main_work);
+	woal_queue_main_work(phandle);
 	woal_process_hang(phandle);
 	return;
 }
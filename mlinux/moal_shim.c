@@ -347,6 +347,37 @@ mlan_status moal_get_boot_ktime(t_void *pmoal, t_u64 *pnsec)
 	return MLAN_STATUS_SUCCESS;
 }
 
+/**
+ *  @brief Retrieves the TX packet timestamp
+ *
+ *  The clock is selected by the tx_tstamp module parameter: the raw
+ *  monotonic clock, or jiffies which is cheaper on slow cores.
+ *
+ *  @param pmoal Pointer to the MOAL context
+ *  @param pnsec     Pointer to buf for the Nanoseconds of timestamp
+ *
+ *  @return         MLAN_STATUS_SUCCESS
+ */
+mlan_status moal_get_tx_tstamp(t_void *pmoal, t_u64 *pnsec)
+{
+	moal_handle *handle = (moal_handle *)pmoal;
+
+	if (handle->params.tx_tstamp == TX_TSTAMP_COARSE) {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 10, 0)
+		*pnsec = jiffies64_to_nsecs(get_jiffies_64());
+#else
+		*pnsec = (t_u64)jiffies_to_msecs(jiffies) * NSEC_PER_MSEC;
+#endif
+	} else {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 17, 0)
+		*pnsec = ktime_get_raw_ns();
+#else
+		*pnsec = ktime_to_ns(ktime_get());
+#endif
+	}
+	return MLAN_STATUS_SUCCESS;
+}
+
 /**
  *  @brief Initializes the timer
  *
@@ -688,7 +719,15 @@ mlan_status moal_ioctl_complete(t_void *pmoal, pmlan_ioctl_req pioctl_req,
 
 	spin_lock_irqsave(&handle->driver_lock, flags);
 	wait = (wait_queue *)pioctl_req->reserved_1;
-	if (wait) {
+	if (wait && wait->callback) {
+		moal_ioctl_cb callback = wait->callback;
+		void *ctx = wait->ctx;
+
+		wait->callback = NULL;
+		wait->ctx = NULL;
+		spin_unlock_irqrestore(&handle->driver_lock, flags);
+		callback(priv, pioctl_req, status, ctx);
+	} else if (wait) {
 		wait->condition = MTRUE;
 		wait->status = status;
 		if (wait->wait_timeout) {
@@ -763,6 +802,8 @@ mlan_status moal_send_packet_complete(t_void *pmoal, pmlan_buffer pmbuf,
 	moal_private *priv = NULL;
 	moal_handle *handle = (moal_handle *)pmoal;
 	struct sk_buff *skb = NULL;
+	t_u64 done_nsec = 0;
+	t_u32 drv_ts_usec = 0;
 #if LINUX_VERSION_CODE > KERNEL_VERSION(2, 6, 29)
 	t_u32 index = 0;
 #endif
@@ -778,7 +819,17 @@ mlan_status moal_send_packet_complete(t_void *pmoal, pmlan_buffer pmbuf,
 		skb = (struct sk_buff *)pmbuf->pdesc;
 		if (priv) {
 			woal_set_trans_start(priv->netdev);
+			if (status == MLAN_STATUS_SUCCESS)
+				woal_reload_note_packet(handle);
 			if (skb) {
+				if (pmbuf->in_ts_nsec) {
+					drv_ts_usec = (t_u32)moal_do_div(
+						pmbuf->in_ts_nsec, 1000);
+					moal_get_tx_tstamp(handle, &done_nsec);
+					done_nsec -= pmbuf->in_ts_nsec;
+					PRINTM(MDAT_D, "Tx latency %llu us\n",
+					       moal_do_div(done_nsec, 1000));
+				}
 				if (status == MLAN_STATUS_SUCCESS) {
 					priv->stats.tx_packets++;
 					priv->stats.tx_bytes += skb->len;
@@ -787,8 +838,9 @@ mlan_status moal_send_packet_complete(t_void *pmoal, pmlan_buffer pmbuf,
 					woal_packet_fate_monitor(
 						priv, PACKET_TYPE_TX,
 						TX_PKT_FATE_SENT,
-						FRAME_TYPE_ETHERNET_II, 0, 0,
-						skb->data, skb->data_len);
+						FRAME_TYPE_ETHERNET_II,
+						drv_ts_usec, 0, skb->data,
+						skb->data_len);
 #endif
 #endif
 				} else {
@@ -798,8 +850,9 @@ mlan_status moal_send_packet_complete(t_void *pmoal, pmlan_buffer pmbuf,
 					woal_packet_fate_monitor(
 						priv, PACKET_TYPE_TX,
 						TX_PKT_FATE_DRV_DROP_OTHER,
-						FRAME_TYPE_ETHERNET_II, 0, 0,
-						skb->data, skb->data_len);
+						FRAME_TYPE_ETHERNET_II,
+						drv_ts_usec, 0, skb->data,
+						skb->data_len);
 #endif
 #endif
 				}
@@ -954,31 +1007,254 @@ mlan_status moal_read_reg(t_void *pmoal, t_u32 reg, t_u32 *data)
 #if defined(STA_CFG80211) && defined(UAP_CFG80211)
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 8, 0)
 /**
- *  @brief This function uploads the packet to the network stack monitor
- * interface
+ *  @brief This function builds the radiotap header template of the
+ *  monitor interface for a channel, the fields that do not change from
+ *  frame to frame
  *
- *  @param handle Pointer to the MOAL context
+ *  @param mon_if   A pointer to monitor_iface structure
+ *  @param chan_num Channel number
+ *
+ *  @return         N/A
+ */
+static void woal_mon_build_rt_tmpl(monitor_iface *mon_if, t_u8 chan_num)
+{
+	struct radiotap_header *rth = &mon_if->rt_tmpl;
+	t_u8 band = (chan_num <= 14) ? IEEE80211_BAND_2GHZ :
+				       IEEE80211_BAND_5GHZ;
+
+	memset(rth, 0, sizeof(*rth));
+	rth->hdr.it_version = PKTHDR_RADIOTAP_VERSION;
+	rth->hdr.it_pad = 0;
+	rth->hdr.it_len = cpu_to_le16(sizeof(*rth));
+	rth->hdr.it_present = cpu_to_le32(
+		(1 << IEEE80211_RADIOTAP_TSFT) |
+		(1 << IEEE80211_RADIOTAP_FLAGS) |
+		(1 << IEEE80211_RADIOTAP_CHANNEL) |
+		(1 << IEEE80211_RADIOTAP_DBM_ANTSIGNAL) |
+		(1 << IEEE80211_RADIOTAP_DBM_ANTNOISE) |
+		(1 << IEEE80211_RADIOTAP_ANTENNA));
+	/** Channel */
+	rth->body.channel.frequency = woal_cpu_to_le16(
+		ieee80211_channel_to_frequency(chan_num, band));
+	rth->body.channel.flags = woal_cpu_to_le16(
+		(band == IEEE80211_BAND_2GHZ) ? CHANNEL_FLAGS_2GHZ :
+						CHANNEL_FLAGS_5GHZ);
+	if (band == IEEE80211_BAND_2GHZ)
+		rth->body.channel.flags |=
+			woal_cpu_to_le16(CHANNEL_FLAGS_DYNAMIC_CCK_OFDM);
+	else
+		rth->body.channel.flags |= woal_cpu_to_le16(CHANNEL_FLAGS_OFDM);
+	if (mon_if->chandef.chan &&
+	    (mon_if->chandef.chan->flags &
+	     (IEEE80211_CHAN_PASSIVE_SCAN | IEEE80211_CHAN_RADAR)))
+		rth->body.channel.flags |=
+			woal_cpu_to_le16(CHANNEL_FLAGS_ONLY_PASSIVSCAN_ALLOW);
+	mon_if->rt_tmpl_chan = chan_num;
+}
+
+/**
+ *  @brief This function fills the radiotap header of a received frame
+ *  from the channel template and the radiotap info saved by mlan in
+ *  front of the frame
+ *
+ *  @param handle   A pointer to moal_handle structure
  *  @param pmbuf    Pointer to mlan_buffer
+ *  @param rth      A pointer to the radiotap header to fill
  *
- *  @return  MLAN_STATUS_SUCCESS/MLAN_STATUS_PENDING/MLAN_STATUS_FAILURE
+ *  @return         N/A
  */
-static mlan_status moal_recv_packet_to_mon_if(moal_handle *handle,
-					      pmlan_buffer pmbuf)
+static void woal_mon_fill_radiotap(moal_handle *handle, pmlan_buffer pmbuf,
+				   struct radiotap_header *rth)
 {
-	mlan_status status = MLAN_STATUS_SUCCESS;
-	struct sk_buff *skb = NULL;
-	struct radiotap_header *rth = NULL;
+	monitor_iface *mon_if = handle->mon_if;
 	radiotap_info rt_info = {};
 	t_u8 format = 0;
 	t_u8 bw = 0;
 	t_u8 gi = 0;
 	t_u8 ldpc = 0;
 	t_u8 chan_num;
-	t_u8 band = 0;
 	struct ieee80211_hdr *dot11_hdr = NULL;
 	t_u8 *payload = NULL;
 	t_u32 vht_sig1 = 0;
 	t_u32 vht_sig2 = 0;
+
+	dot11_hdr = (struct ieee80211_hdr *)(pmbuf->pbuf + pmbuf->data_offset);
+	moal_memcpy_ext(handle, &rt_info,
+			pmbuf->pbuf + pmbuf->data_offset - sizeof(rt_info),
+			sizeof(rt_info), sizeof(rt_info));
+	ldpc = (rt_info.rate_info.rate_info & 0x20) >> 5;
+	format = (rt_info.rate_info.rate_info & 0x18) >> 3;
+	bw = (rt_info.rate_info.rate_info & 0x06) >> 1;
+	gi = rt_info.rate_info.rate_info & 0x01;
+	if (rt_info.chan_num)
+		chan_num = rt_info.chan_num;
+	else
+		chan_num = mon_if->band_chan_cfg.channel;
+	if (chan_num != mon_if->rt_tmpl_chan)
+		woal_mon_build_rt_tmpl(mon_if, chan_num);
+	moal_memcpy_ext(handle, rth, &mon_if->rt_tmpl, sizeof(*rth),
+			sizeof(*rth));
+	/** Timstamp */
+	rth->body.timestamp = woal_cpu_to_le64(jiffies);
+	/** Flags */
+	rth->body.flags = (rt_info.extra_info.flags &
+			   ~(RADIOTAP_FLAGS_USE_SGI_HT |
+			     RADIOTAP_FLAGS_WITH_FRAGMENT |
+			     RADIOTAP_FLAGS_WEP_ENCRYPTION |
+			     RADIOTAP_FLAGS_FAILED_FCS_CHECK));
+	/** reverse fail fcs, 1 means pass FCS in FW, but means
+	 * fail FCS in radiotap */
+	rth->body.flags |= (~rt_info.extra_info.flags) &
+			   RADIOTAP_FLAGS_FAILED_FCS_CHECK;
+	if ((format == MLAN_RATE_FORMAT_HT) && (gi == 1))
+		rth->body.flags |= RADIOTAP_FLAGS_USE_SGI_HT;
+	if (ieee80211_is_mgmt(dot11_hdr->frame_control) ||
+	    ieee80211_is_data(dot11_hdr->frame_control)) {
+		if ((ieee80211_has_morefrags(dot11_hdr->frame_control)) ||
+		    (!ieee80211_is_first_frag(dot11_hdr->seq_ctrl))) {
+			rth->body.flags |= RADIOTAP_FLAGS_WITH_FRAGMENT;
+		}
+	}
+	if (ieee80211_is_data(dot11_hdr->frame_control) &&
+	    ieee80211_has_protected(dot11_hdr->frame_control)) {
+		payload = (t_u8 *)dot11_hdr +
+			  ieee80211_hdrlen(dot11_hdr->frame_control);
+		if (!(*(payload + 3) & 0x20)) /** ExtIV bit shall be 0 for WEP
+						 frame */
+			rth->body.flags |= RADIOTAP_FLAGS_WEP_ENCRYPTION;
+	}
+	/** Rate, t_u8 only apply for LG mode */
+	if (format == MLAN_RATE_FORMAT_LG) {
+		rth->hdr.it_present |=
+			cpu_to_le32(1 << IEEE80211_RADIOTAP_RATE);
+		rth->body.rate = rt_info.rate_info.bitrate;
+	}
+	/** Antenna */
+	rth->body.antenna_signal = -(rt_info.nf - rt_info.snr);
+	rth->body.antenna_noise = -rt_info.nf;
+	rth->body.antenna = rt_info.antenna;
+	/** MCS */
+	if (format == MLAN_RATE_FORMAT_HT) {
+		rth->hdr.it_present |=
+			cpu_to_le32(1 << IEEE80211_RADIOTAP_MCS);
+		rth->body.u.mcs.known = rt_info.extra_info.mcs_known;
+		rth->body.u.mcs.flags = rt_info.extra_info.mcs_flags;
+		/** MCS mcs */
+		rth->body.u.mcs.known |= MCS_KNOWN_MCS_INDEX_KNOWN;
+		rth->body.u.mcs.mcs = rt_info.rate_info.mcs_index;
+		/** MCS bw */
+		rth->body.u.mcs.known |= MCS_KNOWN_BANDWIDTH;
+		rth->body.u.mcs.flags &= ~(0x03); /** Clear, 20MHz as default */
+		if (bw == 1)
+			rth->body.u.mcs.flags |= RX_BW_40;
+		/** MCS gi */
+		rth->body.u.mcs.known |= MCS_KNOWN_GUARD_INTERVAL;
+		rth->body.u.mcs.flags &= ~(1 << 2);
+		if (gi)
+			rth->body.u.mcs.flags |= gi << 2;
+		/** MCS FEC */
+		rth->body.u.mcs.known |= MCS_KNOWN_FEC_TYPE;
+		rth->body.u.mcs.flags &= ~(1 << 4);
+		if (ldpc)
+			rth->body.u.mcs.flags |= ldpc << 4;
+	}
+	/** VHT */
+	if (format == MLAN_RATE_FORMAT_VHT) {
+		vht_sig1 = rt_info.extra_info.vht_sig1;
+		vht_sig2 = rt_info.extra_info.vht_sig2;
+		/** Present Flag */
+		rth->hdr.it_present |=
+			cpu_to_le32(1 << IEEE80211_RADIOTAP_VHT);
+		/** STBC */
+		rth->body.u.vht.known |= woal_cpu_to_le16(VHT_KNOWN_STBC);
+		if (vht_sig1 & MBIT(3))
+			rth->body.u.vht.flags |= VHT_FLAG_STBC;
+		/** TXOP_PS_NA */
+		/** TODO: Not support now */
+		/** GI */
+		rth->body.u.vht.known |= woal_cpu_to_le16(VHT_KNOWN_GI);
+		if (vht_sig2 & MBIT(0))
+			rth->body.u.vht.flags |= VHT_FLAG_SGI;
+		/** SGI NSYM DIS */
+		rth->body.u.vht.known |=
+			woal_cpu_to_le16(VHT_KNOWN_SGI_NSYM_DIS);
+		if (vht_sig2 & MBIT(1))
+			rth->body.u.vht.flags |= VHT_FLAG_SGI_NSYM_M10_9;
+		/** LDPC_EXTRA_OFDM_SYM */
+		/** TODO: Not support now */
+		/** BEAMFORMED */
+		rth->body.u.vht.known |= woal_cpu_to_le16(VHT_KNOWN_BEAMFORMED);
+		if (vht_sig2 & MBIT(8))
+			rth->body.u.vht.flags |= VHT_FLAG_BEAMFORMED;
+		/** BANDWIDTH */
+		rth->body.u.vht.known |= woal_cpu_to_le16(VHT_KNOWN_BANDWIDTH);
+		if (bw == 1)
+			rth->body.u.vht.bandwidth = RX_BW_40;
+		else if (bw == 2)
+			rth->body.u.vht.bandwidth = RX_BW_80;
+		/** GROUP_ID */
+		rth->body.u.vht.known |= woal_cpu_to_le16(VHT_KNOWN_GROUP_ID);
+		rth->body.u.vht.group_id = (vht_sig1 & (0x3F0)) >> 4;
+		/** PARTIAL_AID */
+		/** TODO: Not support now */
+		/** mcs_nss */
+		rth->body.u.vht.mcs_nss[0] = (vht_sig2 & (0xF0)) >> 4;
+		rth->body.u.vht.mcs_nss[0] |= (vht_sig1 & (0x1C00)) >> (10 - 4);
+		/** coding */
+		if (vht_sig2 & MBIT(2))
+			rth->body.u.vht.coding |= VHT_CODING_LDPC_USER0;
+	}
+}
+
+/**
+ *  @brief This function stores a received frame, with its radiotap
+ *  header, in the monitor ring mapped by user space. The frame is
+ *  dropped and counted when the ring is full.
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param pmbuf    Pointer to mlan_buffer
+ *
+ *  @return         N/A
+ */
+static void woal_mon_ring_put(moal_handle *handle, pmlan_buffer pmbuf)
+{
+	moal_mmap_rec *rec;
+	t_u32 rt_len = 0;
+	unsigned long flags;
+
+	if (handle->mon_if->radiotap_enabled)
+		rt_len = sizeof(struct radiotap_header);
+	rec = woal_mmap_ring_reserve(&handle->mon_ring,
+				     rt_len + pmbuf->data_len, &flags);
+	if (!rec)
+		return;
+	rec->ts_sec = pmbuf->out_ts_sec;
+	rec->ts_usec = pmbuf->out_ts_usec;
+	if (rt_len)
+		woal_mon_fill_radiotap(handle, pmbuf,
+				       (struct radiotap_header *)(rec + 1));
+	moal_memcpy_ext(handle, (t_u8 *)(rec + 1) + rt_len,
+			pmbuf->pbuf + pmbuf->data_offset, pmbuf->data_len,
+			pmbuf->data_len);
+	woal_mmap_ring_commit(&handle->mon_ring, flags);
+}
+
+/**
+ *  @brief This function uploads the packet to the network stack monitor
+ * interface, or stores it in the monitor ring while user space has the
+ * ring open
+ *
+ *  @param handle Pointer to the MOAL context
+ *  @param pmbuf    Pointer to mlan_buffer
+ *
+ *  @return  MLAN_STATUS_SUCCESS/MLAN_STATUS_PENDING/MLAN_STATUS_FAILURE
+ */
+static mlan_status moal_recv_packet_to_mon_if(moal_handle *handle,
+					      pmlan_buffer pmbuf)
+{
+	mlan_status status = MLAN_STATUS_SUCCESS;
+	struct sk_buff *skb = NULL;
+	struct radiotap_header *rth = NULL;
 	ENTER();
 	if (!pmbuf->pdesc) {
 		LEAVE();
@@ -987,6 +1263,12 @@ static mlan_status moal_recv_packet_to_mon_if(moal_handle *handle,
 
 	skb = (struct sk_buff *)pmbuf->pdesc;
 
+	if (handle->mon_if && handle->mon_ring.ctrl &&
+	    atomic_read(&handle->mon_ring.users)) {
+		/* The frame is copied, mlan frees the buffer */
+		woal_mon_ring_put(handle, pmbuf);
+		goto done;
+	}
 	if ((handle->mon_if) && netif_running(handle->mon_if->mon_ndev)) {
 		if (handle->mon_if->radiotap_enabled) {
 			if (skb_headroom(skb) < sizeof(*rth)) {
@@ -997,192 +1279,9 @@ static mlan_status moal_recv_packet_to_mon_if(moal_handle *handle,
 				handle->mon_if->stats.rx_dropped++;
 				goto done;
 			}
-			dot11_hdr =
-				(struct ieee80211_hdr *)(pmbuf->pbuf +
-							 pmbuf->data_offset);
-			moal_memcpy_ext(handle, &rt_info,
-					pmbuf->pbuf + pmbuf->data_offset -
-						sizeof(rt_info),
-					sizeof(rt_info), sizeof(rt_info));
-			ldpc = (rt_info.rate_info.rate_info & 0x20) >> 5;
-			format = (rt_info.rate_info.rate_info & 0x18) >> 3;
-			bw = (rt_info.rate_info.rate_info & 0x06) >> 1;
-			gi = rt_info.rate_info.rate_info & 0x01;
 			skb_push(skb, sizeof(*rth));
 			rth = (struct radiotap_header *)skb->data;
-			memset(skb->data, 0, sizeof(*rth));
-			rth->hdr.it_version = PKTHDR_RADIOTAP_VERSION;
-			rth->hdr.it_pad = 0;
-			rth->hdr.it_len = cpu_to_le16(sizeof(*rth));
-			rth->hdr.it_present = cpu_to_le32(
-				(1 << IEEE80211_RADIOTAP_TSFT) |
-				(1 << IEEE80211_RADIOTAP_FLAGS) |
-				(1 << IEEE80211_RADIOTAP_CHANNEL) |
-				(1 << IEEE80211_RADIOTAP_DBM_ANTSIGNAL) |
-				(1 << IEEE80211_RADIOTAP_DBM_ANTNOISE) |
-				(1 << IEEE80211_RADIOTAP_ANTENNA));
-			/** Timstamp */
-			rth->body.timestamp = woal_cpu_to_le64(jiffies);
-			/** Flags */
-			rth->body.flags = (rt_info.extra_info.flags &
-					   ~(RADIOTAP_FLAGS_USE_SGI_HT |
-					     RADIOTAP_FLAGS_WITH_FRAGMENT |
-					     RADIOTAP_FLAGS_WEP_ENCRYPTION |
-					     RADIOTAP_FLAGS_FAILED_FCS_CHECK));
-			/** reverse fail fcs, 1 means pass FCS in FW, but means
-			 * fail FCS in radiotap */
-			rth->body.flags |= (~rt_info.extra_info.flags) &
-					   RADIOTAP_FLAGS_FAILED_FCS_CHECK;
-			if ((format == MLAN_RATE_FORMAT_HT) && (gi == 1))
-				rth->body.flags |= RADIOTAP_FLAGS_USE_SGI_HT;
-			if (ieee80211_is_mgmt(dot11_hdr->frame_control) ||
-			    ieee80211_is_data(dot11_hdr->frame_control)) {
-				if ((ieee80211_has_morefrags(
-					    dot11_hdr->frame_control)) ||
-				    (!ieee80211_is_first_frag(
-					    dot11_hdr->seq_ctrl))) {
-					rth->body.flags |=
-						RADIOTAP_FLAGS_WITH_FRAGMENT;
-				}
-			}
-			if (ieee80211_is_data(dot11_hdr->frame_control) &&
-			    ieee80211_has_protected(dot11_hdr->frame_control)) {
-				payload = (t_u8 *)dot11_hdr +
-					  ieee80211_hdrlen(
-						  dot11_hdr->frame_control);
-				if (!(*(payload + 3) & 0x20)) /** ExtIV bit
-								 shall be 0 for
-								 WEP frame */
-					rth->body.flags |=
-						RADIOTAP_FLAGS_WEP_ENCRYPTION;
-			}
-			/** Rate, t_u8 only apply for LG mode */
-			if (format == MLAN_RATE_FORMAT_LG) {
-				rth->hdr.it_present |= cpu_to_le32(
-					1 << IEEE80211_RADIOTAP_RATE);
-				rth->body.rate = rt_info.rate_info.bitrate;
-			}
-			/** Channel */
-			rth->body.channel.flags = 0;
-			if (rt_info.chan_num)
-				chan_num = rt_info.chan_num;
-			else
-				chan_num =
-					handle->mon_if->band_chan_cfg.channel;
-			band = (chan_num <= 14) ? IEEE80211_BAND_2GHZ :
-						  IEEE80211_BAND_5GHZ;
-			rth->body.channel.frequency = woal_cpu_to_le16(
-				ieee80211_channel_to_frequency(chan_num, band));
-			rth->body.channel.flags |=
-				woal_cpu_to_le16((band == IEEE80211_BAND_2GHZ) ?
-							 CHANNEL_FLAGS_2GHZ :
-							 CHANNEL_FLAGS_5GHZ);
-			if (rth->body.channel.flags &
-			    woal_cpu_to_le16(CHANNEL_FLAGS_2GHZ))
-				rth->body.channel.flags |= woal_cpu_to_le16(
-					CHANNEL_FLAGS_DYNAMIC_CCK_OFDM);
-			else
-				rth->body.channel.flags |=
-					woal_cpu_to_le16(CHANNEL_FLAGS_OFDM);
-			if (handle->mon_if->chandef.chan &&
-			    (handle->mon_if->chandef.chan->flags &
-			     (IEEE80211_CHAN_PASSIVE_SCAN |
-			      IEEE80211_CHAN_RADAR)))
-				rth->body.channel.flags |= woal_cpu_to_le16(
-					CHANNEL_FLAGS_ONLY_PASSIVSCAN_ALLOW);
-			/** Antenna */
-			rth->body.antenna_signal = -(rt_info.nf - rt_info.snr);
-			rth->body.antenna_noise = -rt_info.nf;
-			rth->body.antenna = rt_info.antenna;
-			/** MCS */
-			if (format == MLAN_RATE_FORMAT_HT) {
-				rth->hdr.it_present |= cpu_to_le32(
-					1 << IEEE80211_RADIOTAP_MCS);
-				rth->body.u.mcs.known =
-					rt_info.extra_info.mcs_known;
-				rth->body.u.mcs.flags =
-					rt_info.extra_info.mcs_flags;
-				/** MCS mcs */
-				rth->body.u.mcs.known |=
-					MCS_KNOWN_MCS_INDEX_KNOWN;
-				rth->body.u.mcs.mcs =
-					rt_info.rate_info.mcs_index;
-				/** MCS bw */
-				rth->body.u.mcs.known |= MCS_KNOWN_BANDWIDTH;
-				rth->body.u.mcs.flags &= ~(0x03); /** Clear,
-								     20MHz as
-								     default */
-				if (bw == 1)
-					rth->body.u.mcs.flags |= RX_BW_40;
-				/** MCS gi */
-				rth->body.u.mcs.known |=
-					MCS_KNOWN_GUARD_INTERVAL;
-				rth->body.u.mcs.flags &= ~(1 << 2);
-				if (gi)
-					rth->body.u.mcs.flags |= gi << 2;
-				/** MCS FEC */
-				rth->body.u.mcs.known |= MCS_KNOWN_FEC_TYPE;
-				rth->body.u.mcs.flags &= ~(1 << 4);
-				if (ldpc)
-					rth->body.u.mcs.flags |= ldpc << 4;
-			}
-			/** VHT */
-			if (format == MLAN_RATE_FORMAT_VHT) {
-				vht_sig1 = rt_info.extra_info.vht_sig1;
-				vht_sig2 = rt_info.extra_info.vht_sig2;
-				/** Present Flag */
-				rth->hdr.it_present |= cpu_to_le32(
-					1 << IEEE80211_RADIOTAP_VHT);
-				/** STBC */
-				rth->body.u.vht.known |=
-					woal_cpu_to_le16(VHT_KNOWN_STBC);
-				if (vht_sig1 & MBIT(3))
-					rth->body.u.vht.flags |= VHT_FLAG_STBC;
-				/** TXOP_PS_NA */
-				/** TODO: Not support now */
-				/** GI */
-				rth->body.u.vht.known |=
-					woal_cpu_to_le16(VHT_KNOWN_GI);
-				if (vht_sig2 & MBIT(0))
-					rth->body.u.vht.flags |= VHT_FLAG_SGI;
-				/** SGI NSYM DIS */
-				rth->body.u.vht.known |= woal_cpu_to_le16(
-					VHT_KNOWN_SGI_NSYM_DIS);
-				if (vht_sig2 & MBIT(1))
-					rth->body.u.vht.flags |=
-						VHT_FLAG_SGI_NSYM_M10_9;
-				/** LDPC_EXTRA_OFDM_SYM */
-				/** TODO: Not support now */
-				/** BEAMFORMED */
-				rth->body.u.vht.known |=
-					woal_cpu_to_le16(VHT_KNOWN_BEAMFORMED);
-				if (vht_sig2 & MBIT(8))
-					rth->body.u.vht.flags |=
-						VHT_FLAG_BEAMFORMED;
-				/** BANDWIDTH */
-				rth->body.u.vht.known |=
-					woal_cpu_to_le16(VHT_KNOWN_BANDWIDTH);
-				if (bw == 1)
-					rth->body.u.vht.bandwidth = RX_BW_40;
-				else if (bw == 2)
-					rth->body.u.vht.bandwidth = RX_BW_80;
-				/** GROUP_ID */
-				rth->body.u.vht.known |=
-					woal_cpu_to_le16(VHT_KNOWN_GROUP_ID);
-				rth->body.u.vht.group_id =
-					(vht_sig1 & (0x3F0)) >> 4;
-				/** PARTIAL_AID */
-				/** TODO: Not support now */
-				/** mcs_nss */
-				rth->body.u.vht.mcs_nss[0] =
-					(vht_sig2 & (0xF0)) >> 4;
-				rth->body.u.vht.mcs_nss[0] |=
-					(vht_sig1 & (0x1C00)) >> (10 - 4);
-				/** coding */
-				if (vht_sig2 & MBIT(2))
-					rth->body.u.vht.coding |=
-						VHT_CODING_LDPC_USER0;
-			}
+			woal_mon_fill_radiotap(handle, pmbuf, rth);
 		}
 		skb_set_mac_header(skb, 0);
 		skb->ip_summed = CHECKSUM_UNNECESSARY;
@@ -1371,6 +1470,7 @@ mlan_status moal_recv_packet(t_void *pmoal, pmlan_buffer pmbuf)
 		priv = woal_bss_index_to_priv(pmoal, pmbuf->bss_index);
 		skb = (struct sk_buff *)pmbuf->pdesc;
 		if (priv) {
+			woal_reload_note_packet(handle);
 			if (skb) {
 				skb_reserve(skb, pmbuf->data_offset);
 				if (skb_tailroom(skb) < (int)pmbuf->data_len) {
@@ -1685,6 +1785,33 @@ static void woal_rx_mgmt_pkt_event(moal_private *priv, t_u8 *pkt, t_u16 len)
 #endif
 #endif
 
+/**
+ *  @brief This function stores a CSI report in the CSI ring mapped by
+ *  user space. The report is dropped, leaving a sequence gap, when the
+ *  ring is full.
+ *
+ *  @param handle   A pointer to moal_handle structure
+ *  @param data     A pointer to the CSI record
+ *  @param len      Length of the CSI record
+ *
+ *  @return         N/A
+ */
+static void woal_csi_ring_put(moal_handle *handle, t_u8 *data, t_u32 len)
+{
+	moal_mmap_rec *rec;
+	unsigned long flags;
+	t_u32 sec, usec;
+
+	moal_get_system_time(handle, &sec, &usec);
+	rec = woal_mmap_ring_reserve(&handle->csi_ring, len, &flags);
+	if (!rec)
+		return;
+	rec->ts_sec = sec;
+	rec->ts_usec = usec;
+	moal_memcpy_ext(handle, rec + 1, data, len, len);
+	woal_mmap_ring_commit(&handle->csi_ring, flags);
+}
+
 /**
  *  @brief This function handles event receive
  *
@@ -1750,6 +1877,7 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 #endif
 #endif
 	t_u16 csi_len;
+	t_u8 *csi_buf = NULL;
 #ifdef STA_CFG80211
 	t_u8 channel_status;
 	moal_private *remain_priv = NULL;
@@ -2302,16 +2430,24 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 		break;
 
 	case MLAN_EVENT_ID_DRV_DEFER_HANDLING:
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_EVENT_ID_DRV_FLUSH_RX_WORK:
 		if (moal_extflg_isset(priv->phandle, EXT_NAPI)) {
 			napi_synchronize(&priv->phandle->napi_rx);
 			break;
 		}
+		if (priv->phandle->rx_thread.task) {
+			woal_flush_worker(&priv->phandle->rx_thread);
+			break;
+		}
 		flush_workqueue(priv->phandle->rx_workqueue);
 		break;
 	case MLAN_EVENT_ID_DRV_FLUSH_MAIN_WORK:
+		if (priv->phandle->main_thread.task) {
+			woal_flush_worker(&priv->phandle->main_thread);
+			break;
+		}
 		flush_workqueue(priv->phandle->workqueue);
 		break;
 	case MLAN_EVENT_ID_DRV_DEFER_RX_WORK:
@@ -2319,8 +2455,7 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 			napi_schedule(&priv->phandle->napi_rx);
 			break;
 		}
-		queue_work(priv->phandle->rx_workqueue,
-			   &priv->phandle->rx_work);
+		woal_queue_rx_work(priv->phandle);
 		break;
 	case MLAN_EVENT_ID_DRV_DBG_DUMP:
 		priv->phandle->driver_status = MTRUE;
@@ -2748,6 +2883,7 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 #endif
 #if defined(SDIO_SUSPEND_RESUME)
 		priv->phandle->hs_activated = MFALSE;
+		woal_resume_traffic(priv->phandle);
 #endif
 		break;
 #ifdef UAP_SUPPORT
@@ -3671,6 +3807,13 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 	case MLAN_EVENT_ID_CSI:
 		DBG_HEXDUMP(MEVT_D, "CSI dump", pmevent->event_buf,
 			    pmevent->event_len);
+		if (handle->csi_ring.ctrl &&
+		    atomic_read(&handle->csi_ring.users)) {
+			/* The ring reader replaces the per report events */
+			woal_csi_ring_put(handle, pmevent->event_buf,
+					  pmevent->event_len);
+			break;
+		}
 #ifdef STA_CFG80211
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
 		if (priv->csi_enable)
@@ -3678,19 +3821,25 @@ mlan_status moal_recv_event(t_void *pmoal, pmlan_event pmevent)
 						     pmevent->event_len);
 #endif
 #endif
-		/* Send Netlink event */
+		/* Send Netlink event, the report sits in the rx buffer of
+		 * mlan so there is no room to prepend the header in place */
 		custom_len = strlen(CUS_EVT_CSI) + sizeof(priv->csi_seq);
 		csi_len = pmevent->event_len;
-		memmove(pmevent->event_buf + custom_len, pmevent->event_buf,
-			csi_len);
-		moal_memcpy_ext(priv->phandle, pmevent->event_buf, CUS_EVT_CSI,
+		csi_buf = kmalloc(custom_len + csi_len, GFP_ATOMIC);
+		if (!csi_buf) {
+			PRINTM(MERROR,
+			       "Failed to alloc memory for CSI event\n");
+			break;
+		}
+		moal_memcpy_ext(priv->phandle, csi_buf, CUS_EVT_CSI,
 				strlen(CUS_EVT_CSI), strlen(CUS_EVT_CSI));
-		moal_memcpy_ext(priv->phandle,
-				pmevent->event_buf + strlen(CUS_EVT_CSI),
+		moal_memcpy_ext(priv->phandle, csi_buf + strlen(CUS_EVT_CSI),
 				(t_u8 *)(&(priv->csi_seq)),
 				sizeof(priv->csi_seq), sizeof(priv->csi_seq));
-		woal_broadcast_event(priv, pmevent->event_buf,
-				     custom_len + csi_len);
+		moal_memcpy_ext(priv->phandle, csi_buf + custom_len,
+				pmevent->event_buf, csi_len, csi_len);
+		woal_broadcast_event(priv, csi_buf, custom_len + csi_len);
+		kfree(csi_buf);
 		priv->csi_seq++;
 		break;
 	default:
@@ -3796,6 +3945,24 @@ t_void moal_assert(t_void *pmoal, t_u32 cond)
 	}
 }
 
+/**
+ *  @brief This function records an event in the trace ring
+ *
+ *  @param pmoal     A pointer to moal_private structure
+ *  @param event            Event id, see mlan_trace_event
+ *  @param arg0             Event argument 0
+ *  @param arg1             Event argument 1
+ *
+ *  @return                 N/A
+ */
+t_void moal_trace(t_void *pmoal, t_u32 event, t_u32 arg0, t_u32 arg1)
+{
+#ifdef DEBUG_LEVEL1
+	if (woal_trace_on())
+		woal_trace_record((moal_handle *)pmoal, event, arg0, arg1);
+#endif
+}
+
 /**
  *  @brief This function save the histogram data
  *
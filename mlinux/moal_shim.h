@@ -72,6 +72,7 @@ t_void moal_udelay(t_void *pmoal, t_u32 udelay);
 t_void moal_usleep_range(t_void *pmoal, t_u32 min_delay, t_u32 max_delay);
 mlan_status moal_get_boot_ktime(t_void *pmoal, t_u64 *pnsec);
 mlan_status moal_get_system_time(t_void *pmoal, t_u32 *psec, t_u32 *pusec);
+mlan_status moal_get_tx_tstamp(t_void *pmoal, t_u64 *pnsec);
 mlan_status moal_init_lock(t_void *pmoal, t_void **pplock);
 mlan_status moal_free_lock(t_void *pmoal, t_void *plock);
 mlan_status moal_spin_lock(t_void *pmoal, t_void *plock);
@@ -83,6 +84,7 @@ mlan_status moal_notify_hostcmd_complete(t_void *pmoal, t_u32 bss_index);
 t_void moal_print(t_void *pmoal, t_u32 level, char *pformat, IN...);
 t_void moal_print_netintf(t_void *pmoal, t_u32 bss_index, t_u32 level);
 t_void moal_assert(t_void *pmoal, t_u32 cond);
+t_void moal_trace(t_void *pmoal, t_u32 event, t_u32 arg0, t_u32 arg1);
 t_void moal_hist_data_add(t_void *pmoal, t_u32 bss_index, t_u16 rx_rate,
 			  t_s8 snr, t_s8 nflr, t_u8 antenna);
 
@@ -638,6 +638,8 @@ static int woal_cfg80211_set_monitor_channel(struct wiphy *wiphy,
 				sizeof(handle->mon_if->band_chan_cfg),
 				sizeof(handle->mon_if->band_chan_cfg));
 		handle->mon_if->chandef = *chandef;
+		/* Rebuild the radiotap template on the next frame */
+		handle->mon_if->rt_tmpl_chan = 0;
 
 		if (handle->mon_if->chandef.chan)
 			PRINTM(MINFO,
@@ -2354,7 +2356,7 @@ static int woal_cfg80211_authenticate(struct wiphy *wiphy,
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		woal_free_mlan_buffer(priv->phandle, pmbuf);
@@ -3379,6 +3381,10 @@ static mlan_status woal_cfg80211_dump_station_info(moal_private *priv,
 	mlan_status ret = MLAN_STATUS_SUCCESS;
 	mlan_ds_get_signal signal;
 	mlan_ds_get_stats stats;
+	mlan_ioctl_req *req[2] = {NULL, NULL};
+	mlan_status status[2] = {MLAN_STATUS_FAILURE, MLAN_STATUS_FAILURE};
+	mlan_ds_get_info *info = NULL;
+	int i;
 #if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 0, 0)
 	mlan_bss_info bss_info;
 	t_u8 dtim_period = 0;
@@ -3416,23 +3422,38 @@ static mlan_status woal_cfg80211_dump_station_info(moal_private *priv,
 #endif
 #endif
 
-	/* Get signal information from the firmware */
-	memset(&signal, 0, sizeof(mlan_ds_get_signal));
-	if (MLAN_STATUS_SUCCESS !=
-	    woal_get_signal_info(priv, MOAL_IOCTL_WAIT, &signal)) {
+	/* Get signal and stats information from the firmware in one batch */
+	for (i = 0; i < 2; i++) {
+		req[i] = woal_alloc_mlan_ioctl_req(sizeof(mlan_ds_get_info));
+		if (req[i] == NULL) {
+			ret = MLAN_STATUS_FAILURE;
+			goto done;
+		}
+		req[i]->req_id = MLAN_IOCTL_GET_INFO;
+		req[i]->action = MLAN_ACT_GET;
+	}
+	info = (mlan_ds_get_info *)req[0]->pbuf;
+	info->sub_command = MLAN_OID_GET_SIGNAL;
+	info->param.signal.selector = ALL_RSSI_INFO_MASK;
+	info = (mlan_ds_get_info *)req[1]->pbuf;
+	info->sub_command = MLAN_OID_GET_STATS;
+	woal_request_ioctl_batch(priv, req, 2, MOAL_IOCTL_WAIT, status);
+	if (status[0] != MLAN_STATUS_SUCCESS) {
 		PRINTM(MERROR, "Error getting signal information\n");
 		ret = MLAN_STATUS_FAILURE;
 		goto done;
 	}
-
-	/* Get stats information from the firmware */
-	memset(&stats, 0, sizeof(mlan_ds_get_stats));
-	if (MLAN_STATUS_SUCCESS !=
-	    woal_get_stats_info(priv, MOAL_IOCTL_WAIT, &stats)) {
+	if (status[1] != MLAN_STATUS_SUCCESS) {
 		PRINTM(MERROR, "Error getting stats information\n");
 		ret = MLAN_STATUS_FAILURE;
 		goto done;
 	}
+	info = (mlan_ds_get_info *)req[0]->pbuf;
+	moal_memcpy_ext(priv->phandle, &signal, &info->param.signal,
+			sizeof(mlan_ds_get_signal), sizeof(mlan_ds_get_signal));
+	info = (mlan_ds_get_info *)req[1]->pbuf;
+	moal_memcpy_ext(priv->phandle, &stats, &info->param.stats,
+			sizeof(mlan_ds_get_stats), sizeof(mlan_ds_get_stats));
 
 	sinfo->rx_bytes = priv->stats.rx_bytes;
 	sinfo->tx_bytes = priv->stats.tx_bytes;
@@ -3475,6 +3496,10 @@ static mlan_status woal_cfg80211_dump_station_info(moal_private *priv,
 				sizeof(struct station_info));
 
 done:
+	for (i = 0; i < 2; i++) {
+		if (status[i] != MLAN_STATUS_PENDING)
+			kfree(req[i]);
+	}
 	LEAVE();
 	return ret;
 }
@@ -4740,7 +4765,7 @@ static int woal_send_ft_action_requst(moal_private *priv, t_u8 *ie, t_u8 len,
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		woal_free_mlan_buffer(priv->phandle, pmbuf);
@@ -4840,7 +4865,7 @@ static int woal_send_ft_auth_requst(moal_private *priv, t_u8 *ie, t_u8 len,
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		woal_free_mlan_buffer(priv->phandle, pmbuf);
@@ -6583,7 +6608,7 @@ int woal_cfg80211_resume(struct wiphy *wiphy)
 
 done:
 	handle->cfg80211_suspend = MFALSE;
-	queue_work(handle->rx_workqueue, &handle->rx_work);
+	woal_queue_rx_work(handle);
 
 	PRINTM(MCMND, "<--- Leave woal_cfg80211_resume --->\n");
 	return 0;
@@ -7799,7 +7824,7 @@ static int woal_send_tdls_action_frame(struct wiphy *wiphy,
 	switch (status) {
 	case MLAN_STATUS_PENDING:
 		atomic_inc(&priv->phandle->tx_pending);
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		break;
 	case MLAN_STATUS_SUCCESS:
 		woal_free_mlan_buffer(priv->phandle, pmbuf);
@@ -7936,7 +7961,7 @@ static int woal_send_tdls_data_frame(struct wiphy *wiphy,
 #if CFG80211_VERSION_CODE > KERNEL_VERSION(2, 6, 29)
 		atomic_inc(&priv->wmm_tx_pending[index]);
 #endif
-		queue_work(priv->phandle->workqueue, &priv->phandle->main_work);
+		woal_queue_main_work(priv->phandle);
 		/*delay 10 ms to guarantee the teardown/confirm frame can be
 		 * sent out before disalbe/enable tdls link if we don't delay
 		 * and return immediately, wpa_supplicant will call
@@ -1973,6 +1973,65 @@ done:
 	return ret;
 }
 
+/**
+ *  @brief Issue MLAN_OID_11H_CHAN_DFS_STATE_MAP ioctl to get the DFS state
+ *  of all DFS channels in one request
+ *
+ *  @param priv     Pointer to the moal_private driver data struct
+ *  @param map      Pointer to mlan_ds_11h_dfs_state_map
+ *
+ *  @return         0 --success, otherwise fail
+ */
+int woal_11h_get_dfs_state_map(moal_private *priv,
+			       mlan_ds_11h_dfs_state_map *map)
+{
+	int ret = 0;
+	mlan_ioctl_req *req = NULL;
+	mlan_ds_11h_cfg *ds_11hcfg = NULL;
+	mlan_status status = MLAN_STATUS_SUCCESS;
+#ifdef UAP_CFG80211
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+	int cfg80211_wext = priv->phandle->params.cfg80211_wext;
+	int i;
+#endif
+#endif
+
+	ENTER();
+	req = woal_alloc_mlan_ioctl_req(sizeof(mlan_ds_11h_cfg));
+	if (req == NULL) {
+		ret = -ENOMEM;
+		goto done;
+	}
+	ds_11hcfg = (mlan_ds_11h_cfg *)req->pbuf;
+
+	ds_11hcfg->sub_command = MLAN_OID_11H_CHAN_DFS_STATE_MAP;
+	req->req_id = MLAN_IOCTL_11H_CFG;
+	req->action = MLAN_ACT_GET;
+	status = woal_request_ioctl(priv, req, MOAL_IOCTL_WAIT);
+	if (status != MLAN_STATUS_SUCCESS) {
+		ret = -EFAULT;
+		goto done;
+	}
+	moal_memcpy_ext(priv->phandle, map, &ds_11hcfg->param.dfs_state_map,
+			sizeof(mlan_ds_11h_dfs_state_map),
+			sizeof(mlan_ds_11h_dfs_state_map));
+#ifdef UAP_CFG80211
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+	/* cfg80211 owns the DFS state of its channels */
+	if (IS_UAP_CFG80211(cfg80211_wext)) {
+		for (i = 0; i < map->num_chan; i++)
+			woal_get_wiphy_chan_dfs_state(priv->wdev->wiphy,
+						      &map->chan[i]);
+	}
+#endif
+#endif
+done:
+	if (status != MLAN_STATUS_PENDING)
+		kfree(req);
+	LEAVE();
+	return ret;
+}
+
 /**
  * @brief skip cac on specific channel
  * @and Wext
@@ -4150,6 +4209,72 @@ mlan_status woal_uap_get_stats(moal_private *priv, t_u8 wait_option,
 	return status;
 }
 
+/**
+ *  @brief Get driver maintained per-station statistics
+ *
+ *  When sta_stats_refresh is set and the last refresh is older than
+ *  that period, the station list is fetched from firmware first so the
+ *  RSSI it reports is updated.
+ *
+ *  @param priv                 A pointer to moal_private structure
+ *  @param wait_option          Wait option
+ *  @param sta_stats            A pointer to mlan_ds_sta_stats structure
+ *
+ *  @return                     MLAN_STATUS_SUCCESS -- success, otherwise fail
+ */
+mlan_status woal_uap_get_sta_stats(moal_private *priv, t_u8 wait_option,
+				   mlan_ds_sta_stats *sta_stats)
+{
+	mlan_ds_get_info *info = NULL;
+	mlan_ioctl_req *req = NULL;
+	mlan_status status = MLAN_STATUS_SUCCESS;
+	int refresh = priv->phandle->params.sta_stats_refresh;
+
+	ENTER();
+
+	if (refresh > 0 && priv->bss_started &&
+	    (!priv->sta_stats_jiffies ||
+	     time_after_eq(jiffies, priv->sta_stats_jiffies +
+					    msecs_to_jiffies(refresh)))) {
+		req = woal_alloc_mlan_ioctl_req(sizeof(mlan_ds_get_info));
+		if (req == NULL) {
+			LEAVE();
+			return MLAN_STATUS_FAILURE;
+		}
+		info = (mlan_ds_get_info *)req->pbuf;
+		info->sub_command = MLAN_OID_UAP_STA_LIST;
+		req->req_id = MLAN_IOCTL_GET_INFO;
+		req->action = MLAN_ACT_GET;
+		status = woal_request_ioctl(priv, req, wait_option);
+		if (status == MLAN_STATUS_SUCCESS)
+			priv->sta_stats_jiffies = jiffies;
+		if (status != MLAN_STATUS_PENDING)
+			kfree(req);
+	}
+
+	req = woal_alloc_mlan_ioctl_req(sizeof(mlan_ds_get_info));
+	if (req == NULL) {
+		LEAVE();
+		return MLAN_STATUS_FAILURE;
+	}
+	info = (mlan_ds_get_info *)req->pbuf;
+	info->sub_command = MLAN_OID_UAP_STA_STATS;
+	req->req_id = MLAN_IOCTL_GET_INFO;
+	req->action = MLAN_ACT_GET;
+
+	status = woal_request_ioctl(priv, req, wait_option);
+	if (status == MLAN_STATUS_SUCCESS && sta_stats)
+		moal_memcpy_ext(priv->phandle, sta_stats,
+				&info->param.sta_stats,
+				sizeof(mlan_ds_sta_stats),
+				sizeof(mlan_ds_sta_stats));
+
+	if (status != MLAN_STATUS_PENDING)
+		kfree(req);
+	LEAVE();
+	return status;
+}
+
 /**
  *  @brief Set/Get system configuration parameters
  *
@@ -508,6 +508,9 @@ typedef struct _domain_info_param {
 /** Get/Set channel DFS state */
 int woal_11h_chan_dfs_state(moal_private *priv, t_u8 action,
 			    mlan_ds_11h_chan_dfs_state *ch_dfs_state);
+/** Get DFS state of all DFS channels */
+int woal_11h_get_dfs_state_map(moal_private *priv,
+			       mlan_ds_11h_dfs_state_map *map);
 
 int woal_set_get_uap_power_mode(moal_private *priv, t_u32 action,
 				mlan_ds_ps_mgmt *ps_mgmt);
@@ -537,6 +540,8 @@ void woal_uap_get_version(moal_private *priv, char *version, int max_len);
 #endif
 mlan_status woal_uap_get_stats(moal_private *priv, t_u8 wait_option,
 			       pmlan_ds_uap_stats ustats);
+mlan_status woal_uap_get_sta_stats(moal_private *priv, t_u8 wait_option,
+				   mlan_ds_sta_stats *sta_stats);
 #if defined(UAP_WEXT) || defined(UAP_CFG80211)
 extern struct iw_handler_def woal_uap_handler_def;
 struct iw_statistics *woal_get_uap_wireless_stats(struct net_device *dev);
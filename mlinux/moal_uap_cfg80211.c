@@ -21,6 +21,7 @@
  */
 
 #include "moal_cfg80211.h"
+#include "moal_cfg80211_util.h"
 #include "moal_uap_cfg80211.h"
 /** deauth reason code */
 #define REASON_CODE_DEAUTH_LEAVING 3
@@ -1794,6 +1795,9 @@ int woal_cfg80211_add_virt_if(struct wiphy *wiphy,
 		return -EFAULT;
 	}
 	MLAN_INIT_WORK(&new_priv->mclist_work, woal_mclist_work_queue);
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+	woal_cfg80211_csi_dump_init(new_priv);
+#endif
 
 	woal_init_sta_dev(ndev, new_priv);
 
@@ -1961,6 +1965,9 @@ int woal_cfg80211_del_virt_if(struct wiphy *wiphy, struct net_device *dev)
 			destroy_workqueue(vir_priv->mclist_workqueue);
 			vir_priv->mclist_workqueue = NULL;
 		}
+#if CFG80211_VERSION_CODE >= KERNEL_VERSION(3, 14, 0)
+		woal_cfg80211_csi_dump_stop(vir_priv);
+#endif
 		woal_clear_all_mgmt_ies(vir_priv, MOAL_IOCTL_WAIT);
 		woal_cfg80211_deinit_p2p(vir_priv);
 		woal_bss_remove(vir_priv);